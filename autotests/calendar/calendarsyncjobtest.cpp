@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+#include "calendartestutils.h"
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "calendarsyncjob.h"
+#include "event.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+class CalendarSyncJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testSync()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/events_sync_request.txt"), QFINDTESTDATA("data/events_sync_response.txt")),
+             scenarioFromFile(QFINDTESTDATA("data/events_sync_notfound_request.txt"), QFINDTESTDATA("data/events_sync_notfound_response.txt"))});
+        const auto event = eventFromFile(QFINDTESTDATA("data/event1.json"));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        const QMap<QString, QString> syncTokens = {{QStringLiteral("MockAccount"), QStringLiteral("MockSyncToken1")},
+                                                   {QStringLiteral("MockCalendar2"), QStringLiteral("MockSyncToken1")}};
+        auto job = new CalendarSyncJob(syncTokens, account);
+        // The fake network access manager replays the scenarios in order
+        job->setMaxParallelJobs(1);
+        QSignalSpy syncedSpy(job, &CalendarSyncJob::calendarSynced);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(syncedSpy.count(), 2);
+
+        const auto synced = job->result(QStringLiteral("MockAccount"));
+        QCOMPARE(synced.error, KGAPI2::NoError);
+        QCOMPARE(synced.syncToken, QStringLiteral("MockSyncToken2"));
+        QVERIFY(!synced.fullSync);
+        QCOMPARE(synced.events.count(), 1);
+        QCOMPARE(*synced.events.at(0), *event);
+
+        const auto failed = job->result(QStringLiteral("MockCalendar2"));
+        QCOMPARE(failed.error, KGAPI2::NotFound);
+        QVERIFY(failed.events.isEmpty());
+    }
+
+    void testAllFailed()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/events_sync_notfound_request.txt"), QFINDTESTDATA("data/events_sync_notfound_response.txt"))});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        QMap<QString, QString> syncTokens;
+        syncTokens.insert(QStringLiteral("MockCalendar2"), QStringLiteral("MockSyncToken1"));
+        auto job = new CalendarSyncJob(syncTokens, account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NotFound);
+    }
+};
+
+QTEST_GUILESS_MAIN(CalendarSyncJobTest)
+
+#include "calendarsyncjobtest.moc"
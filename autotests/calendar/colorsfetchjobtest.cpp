@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QObject>
+#include <QTest>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "colorsfetchjob.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+class ColorsFetchJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testFetchAndCache()
+    {
+        ColorsFetchJob::clearCache();
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/colors_fetch_request.txt"), QFINDTESTDATA("data/colors_fetch_response.txt")),
+             scenarioFromFile(QFINDTESTDATA("data/colors_notmodified_request.txt"), QFINDTESTDATA("data/colors_notmodified_response.txt"))});
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+
+        const ColorsFetchJob::ColorDefinitions calendarColors = {
+            {QStringLiteral("1"), {QColor(0xac, 0x72, 0x5e), QColor(0x1d, 0x1d, 0x1d)}},
+            {QStringLiteral("2"), {QColor(0xd0, 0x6b, 0x64), QColor(0x1d, 0x1d, 0x1d)}},
+        };
+
+        auto job = new ColorsFetchJob(account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QVERIFY(!job->isFromCache());
+        QCOMPARE(job->calendarColors(), calendarColors);
+        QCOMPARE(job->eventColors().count(), 1);
+        QCOMPARE(job->eventColors().value(QStringLiteral("1")).background, QColor(0xa4, 0xbd, 0xfc));
+        QCOMPARE(job->updated(), QDateTime(QDate(2012, 2, 14), QTime(0, 0), QTimeZone::UTC));
+
+        // Served from the cache without any request
+        job = new ColorsFetchJob(account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QVERIFY(job->isFromCache());
+        QCOMPARE(job->calendarColors(), calendarColors);
+        QVERIFY(FakeNetworkAccessManagerFactory::get()->hasScenario());
+
+        // Revalidated with the ETag
+        job = new ColorsFetchJob(account);
+        job->setMaxCacheAge(0);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QVERIFY(job->isFromCache());
+        QCOMPARE(job->calendarColors(), calendarColors);
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testInvalidAccount()
+    {
+        auto job = new ColorsFetchJob(AccountPtr());
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::InvalidAccount);
+        QVERIFY(job->calendarColors().isEmpty());
+    }
+};
+
+QTEST_GUILESS_MAIN(ColorsFetchJobTest)
+
+#include "colorsfetchjobtest.moc"
@@ -84,6 +84,25 @@ private Q_SLOTS:
         }
         QVERIFY(execJob(job));
     }
+
+    void testBatchDelete()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/events_batch_delete_request.txt"), QFINDTESTDATA("data/events_batch_delete_response.txt"))});
+        const EventsList events = {eventFromFile(QFINDTESTDATA("data/event1.json")), eventFromFile(QFINDTESTDATA("data/event2.json"))};
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new EventDeleteJob(events, QStringLiteral("MockAccount"), account, nullptr);
+        job->setBatchSize(50);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NotFound);
+
+        const auto results = job->itemResults();
+        QCOMPARE(results.count(), 2);
+        QCOMPARE(results.at(0).error, KGAPI2::NoError);
+        QCOMPARE(results.at(1).error, KGAPI2::NotFound);
+        QCOMPARE(results.at(1).errorString, QStringLiteral("Not Found"));
+    }
 };
 
 QTEST_GUILESS_MAIN(EventDeleteJobTest)
@@ -14,6 +14,7 @@
 #include "account.h"
 #include "event.h"
 #include "eventfetchjob.h"
+#include "syncstatestore.h"
 #include "types.h"
 
 using namespace KGAPI2;
@@ -67,6 +68,112 @@ private Q_SLOTS:
         QVERIFY(returnedEvent);
         QCOMPARE(*returnedEvent, *event);
     }
+
+    void testFetchExpanded()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/events_expanded_request.txt"), QFINDTESTDATA("data/events_expanded_response.txt"))});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new EventFetchJob(QStringLiteral("MockAccount"), account);
+        job->setTimeMin(QDateTime(QDate(2018, 4, 2), QTime(0, 0), QTimeZone::UTC).toSecsSinceEpoch());
+        job->setTimeMax(QDateTime(QDate(2018, 4, 9), QTime(0, 0), QTimeZone::UTC).toSecsSinceEpoch());
+        job->setExpandRecurrences(true);
+        job->setStreaming(true);
+        QList<ObjectsList> pages;
+        connect(job, &FetchJob::itemsReceived, this, [&pages](FetchJob *, const ObjectsList &items) {
+            pages.push_back(items);
+        });
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QVERIFY(job->items().isEmpty());
+
+        QCOMPARE(pages.count(), 1);
+        const auto items = pages.at(0);
+        QCOMPARE(items.count(), 2);
+        for (const auto &item : items) {
+            const auto event = item.dynamicCast<Event>();
+            QVERIFY(event);
+            QVERIFY(event->hasRecurrenceId());
+        }
+    }
+
+    void testSyncStateStore_data()
+    {
+        QTest::addColumn<bool>("discard");
+
+        QTest::newRow("commit") << false;
+        QTest::newRow("discard") << true;
+    }
+
+    void testSyncStateStore()
+    {
+        QFETCH(bool, discard);
+
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/events_sync_request.txt"), QFINDTESTDATA("data/events_sync_response.txt"))});
+
+        MemorySyncStateStore store;
+        const auto key = QStringLiteral("MockAccount/calendar");
+        store.commit(key, QStringLiteral("MockSyncToken1"));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new EventFetchJob(QStringLiteral("MockAccount"), account);
+        job->setFetchDeleted(true);
+        job->setSyncStateStore(&store, key);
+        connect(job, &Job::finished, this, [&store, key, discard](Job *job) {
+            // Not committed before the items are processed
+            QCOMPARE(store.load(key), QStringLiteral("MockSyncToken1"));
+            if (discard) {
+                static_cast<FetchJob *>(job)->discardSyncState();
+            }
+        });
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->items().count(), 1);
+
+        if (discard) {
+            QTest::qWait(50);
+            QCOMPARE(store.load(key), QStringLiteral("MockSyncToken1"));
+        } else {
+            QTRY_COMPARE(store.load(key), QStringLiteral("MockSyncToken2"));
+        }
+    }
+
+    void testSyncTokenExpired()
+    {
+        const auto sync = scenarioFromFile(QFINDTESTDATA("data/events_sync_request.txt"), QFINDTESTDATA("data/events_sync_response.txt"));
+        const auto eventsUrl = [](const QString &syncToken) {
+            return QUrl(QStringLiteral("https://www.googleapis.com/calendar/v3/calendars/MockAccount/events?showDeleted=true%1"
+                                       "&eventTypes=default&eventTypes=focusTime&eventTypes=outOfOffice&prettyPrint=false")
+                            .arg(syncToken.isEmpty() ? QString() : QStringLiteral("&syncToken=") + syncToken));
+        };
+        auto expired = sync;
+        expired.responseCode = KGAPI2::Gone;
+        expired.responseData.clear();
+        auto full = sync;
+        full.requestUrl = eventsUrl(QString());
+        auto incremental = sync;
+        incremental.requestUrl = eventsUrl(QStringLiteral("MockSyncToken2"));
+        FakeNetworkAccessManagerFactory::get()->setScenarios({expired, full, incremental});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new EventFetchJob(QStringLiteral("MockAccount"), account);
+        job->setSyncToken(QStringLiteral("MockSyncToken1"));
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QVERIFY(job->syncTokenExpired());
+        QCOMPARE(job->syncToken(), QStringLiteral("MockSyncToken2"));
+
+        // Restarted with the new token, which is accepted
+        job->restart();
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QVERIFY(!job->syncTokenExpired());
+        QCOMPARE(job->items().count(), 1);
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
 };
 
 QTEST_GUILESS_MAIN(EventFetchJobTest)
@@ -0,0 +1,206 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QObject>
+#include <QRandomGenerator>
+#include <QTest>
+
+#include "event.h"
+#include "eventindex.h"
+#include "types.h"
+
+#include <KCalendarCore/Recurrence>
+
+#include <algorithm>
+
+using namespace KGAPI2;
+
+namespace
+{
+QDateTime dt(int day, int hour, int minute = 0)
+{
+    return QDateTime(QDate(2026, 3, day), QTime(hour, minute), QTimeZone::UTC);
+}
+
+EventPtr makeEvent(const QString &id, const QString &uid, const QDateTime &start, const QDateTime &end)
+{
+    auto event = EventPtr::create();
+    event->setId(id);
+    event->setUid(uid);
+    event->setDtStart(start);
+    event->setDtEnd(end);
+    return event;
+}
+
+QStringList ids(const EventIndex::OccurrencesList &occurrences)
+{
+    QStringList result;
+    for (const auto &occurrence : occurrences) {
+        result.push_back(occurrence.event->id());
+    }
+    return result;
+}
+} // namespace
+
+class EventIndexTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    EventsList testEvents()
+    {
+        auto transparent = makeEvent(QStringLiteral("transparent"), QStringLiteral("transparent@google.com"), dt(2, 9, 30), dt(2, 11));
+        transparent->setTransparency(KCalendarCore::Event::Transparent);
+
+        auto daily = makeEvent(QStringLiteral("daily"), QStringLiteral("daily@google.com"), dt(2, 14), dt(2, 15));
+        daily->recurrence()->setDaily(1);
+        daily->recurrence()->setDuration(10);
+
+        // Moved occurrence
+        auto moved = makeEvent(QStringLiteral("daily_20260303T140000Z"), QStringLiteral("daily@google.com"), dt(3, 16), dt(3, 17));
+        moved->setRecurrenceId(dt(3, 14));
+
+        // Cancelled occurrence as returned by a sync, without the iCalUID
+        auto cancelled = EventPtr::create();
+        cancelled->setId(QStringLiteral("daily_20260304T140000Z"));
+        cancelled->setRecurrenceId(dt(4, 14));
+        cancelled->setStatus(KCalendarCore::Incidence::StatusCanceled);
+        cancelled->setDeleted(true);
+
+        return {makeEvent(QStringLiteral("single"), QStringLiteral("single@google.com"), dt(2, 9), dt(2, 10)),
+                makeEvent(QStringLiteral("reminder"), QStringLiteral("reminder@google.com"), dt(2, 12), dt(2, 12)),
+                transparent,
+                daily,
+                moved,
+                cancelled};
+    }
+
+private Q_SLOTS:
+    void testQueries()
+    {
+        EventIndex index;
+        index.setHorizon(dt(1, 0), QDateTime(QDate(2026, 4, 1), QTime(0, 0), QTimeZone::UTC));
+        index.update(testEvents());
+
+        QCOMPARE(index.eventsCount(), 5);
+        // 3 single events, 10 daily occurrences of which one is cancelled
+        QCOMPARE(index.occurrencesCount(), 12);
+        QVERIFY(index.contains(QStringLiteral("daily_20260303T140000Z")));
+        QVERIFY(!index.contains(QStringLiteral("daily_20260304T140000Z")));
+
+        QCOMPARE(ids(index.occurrences(dt(2, 0), dt(3, 0))),
+                 QStringList({QStringLiteral("single"), QStringLiteral("transparent"), QStringLiteral("reminder"), QStringLiteral("daily")}));
+        QCOMPARE(ids(index.conflicts(dt(2, 0), dt(3, 0))), QStringList({QStringLiteral("single"), QStringLiteral("reminder"), QStringLiteral("daily")}));
+
+        // Intervals are half-open
+        QCOMPARE(ids(index.occurrences(dt(2, 10), dt(2, 12))), QStringList{QStringLiteral("transparent")});
+        QVERIFY(!index.isBusy(dt(2, 10), dt(2, 12)));
+        QVERIFY(index.isBusy(dt(2, 12), dt(2, 12, 30)));
+        QVERIFY(index.isBusy(dt(2, 9, 59), dt(2, 10)));
+
+        // Moved and cancelled occurrences
+        const auto moved = index.occurrences(dt(3, 0), dt(4, 0));
+        QCOMPARE(moved.count(), 1);
+        QCOMPARE(moved.at(0).event->id(), QStringLiteral("daily_20260303T140000Z"));
+        QCOMPARE(moved.at(0).start, dt(3, 16));
+        QVERIFY(index.occurrences(dt(4, 0), dt(5, 0)).isEmpty());
+        const auto regular = index.occurrences(dt(11, 0), dt(12, 0));
+        QCOMPARE(regular.count(), 1);
+        QCOMPARE(regular.at(0).start, dt(11, 14));
+        QCOMPARE(regular.at(0).end, dt(11, 15));
+        QVERIFY(index.occurrences(dt(12, 0), dt(13, 0)).isEmpty());
+    }
+
+    void testSync()
+    {
+        EventIndex index;
+        index.setHorizon(dt(1, 0), QDateTime(QDate(2026, 4, 1), QTime(0, 0), QTimeZone::UTC));
+        index.update(testEvents());
+
+        auto deleted = EventPtr::create();
+        deleted->setId(QStringLiteral("single"));
+        deleted->setDeleted(true);
+        auto modified = makeEvent(QStringLiteral("reminder"), QStringLiteral("reminder@google.com"), dt(5, 8), dt(5, 9));
+        index.update(EventsList{deleted, modified});
+
+        QVERIFY(!index.contains(QStringLiteral("single")));
+        QCOMPARE(ids(index.occurrences(dt(2, 0), dt(3, 0))), QStringList({QStringLiteral("transparent"), QStringLiteral("daily")}));
+        QCOMPARE(ids(index.occurrences(dt(5, 0), dt(6, 0))), QStringList({QStringLiteral("reminder"), QStringLiteral("daily")}));
+
+        // Removing the recurring event removes its exceptions too
+        index.remove(QStringLiteral("daily"));
+        QCOMPARE(index.eventsCount(), 2);
+        QCOMPARE(index.occurrencesCount(), 2);
+        QVERIFY(index.occurrences(dt(3, 0), dt(4, 0)).isEmpty());
+
+        index.clear();
+        QCOMPARE(index.eventsCount(), 0);
+        QVERIFY(index.occurrences(dt(1, 0), dt(31, 0)).isEmpty());
+    }
+
+    void testHorizon()
+    {
+        EventIndex index;
+        index.setHorizon(dt(1, 0), dt(5, 0));
+        index.update(testEvents());
+        QCOMPARE(index.occurrencesCount(), 5);
+        QVERIFY(index.occurrences(dt(5, 0), dt(31, 0)).isEmpty());
+
+        index.setHorizon(dt(10, 0), dt(20, 0));
+        QCOMPARE(index.occurrencesCount(), 2);
+        QCOMPARE(index.occurrences(dt(10, 0), dt(20, 0)).at(0).start, dt(10, 14));
+    }
+
+    void testMatchesLinearScan()
+    {
+        auto *random = QRandomGenerator::global();
+        EventsList events;
+        for (int i = 0; i < 2000; ++i) {
+            const auto start = dt(1, 0).addSecs(random->bounded(30 * 24 * 60) * 60);
+            const auto end = start.addSecs(random->bounded(8 * 60) * 60);
+            events.push_back(makeEvent(QString::number(i), QString::number(i), start, end));
+        }
+
+        EventIndex index;
+        index.setHorizon(dt(1, 0), QDateTime(QDate(2026, 4, 1), QTime(0, 0), QTimeZone::UTC));
+        index.update(events);
+        QCOMPARE(index.occurrencesCount(), events.count());
+
+        for (int i = 0; i < 200; ++i) {
+            // Moved events are merged into the tree built by the previous query
+            if (i % 2 == 1) {
+                const int moved = random->bounded(events.count());
+                const auto start = dt(1, 0).addSecs(random->bounded(30 * 24 * 60) * 60);
+                const auto end = start.addSecs(random->bounded(8 * 60) * 60);
+                events[moved] = makeEvent(QString::number(moved), QString::number(moved), start, end);
+                index.update(EventsList{events.at(moved)});
+            }
+
+            const auto from = dt(1, 0).addSecs(random->bounded(30 * 24 * 60) * 60);
+            const auto to = from.addSecs(random->bounded(24 * 60) * 60);
+
+            QStringList expected;
+            for (const auto &event : std::as_const(events)) {
+                const auto end = std::max(event->dtEnd(), event->dtStart().addMSecs(1));
+                if (event->dtStart() < to && end > from) {
+                    expected.push_back(event->id());
+                }
+            }
+            const auto occurrences = index.occurrences(from, to);
+            QVERIFY(std::is_sorted(occurrences.cbegin(), occurrences.cend(), [](const auto &lhs, const auto &rhs) {
+                return lhs.start < rhs.start;
+            }));
+            auto actual = ids(occurrences);
+            expected.sort();
+            actual.sort();
+            QCOMPARE(actual, expected);
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(EventIndexTest)
+
+#include "eventindextest.moc"
@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QObject>
+#include <QTest>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "event.h"
+#include "eventinstancesfetchjob.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+class EventInstancesFetchJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testFetchInstances_data()
+    {
+        QTest::addColumn<bool>("streaming");
+
+        QTest::newRow("accumulate") << false;
+        QTest::newRow("streaming") << true;
+    }
+
+    void testFetchInstances()
+    {
+        QFETCH(bool, streaming);
+
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/event_instances_request.txt"), QFINDTESTDATA("data/event_instances_response.txt"))});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new EventInstancesFetchJob(QStringLiteral("MockRecurring"), QStringLiteral("MockAccount"), account);
+        job->setTimeMin(QDateTime(QDate(2018, 4, 2), QTime(0, 0), QTimeZone::UTC).toSecsSinceEpoch());
+        job->setTimeMax(QDateTime(QDate(2018, 4, 9), QTime(0, 0), QTimeZone::UTC).toSecsSinceEpoch());
+        job->setStreaming(streaming);
+        QList<ObjectsList> pages;
+        connect(job, &FetchJob::itemsReceived, this, [&pages](FetchJob *, const ObjectsList &items) {
+            pages.push_back(items);
+        });
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+
+        QCOMPARE(pages.count(), 1);
+        const auto received = pages.at(0);
+        QCOMPARE(received.count(), 2);
+        QCOMPARE(job->items().count(), streaming ? 0 : 2);
+
+        const auto first = received.at(0).dynamicCast<Event>();
+        QVERIFY(first);
+        QVERIFY(first->hasRecurrenceId());
+        QCOMPARE(first->recurrenceId(), QDateTime(QDate(2018, 4, 2), QTime(8, 30), QTimeZone::UTC));
+        // Moved instance keeps its original start as recurrence ID
+        const auto second = received.at(1).dynamicCast<Event>();
+        QVERIFY(second);
+        QCOMPARE(second->recurrenceId(), QDateTime(QDate(2018, 4, 3), QTime(8, 30), QTimeZone::UTC));
+        QCOMPARE(second->dtStart(), QDateTime(QDate(2018, 4, 3), QTime(9, 0), QTimeZone::UTC));
+    }
+};
+
+QTEST_GUILESS_MAIN(EventInstancesFetchJobTest)
+
+#include "eventinstancesfetchjobtest.moc"
@@ -71,6 +71,24 @@ private Q_SLOTS:
             QCOMPARE(*returnedEvent, *events.at(i));
         }
     }
+
+    void testPatch()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/event1_patch_request.txt"), QFINDTESTDATA("data/event1_modify_response.txt"))});
+
+        const auto original = eventFromFile(QFINDTESTDATA("data/event1.json"));
+        auto modified = EventPtr::create(*original);
+        modified->setSummary(QStringLiteral("Even Cooler Meeting about stuff"));
+        modified->setLocation(QString());
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new EventModifyJob(modified, QStringLiteral("MockAccount"), account);
+        job->setOriginalEvents({original});
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->items().count(), 1);
+    }
 };
 
 QTEST_GUILESS_MAIN(EventModifyJobTest)
@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QObject>
+#include <QTest>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "calendarservice.h"
+#include "eventwatchjob.h"
+#include "push/channel.h"
+#include "push/channelstopjob.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+class EventWatchJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testWatch()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/events_watch_request.txt"), QFINDTESTDATA("data/events_watch_response.txt"))});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto requested =
+            ChannelPtr::create(QStringLiteral("MockChannel"), QUrl(QStringLiteral("https://push.kde.test/notifications")), QStringLiteral("MockChannelToken"));
+        auto job = new EventWatchJob(requested, QStringLiteral("MockAccount"), account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+
+        const auto channel = job->channel();
+        QVERIFY(channel);
+        QCOMPARE(channel->id(), QStringLiteral("MockChannel"));
+        QCOMPARE(channel->token(), QStringLiteral("MockChannelToken"));
+        QCOMPARE(channel->address(), requested->address());
+        QCOMPARE(channel->resourceId(), QStringLiteral("MockResourceId"));
+        QCOMPARE(channel->expiration().toMSecsSinceEpoch(), Q_INT64_C(1776600000000));
+        QCOMPARE(job->items().count(), 1);
+    }
+
+    void testStop()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/channel_stop_request.txt"), QFINDTESTDATA("data/channel_stop_response.txt"))});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto channel = ChannelPtr::create();
+        channel->setId(QStringLiteral("MockChannel"));
+        channel->setResourceId(QStringLiteral("MockResourceId"));
+        auto job = new ChannelStopJob(channel, CalendarService::stopChannelUrl(), account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+    }
+};
+
+QTEST_GUILESS_MAIN(EventWatchJobTest)
+
+#include "eventwatchjobtest.moc"
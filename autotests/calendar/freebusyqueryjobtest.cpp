@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
  */
 
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QObject>
 #include <QTest>
 
@@ -70,6 +73,83 @@ private Q_SLOTS:
             QCOMPARE(returnedFreeBusy, ranges.at(i));
         }
     }
+
+    void testQueryMultiple()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/freebusy2_query_request.txt"), QFINDTESTDATA("data/freebusy2_query_response.txt"))});
+
+        const QTimeZone tz("Europe/Prague");
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new FreeBusyQueryJob({QStringLiteral("MockAccount"), QStringLiteral("MockRoom"), QStringLiteral("MockMissing")},
+                                        QDateTime({2018, 4, 1}, {10, 0, 0}, tz),
+                                        QDateTime({2018, 4, 2}, {16, 0, 0}, tz),
+                                        account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->failedIds(), QStringList{QStringLiteral("MockMissing")});
+        QCOMPARE(job->busy(QStringLiteral("MockAccount")).count(), 2);
+        QCOMPARE(job->busy(QStringLiteral("MockRoom")).count(), 1);
+
+        const FreeBusyQueryJob::BusyRangeList merged = {{{{2018, 4, 1}, {12, 30, 0}, tz}, {{2018, 4, 1}, {14, 0, 0}, tz}},
+                                                        {{{2018, 4, 1}, {15, 0, 0}, tz}, {{2018, 4, 1}, {16, 30, 0}, tz}}};
+        QCOMPARE(job->mergedBusy(), merged);
+    }
+
+    void testQueryChunks()
+    {
+        const QDateTime timeMin({2018, 4, 1}, {8, 0, 0}, QTimeZone::UTC);
+        const QDateTime timeMax({2018, 4, 2}, {14, 0, 0}, QTimeZone::UTC);
+        const QDateTime busyStart({2018, 4, 1}, {10, 0, 0}, QTimeZone::UTC);
+
+        // Each calendar is busy for half an hour, a minute after the previous one
+        QStringList ids;
+        for (int i = 0; i < 60; ++i) {
+            ids << QStringLiteral("calendar%1").arg(i);
+        }
+        const QString missingId = QStringLiteral("calendar55");
+
+        QList<FakeNetworkAccessManager::Scenario> scenarios;
+        for (int offset = 0; offset < ids.size(); offset += FreeBusyQueryJob::MaxCalendarsPerQuery) {
+            QJsonArray items;
+            QJsonObject calendars;
+            for (int i = offset; i < qMin(offset + FreeBusyQueryJob::MaxCalendarsPerQuery, int(ids.size())); ++i) {
+                items.append(QJsonObject{{QStringLiteral("id"), ids[i]}});
+                if (ids[i] == missingId) {
+                    calendars.insert(ids[i],
+                                     QJsonObject{{QStringLiteral("errors"), QJsonArray{QJsonObject{{QStringLiteral("reason"), QStringLiteral("notFound")}}}}});
+                    continue;
+                }
+                const QJsonObject busy{{QStringLiteral("start"), busyStart.addSecs(i * 60).toString(Qt::ISODate)},
+                                       {QStringLiteral("end"), busyStart.addSecs(i * 60 + 30 * 60).toString(Qt::ISODate)}};
+                calendars.insert(ids[i], QJsonObject{{QStringLiteral("busy"), QJsonArray{busy}}});
+            }
+            const QJsonObject request{{QStringLiteral("items"), items},
+                                      {QStringLiteral("timeMin"), QStringLiteral("2018-04-01T08:00:00Z")},
+                                      {QStringLiteral("timeMax"), QStringLiteral("2018-04-02T14:00:00Z")}};
+            const QJsonObject response{{QStringLiteral("kind"), QStringLiteral("calendar#freeBusy")}, {QStringLiteral("calendars"), calendars}};
+            scenarios << FakeNetworkAccessManager::Scenario(QUrl(QStringLiteral("https://www.googleapis.com/calendar/v3/freeBusy?prettyPrint=false")),
+                                                            QNetworkAccessManager::PostOperation,
+                                                            QJsonDocument(request).toJson(QJsonDocument::Compact),
+                                                            KGAPI2::OK,
+                                                            QJsonDocument(response).toJson(QJsonDocument::Compact));
+        }
+        QCOMPARE(scenarios.size(), 2);
+        FakeNetworkAccessManagerFactory::get()->setScenarios(scenarios);
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new FreeBusyQueryJob(ids, timeMin, timeMax, account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+        QCOMPARE(job->failedIds(), QStringList{missingId});
+        QCOMPARE(job->busy(QStringLiteral("calendar0")).count(), 1);
+        QCOMPARE(job->busy(QStringLiteral("calendar59")).count(), 1);
+        QVERIFY(job->busy(missingId).isEmpty());
+
+        const FreeBusyQueryJob::BusyRangeList merged = {{busyStart, busyStart.addSecs(59 * 60 + 30 * 60)}};
+        QCOMPARE(job->mergedBusy(), merged);
+    }
 };
 
 QTEST_GUILESS_MAIN(FreeBusyQueryJobTest)
@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QObject>
+#include <QTest>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "settingsfetchjob.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+class SettingsFetchJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testFetchAndRevalidate()
+    {
+        SettingsFetchJob::clearCache();
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/settings_fetch_page1_request.txt"), QFINDTESTDATA("data/settings_fetch_page1_response.txt")),
+             scenarioFromFile(QFINDTESTDATA("data/settings_fetch_page2_request.txt"), QFINDTESTDATA("data/settings_fetch_page2_response.txt")),
+             scenarioFromFile(QFINDTESTDATA("data/settings_notmodified_request.txt"), QFINDTESTDATA("data/settings_notmodified_response.txt"))});
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+
+        const QMap<QString, QString> settings = {{QStringLiteral("timezone"), QStringLiteral("Europe/Prague")},
+                                                 {QStringLiteral("weekStart"), QStringLiteral("1")},
+                                                 {QStringLiteral("format24HourTime"), QStringLiteral("true")}};
+
+        auto job = new SettingsFetchJob(account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QVERIFY(!job->isFromCache());
+        QCOMPARE(job->settings(), settings);
+        QCOMPARE(job->setting(QStringLiteral("timezone")), QStringLiteral("Europe/Prague"));
+        QCOMPARE(job->setting(QStringLiteral("locale"), QStringLiteral("en")), QStringLiteral("en"));
+
+        job = new SettingsFetchJob(account);
+        job->setMaxCacheAge(0);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QVERIFY(job->isFromCache());
+        QCOMPARE(job->settings(), settings);
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testInvalidAccount()
+    {
+        auto job = new SettingsFetchJob(AccountPtr());
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::InvalidAccount);
+        QVERIFY(job->settings().isEmpty());
+    }
+};
+
+QTEST_GUILESS_MAIN(SettingsFetchJobTest)
+
+#include "settingsfetchjobtest.moc"
@@ -6,6 +6,7 @@
 
 #include <QObject>
 #include <QTest>
+#include <QUrlQuery>
 
 #include "fakenetworkaccessmanagerfactory.h"
 #include "testutils.h"
@@ -58,6 +59,47 @@ private:
     QByteArray mResponse;
 };
 
+class PagedTestFetchJob : public FetchJob
+{
+    Q_OBJECT
+
+public:
+    PagedTestFetchJob(const QUrl &url, int maximumPageSize, QObject *parent = nullptr)
+        : FetchJob(parent)
+        , mUrl(url)
+    {
+        setPageSizeParameter(QStringLiteral("maxResults"), maximumPageSize);
+    }
+
+    void start() override
+    {
+        enqueueRequest(QNetworkRequest(mUrl));
+    }
+
+    int pages() const
+    {
+        return mPages;
+    }
+
+protected:
+    ObjectsList handleReplyWithItems(const QNetworkReply *, const QByteArray &rawData) override
+    {
+        ++mPages;
+        if (rawData.startsWith("more")) {
+            QUrl url = mUrl;
+            QUrlQuery query(url);
+            query.addQueryItem(QStringLiteral("pageToken"), QString::number(mPages));
+            url.setQuery(query);
+            enqueueRequest(QNetworkRequest(url));
+        }
+        return {};
+    }
+
+private:
+    QUrl mUrl;
+    int mPages = 0;
+};
+
 class FetchJobTest : public QObject
 {
     Q_OBJECT
@@ -138,6 +180,116 @@ private Q_SLOTS:
 
         QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
     }
+
+    void testPageSize_data()
+    {
+        QTest::addColumn<int>("pageSize");
+        QTest::addColumn<bool>("adaptive");
+        QTest::addColumn<int>("maximumPageSize");
+        QTest::addColumn<QList<FakeNetworkAccessManager::Scenario>>("scenarios");
+        QTest::addColumn<int>("pages");
+
+        const auto page = [](const QString &query, int code, const QByteArray &response) {
+            return FakeNetworkAccessManager::Scenario{QUrl(QStringLiteral("https://example.test/request/data?%1").arg(query)),
+                                                      QNetworkAccessManager::GetOperation,
+                                                      {},
+                                                      code,
+                                                      response,
+                                                      false};
+        };
+
+        QTest::newRow("server default") << 0 << false << 100
+                                        << Scenarios{page(QStringLiteral("prettyPrint=false"), 200, "more"),
+                                                     page(QStringLiteral("pageToken=1&prettyPrint=false"), 200, "last")}
+                                        << 2;
+
+        QTest::newRow("fixed") << 50 << false << 100
+                               << Scenarios{page(QStringLiteral("maxResults=50&prettyPrint=false"), 200, "more"),
+                                            page(QStringLiteral("pageToken=1&maxResults=50&prettyPrint=false"), 200, "last")}
+                               << 2;
+
+        QTest::newRow("clamped") << 500 << false << 100 << Scenarios{page(QStringLiteral("maxResults=100&prettyPrint=false"), 200, "last")} << 1;
+
+        QTest::newRow("adaptive growth") << 50 << true << 150
+                                         << Scenarios{page(QStringLiteral("maxResults=50&prettyPrint=false"), 200, "more"),
+                                                      page(QStringLiteral("pageToken=1&maxResults=100&prettyPrint=false"), 200, "more"),
+                                                      page(QStringLiteral("pageToken=2&maxResults=150&prettyPrint=false"), 200, "more"),
+                                                      page(QStringLiteral("pageToken=3&maxResults=150&prettyPrint=false"), 200, "last")}
+                                         << 4;
+
+        QTest::newRow("adaptive default") << 0 << true << 0 << Scenarios{page(QStringLiteral("maxResults=100&prettyPrint=false"), 200, "last")} << 1;
+
+        QTest::newRow("adaptive timeout") << 40 << true << 100
+                                          << Scenarios{page(QStringLiteral("maxResults=40&prettyPrint=false"), 504, {}),
+                                                       page(QStringLiteral("maxResults=20&prettyPrint=false"), 200, "more"),
+                                                       page(QStringLiteral("pageToken=1&maxResults=40&prettyPrint=false"), 200, "last")}
+                                          << 2;
+
+        // No HTTP status, the transfer timeout of the page has expired
+        auto timedOut = page(QStringLiteral("maxResults=40&prettyPrint=false"), 0, {});
+        timedOut.networkError = QNetworkReply::TimeoutError;
+        QTest::newRow("adaptive transfer timeout") << 40 << true << 100
+                                                   << Scenarios{timedOut,
+                                                                page(QStringLiteral("maxResults=20&prettyPrint=false"), 200, "more"),
+                                                                page(QStringLiteral("pageToken=1&maxResults=40&prettyPrint=false"), 200, "last")}
+                                                   << 2;
+    }
+
+    void testPageSize()
+    {
+        QFETCH(int, pageSize);
+        QFETCH(bool, adaptive);
+        QFETCH(int, maximumPageSize);
+        QFETCH(QList<FakeNetworkAccessManager::Scenario>, scenarios);
+        QFETCH(int, pages);
+
+        FakeNetworkAccessManagerFactory::get()->setScenarios(scenarios);
+
+        auto job = new PagedTestFetchJob(QUrl(QStringLiteral("https://example.test/request/data")), maximumPageSize);
+        job->setPageSize(pageSize);
+        job->setAdaptivePageSize(adaptive);
+        // Don't let a slow test machine shrink the pages
+        job->setTargetPageLatency(60 * 1000);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->pages(), pages);
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testAdaptivePageSizeShrinksLargePages()
+    {
+        const QByteArray largePage = "more" + QByteArray(2048, 'x');
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {{QUrl(QStringLiteral("https://example.test/request/data?maxResults=80&prettyPrint=false")),
+              QNetworkAccessManager::GetOperation,
+              {},
+              200,
+              "more",
+              false},
+             {QUrl(QStringLiteral("https://example.test/request/data?pageToken=1&maxResults=160&prettyPrint=false")),
+              QNetworkAccessManager::GetOperation,
+              {},
+              200,
+              largePage,
+              false},
+             {QUrl(QStringLiteral("https://example.test/request/data?pageToken=2&maxResults=80&prettyPrint=false")),
+              QNetworkAccessManager::GetOperation,
+              {},
+              200,
+              "last",
+              false}});
+
+        auto job = new PagedTestFetchJob(QUrl(QStringLiteral("https://example.test/request/data")), 0);
+        job->setPageSize(80);
+        job->setAdaptivePageSize(true);
+        job->setTargetPageLatency(60 * 1000);
+        job->setTargetPageBytes(1024);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
 };
 
 QTEST_GUILESS_MAIN(FetchJobTest)
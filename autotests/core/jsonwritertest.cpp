@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QObject>
+#include <QTest>
+
+#include "private/jsonwriter_p.h"
+
+using namespace KGAPI2;
+
+class JsonWriterTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void testStructure()
+    {
+        JsonWriter writer;
+        writer.beginObject();
+        writer.insert("string", QStringLiteral("value"));
+        writer.insert("int", 42);
+        writer.insert("int64", Q_INT64_C(9007199254740991));
+        writer.insert("double", 1.5);
+        writer.insert("bool", true);
+        writer.insertNull("null");
+        writer.beginArray("array");
+        writer.value(1).value("two");
+        writer.beginObject().endObject();
+        writer.beginArray().endArray();
+        writer.endArray();
+        writer.beginObject("object");
+        writer.insert("nested", false);
+        writer.endObject();
+        writer.endObject();
+
+        QCOMPARE(writer.data(),
+                 QByteArray(R"({"string":"value","int":42,"int64":9007199254740991,"double":1.5,"bool":true,"null":null,)"
+                            R"("array":[1,"two",{},[]],"object":{"nested":false}})"));
+    }
+
+    void testEscaping_data()
+    {
+        QTest::addColumn<QString>("string");
+
+        QTest::newRow("plain") << QStringLiteral("Hello World");
+        QTest::newRow("quotes") << QStringLiteral("\"quoted\" \\ backslash /");
+        QTest::newRow("control") << QStringLiteral("line\nbreak\ttab\r\b\f") + QChar(0x01) + QChar(0x1f);
+        QTest::newRow("unicode") << QStringLiteral("Příliš žluťoučký kůň 日本語");
+        QTest::newRow("surrogates") << QStringLiteral("emoji \U0001F600 end");
+    }
+
+    void testEscaping()
+    {
+        QFETCH(QString, string);
+
+        JsonWriter writer;
+        writer.beginObject();
+        writer.insert("key", string);
+        writer.insert("latin1", QLatin1StringView("caf\xe9"));
+        writer.endObject();
+
+        QJsonParseError error;
+        const auto document = QJsonDocument::fromJson(writer.data(), &error);
+        QCOMPARE(error.error, QJsonParseError::NoError);
+        QCOMPARE(document.object().value(QLatin1StringView("key")).toString(), string);
+        QCOMPARE(document.object().value(QLatin1StringView("latin1")).toString(), QStringLiteral("café"));
+    }
+};
+
+QTEST_GUILESS_MAIN(JsonWriterTest)
+
+#include "jsonwritertest.moc"
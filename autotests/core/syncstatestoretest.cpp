@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "syncstatestore.h"
+
+using namespace KGAPI2;
+
+class SyncStateStoreTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void testMemoryStore()
+    {
+        MemorySyncStateStore store;
+        QVERIFY(store.load(QStringLiteral("account/calendar")).isEmpty());
+
+        QVERIFY(store.commit(QStringLiteral("account/calendar"), QStringLiteral("Token1")));
+        QVERIFY(store.commit(QStringLiteral("account/tasks"), QStringLiteral("1522627200")));
+        QCOMPARE(store.load(QStringLiteral("account/calendar")), QStringLiteral("Token1"));
+
+        QVERIFY(store.commit(QStringLiteral("account/calendar"), QStringLiteral("Token2")));
+        QCOMPARE(store.load(QStringLiteral("account/calendar")), QStringLiteral("Token2"));
+
+        QVERIFY(store.remove(QStringLiteral("account/calendar")));
+        QVERIFY(store.load(QStringLiteral("account/calendar")).isEmpty());
+        QCOMPARE(store.load(QStringLiteral("account/tasks")), QStringLiteral("1522627200"));
+    }
+
+    void testFileStore()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString fileName = dir.filePath(QStringLiteral("state/sync.json"));
+
+        {
+            FileSyncStateStore store(fileName);
+            QVERIFY(store.load(QStringLiteral("account/calendar")).isEmpty());
+            QVERIFY(!QFile::exists(fileName));
+
+            QVERIFY2(store.commit(QStringLiteral("account/calendar"), QStringLiteral("Token1")), qPrintable(store.errorString()));
+            QVERIFY(store.commit(QStringLiteral("account/contacts"), QStringLiteral("Token2")));
+            QVERIFY(QFile::exists(fileName));
+        }
+
+        // Simulates restart of the application
+        {
+            FileSyncStateStore store(fileName);
+            QCOMPARE(store.load(QStringLiteral("account/calendar")), QStringLiteral("Token1"));
+            QCOMPARE(store.load(QStringLiteral("account/contacts")), QStringLiteral("Token2"));
+            QVERIFY(store.remove(QStringLiteral("account/contacts")));
+        }
+
+        FileSyncStateStore store(fileName);
+        QCOMPARE(store.load(QStringLiteral("account/calendar")), QStringLiteral("Token1"));
+        QVERIFY(store.load(QStringLiteral("account/contacts")).isEmpty());
+    }
+
+    void testCorruptedFile()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString fileName = dir.filePath(QStringLiteral("sync.json"));
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("{\"account/calendar\": \"Tok");
+        file.close();
+
+        // A broken file results in a full sync, but is never overwritten
+        FileSyncStateStore store(fileName);
+        QVERIFY(store.load(QStringLiteral("account/calendar")).isEmpty());
+        QVERIFY(!store.errorString().isEmpty());
+        QVERIFY(!store.commit(QStringLiteral("account/calendar"), QStringLiteral("Token1")));
+        QVERIFY(!store.remove(QStringLiteral("account/calendar")));
+        QVERIFY(file.open(QIODevice::ReadOnly));
+        QCOMPARE(file.readAll(), QByteArray("{\"account/calendar\": \"Tok"));
+        file.close();
+
+        // The application starts over by removing the file
+        QVERIFY(QFile::remove(fileName));
+        QVERIFY(store.commit(QStringLiteral("account/calendar"), QStringLiteral("Token1")));
+
+        FileSyncStateStore reopened(fileName);
+        QCOMPARE(reopened.load(QStringLiteral("account/calendar")), QStringLiteral("Token1"));
+    }
+
+    void testUnreadableFile()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        // A directory exists, but can't be opened as a file
+        const QString fileName = dir.filePath(QStringLiteral("sync.json"));
+        QVERIFY(QDir(dir.path()).mkdir(QStringLiteral("sync.json")));
+
+        FileSyncStateStore store(fileName);
+        QVERIFY(store.load(QStringLiteral("account/calendar")).isEmpty());
+        QVERIFY(!store.errorString().isEmpty());
+        QVERIFY(!store.commit(QStringLiteral("account/calendar"), QStringLiteral("Token1")));
+        QVERIFY(QFileInfo(fileName).isDir());
+    }
+};
+
+QTEST_GUILESS_MAIN(SyncStateStoreTest)
+
+#include "syncstatestoretest.moc"
@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QHostAddress>
+#include <QObject>
+#include <QSignalSpy>
+#include <QTcpSocket>
+#include <QTest>
+
+#include "push/channel.h"
+#include "push/webhookreceiver.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+class WebhookReceiverTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    // Stands in for Google, sends a notification and returns the status code of the response
+    int sendNotification(quint16 port, const QByteArray &method, const QList<QPair<QByteArray, QByteArray>> &headers, const QByteArray &body = {})
+    {
+        QTcpSocket socket;
+        socket.connectToHost(QHostAddress::LocalHost, port);
+        if (!socket.waitForConnected()) {
+            return -1;
+        }
+
+        QByteArray request = method + " /notifications HTTP/1.1\r\nHost: localhost\r\n";
+        for (const auto &header : headers) {
+            request += header.first + ": " + header.second + "\r\n";
+        }
+        request += "Content-Length: " + QByteArray::number(body.size()) + "\r\n\r\n" + body;
+        socket.write(request);
+
+        QByteArray response;
+        while (!response.contains("\r\n\r\n")) {
+            // The receiver lives in this thread, let it process the request
+            if (!QTest::qWaitFor([&socket]() {
+                    return socket.bytesAvailable() > 0;
+                })) {
+                return -1;
+            }
+            response += socket.readAll();
+        }
+        return response.split(' ').value(1).toInt();
+    }
+
+    QList<QPair<QByteArray, QByteArray>> notificationHeaders(const QByteArray &token, const QByteArray &state, const QByteArray &messageNumber)
+    {
+        return {{"X-Goog-Channel-ID", "MockChannel"},
+                {"X-Goog-Channel-Token", token},
+                {"X-Goog-Resource-ID", "MockResourceId"},
+                {"X-Goog-Resource-URI", "https://www.googleapis.com/calendar/v3/calendars/MockAccount/events?alt=json"},
+                {"X-Goog-Resource-State", state},
+                {"X-Goog-Message-Number", messageNumber}};
+    }
+
+private Q_SLOTS:
+    void testNotifications()
+    {
+        WebhookReceiver receiver;
+        QVERIFY2(receiver.listen(), qPrintable(receiver.errorString()));
+
+        auto channel = ChannelPtr::create(QStringLiteral("MockChannel"), QUrl(QStringLiteral("https://push.kde.test/notifications")), QStringLiteral("Secret"));
+        channel->setResourceId(QStringLiteral("MockResourceId"));
+        receiver.addChannel(channel);
+
+        QSignalSpy notificationSpy(&receiver, &WebhookReceiver::notificationReceived);
+        QSignalSpy changedSpy(&receiver, &WebhookReceiver::resourceChanged);
+
+        // Initial sync message
+        QCOMPARE(sendNotification(receiver.serverPort(), "POST", notificationHeaders("Secret", "sync", "1")), 200);
+        QCOMPARE(notificationSpy.count(), 1);
+        QCOMPARE(notificationSpy.at(0).at(1).toString(), QStringLiteral("sync"));
+        QCOMPARE(notificationSpy.at(0).at(2).toLongLong(), 1);
+        QCOMPARE(changedSpy.count(), 0);
+
+        // Actual change, with a body that should be consumed
+        QCOMPARE(sendNotification(receiver.serverPort(), "POST", notificationHeaders("Secret", "exists", "2"), "{}"), 200);
+        QCOMPARE(notificationSpy.count(), 2);
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(changedSpy.at(0).at(0).value<ChannelPtr>(), channel);
+    }
+
+    void testRejected()
+    {
+        WebhookReceiver receiver;
+        QVERIFY2(receiver.listen(), qPrintable(receiver.errorString()));
+
+        auto channel = ChannelPtr::create(QStringLiteral("MockChannel"), QUrl(QStringLiteral("https://push.kde.test/notifications")), QStringLiteral("Secret"));
+        channel->setResourceId(QStringLiteral("MockResourceId"));
+        receiver.addChannel(channel);
+
+        QSignalSpy notificationSpy(&receiver, &WebhookReceiver::notificationReceived);
+
+        QCOMPARE(sendNotification(receiver.serverPort(), "POST", notificationHeaders("Wrong", "exists", "2")), 403);
+        QCOMPARE(sendNotification(receiver.serverPort(), "POST", notificationHeaders("Secreu", "exists", "2")), 403);
+        QCOMPARE(sendNotification(receiver.serverPort(), "POST", notificationHeaders("Secret2", "exists", "2")), 403);
+        QCOMPARE(sendNotification(receiver.serverPort(), "GET", notificationHeaders("Secret", "exists", "2")), 405);
+
+        auto headers = notificationHeaders("Secret", "exists", "2");
+        headers[2].second = "OtherResourceId";
+        QCOMPARE(sendNotification(receiver.serverPort(), "POST", headers), 403);
+
+        receiver.removeChannel(channel->id());
+        QCOMPARE(sendNotification(receiver.serverPort(), "POST", notificationHeaders("Secret", "exists", "2")), 404);
+
+        QCOMPARE(notificationSpy.count(), 0);
+    }
+
+    void testIdleConnection()
+    {
+        WebhookReceiver receiver;
+        receiver.setRequestTimeout(100);
+        QVERIFY2(receiver.listen(), qPrintable(receiver.errorString()));
+
+        // Never finishes the request
+        QTcpSocket socket;
+        socket.connectToHost(QHostAddress::LocalHost, receiver.serverPort());
+        QVERIFY(socket.waitForConnected());
+        socket.write("POST /notifications HTTP/1.1\r\nHost: localhost\r\n");
+        QTRY_COMPARE(socket.state(), QAbstractSocket::UnconnectedState);
+    }
+
+    void testMaxConnections()
+    {
+        WebhookReceiver receiver;
+        receiver.setMaxConnections(1);
+        QVERIFY2(receiver.listen(), qPrintable(receiver.errorString()));
+
+        auto channel = ChannelPtr::create(QStringLiteral("MockChannel"), QUrl(QStringLiteral("https://push.kde.test/notifications")), QStringLiteral("Secret"));
+        receiver.addChannel(channel);
+
+        QTcpSocket idle;
+        idle.connectToHost(QHostAddress::LocalHost, receiver.serverPort());
+        QVERIFY(idle.waitForConnected());
+        QTest::qWait(50);
+
+        // Waits until the idle connection is closed
+        QTcpSocket socket;
+        socket.connectToHost(QHostAddress::LocalHost, receiver.serverPort());
+        QVERIFY(socket.waitForConnected());
+        QByteArray request = "POST /notifications HTTP/1.1\r\nHost: localhost\r\n";
+        for (const auto &header : notificationHeaders("Secret", "exists", "1")) {
+            request += header.first + ": " + header.second + "\r\n";
+        }
+        socket.write(request + "Content-Length: 0\r\n\r\n");
+        QTest::qWait(200);
+        QCOMPARE(socket.bytesAvailable(), 0LL);
+
+        idle.disconnectFromHost();
+        QTRY_VERIFY(socket.bytesAvailable() > 0);
+        QVERIFY(socket.readAll().startsWith("HTTP/1.1 200 "));
+    }
+};
+
+QTEST_GUILESS_MAIN(WebhookReceiverTest)
+
+#include "webhookreceivertest.moc"
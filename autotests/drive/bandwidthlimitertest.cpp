@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QBuffer>
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+#include "account.h"
+#include "bandwidthlimiter.h"
+#include "bandwidthlimiter_p.h"
+
+using namespace KGAPI2;
+using namespace KGAPI2::Drive;
+
+class BandwidthLimiterTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void testSchedule()
+    {
+        BandwidthLimiter limiter;
+        QSignalSpy spy(&limiter, &BandwidthLimiter::rateChanged);
+        limiter.setRate(BandwidthLimiter::Upload, 1000);
+        // Over midnight
+        limiter.addSchedule(QTime(22, 0), QTime(6, 0), BandwidthLimiter::Upload, 5000);
+        limiter.addSchedule(QTime(12, 0), QTime(13, 0), BandwidthLimiter::Upload, 0);
+        QCOMPARE(spy.count(), 3);
+
+        QCOMPARE(limiter.effectiveRate(BandwidthLimiter::Upload, QTime(10, 0)), qint64(1000));
+        QCOMPARE(limiter.effectiveRate(BandwidthLimiter::Upload, QTime(22, 0)), qint64(5000));
+        QCOMPARE(limiter.effectiveRate(BandwidthLimiter::Upload, QTime(3, 0)), qint64(5000));
+        QCOMPARE(limiter.effectiveRate(BandwidthLimiter::Upload, QTime(6, 0)), qint64(1000));
+        QCOMPARE(limiter.effectiveRate(BandwidthLimiter::Upload, QTime(12, 30)), qint64(0));
+        QCOMPARE(limiter.effectiveRate(BandwidthLimiter::Download, QTime(23, 0)), qint64(0));
+
+        limiter.clearSchedule();
+        QCOMPARE(limiter.effectiveRate(BandwidthLimiter::Upload, QTime(23, 0)), qint64(1000));
+    }
+
+    void testTake()
+    {
+        BandwidthLimiter limiter;
+        QVERIFY(!limiter.isLimited(BandwidthLimiter::Upload));
+        QCOMPARE(limiter.take(BandwidthLimiter::Upload, 1000000), qint64(1000000));
+
+        // The bucket holds at least 4 KiB
+        limiter.setRate(BandwidthLimiter::Upload, 1000);
+        QVERIFY(limiter.isLimited(BandwidthLimiter::Upload));
+        QVERIFY(!limiter.isLimited(BandwidthLimiter::Download));
+        QCOMPARE(limiter.take(BandwidthLimiter::Upload, 1000000), qint64(4096));
+        QVERIFY(limiter.take(BandwidthLimiter::Upload, 1000) < 1000);
+        QCOMPARE(limiter.delay(BandwidthLimiter::Upload, 4096), 1000);
+        QCOMPARE(limiter.take(BandwidthLimiter::Download, 1000000), qint64(1000000));
+
+        // Applies immediately
+        limiter.setRate(BandwidthLimiter::Upload, 0);
+        QCOMPARE(limiter.take(BandwidthLimiter::Upload, 1000000), qint64(1000000));
+        QVERIFY(limiter.throughput(BandwidthLimiter::Upload) >= 0);
+    }
+
+    void testParentLimiter()
+    {
+        BandwidthLimiter parent;
+        parent.setRate(BandwidthLimiter::Download, 1000);
+        BandwidthLimiter child;
+        child.setParentLimiter(&parent);
+        QVERIFY(child.isLimited(BandwidthLimiter::Download));
+
+        QCOMPARE(child.take(BandwidthLimiter::Download, 3000), qint64(3000));
+        QVERIFY(child.take(BandwidthLimiter::Download, 3000) < 3000);
+        QVERIFY(parent.take(BandwidthLimiter::Download, 1000) < 1000);
+
+        // Cycles are refused
+        parent.setParentLimiter(&child);
+        QVERIFY(!parent.parentLimiter());
+    }
+
+    void testForAccount()
+    {
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto otherAccount = AccountPtr::create(QStringLiteral("OtherAccount"), QStringLiteral("MockToken"));
+
+        BandwidthLimiter *limiter = BandwidthLimiter::forAccount(account);
+        QVERIFY(limiter != BandwidthLimiter::global());
+        QCOMPARE(limiter->parentLimiter(), BandwidthLimiter::global());
+        QCOMPARE(BandwidthLimiter::forAccount(account), limiter);
+        QVERIFY(BandwidthLimiter::forAccount(otherAccount) != limiter);
+        QCOMPARE(BandwidthLimiter::forAccount({}), BandwidthLimiter::global());
+    }
+
+    void testThrottledDevice()
+    {
+        QByteArray content(10000, 'x');
+        auto buffer = new QBuffer;
+        buffer->setData(content);
+        QVERIFY(buffer->open(QIODevice::ReadOnly));
+
+        BandwidthLimiter limiter;
+        limiter.setRate(BandwidthLimiter::Upload, 4096);
+        ThrottledDevice device(&limiter, BandwidthLimiter::Upload);
+        device.append("head");
+        device.append(buffer);
+        device.append("tail");
+        QVERIFY(device.open(QIODevice::ReadOnly));
+        QVERIFY(!device.isSequential());
+        QCOMPARE(device.size(), qint64(10008));
+
+        // A burst of the bucket, then nothing until the limiter refills it
+        QSignalSpy spy(&device, &QIODevice::readyRead);
+        QByteArray read = device.read(device.size());
+        QCOMPARE(read.size(), 4096);
+        QVERIFY(read.startsWith("headx"));
+        while (!device.atEnd()) {
+            const QByteArray chunk = device.read(device.size());
+            if (chunk.isEmpty()) {
+                QVERIFY(spy.wait(2000));
+            }
+            read += chunk;
+        }
+        QVERIFY(!spy.isEmpty());
+        QCOMPARE(read, "head" + content + "tail");
+
+        // Seeking back reads the parts again, e.g. when the request is resent
+        limiter.setRate(BandwidthLimiter::Upload, 0);
+        QVERIFY(device.seek(2));
+        QCOMPARE(device.readAll(), "ad" + content + "tail");
+    }
+};
+
+QTEST_GUILESS_MAIN(BandwidthLimiterTest)
+
+#include "bandwidthlimitertest.moc"
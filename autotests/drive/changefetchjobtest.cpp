@@ -6,6 +6,7 @@
 
 #include <QObject>
 #include <QTest>
+#include <QUrlQuery>
 
 #include "drivetestutils.h"
 #include "fakenetworkaccessmanagerfactory.h"
@@ -14,10 +15,24 @@
 #include "account.h"
 #include "change.h"
 #include "changefetchjob.h"
+#include "changestartpagetokenfetchjob.h"
+#include "syncstatestore.h"
 #include "types.h"
 
 using namespace KGAPI2;
 
+namespace
+{
+FakeNetworkAccessManager::Scenario changesScenario(const QList<QPair<QString, QString>> &queryItems, const QByteArray &response)
+{
+    QUrl url(QStringLiteral("https://www.googleapis.com/drive/v2/changes"));
+    QUrlQuery query;
+    query.setQueryItems(queryItems);
+    url.setQuery(query);
+    return FakeNetworkAccessManager::Scenario(url, QNetworkAccessManager::GetOperation, {}, KGAPI2::OK, response);
+}
+} // namespace
+
 Q_DECLARE_METATYPE(QList<FakeNetworkAccessManager::Scenario>)
 Q_DECLARE_METATYPE(KGAPI2::Drive::ChangesList)
 
@@ -67,6 +82,75 @@ private Q_SLOTS:
         QVERIFY(returnedChange);
         QCOMPARE(*returnedChange, *change);
     }
+
+    void testFetchStartPageToken()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {FakeNetworkAccessManager::Scenario(QUrl(QStringLiteral("https://www.googleapis.com/drive/v2/changes/startPageToken?supportsAllDrives=true&prettyPrint=false")),
+                                                QNetworkAccessManager::GetOperation,
+                                                {},
+                                                KGAPI2::OK,
+                                                R"({"kind": "drive#startPageToken", "startPageToken": "100"})")});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::ChangeStartPageTokenFetchJob(account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->startPageToken(), QStringLiteral("100"));
+    }
+
+    void testFetchFromPageToken()
+    {
+        const QString fields = QStringLiteral("kind,nextPageToken,newStartPageToken,largestChangeId,items(fileId,deleted,kind)");
+        const QList<QPair<QString, QString>> baseQuery = {{QStringLiteral("includeDeleted"), QStringLiteral("true")},
+                                                          {QStringLiteral("includeSubscribed"), QStringLiteral("true")}};
+        const QList<QPair<QString, QString>> drivesQuery = {{QStringLiteral("includeItemsFromAllDrives"), QStringLiteral("true")},
+                                                            {QStringLiteral("supportsAllDrives"), QStringLiteral("true")}};
+        const QPair<QString, QString> prettyPrint = {QStringLiteral("prettyPrint"), QStringLiteral("false")};
+
+        FakeNetworkAccessManagerFactory::get()->setScenarios({
+            changesScenario(baseQuery + QList<QPair<QString, QString>>{{QStringLiteral("pageToken"), QStringLiteral("100")}} + drivesQuery
+                                + QList<QPair<QString, QString>>{{QStringLiteral("fields"), fields}, prettyPrint},
+                            R"({"kind": "drive#changeList", "nextPageToken": "101", "items": [{"kind": "drive#change", "fileId": "file1", "deleted": true}]})"),
+            // The next page is requested from the token when the next link is not fetched
+            changesScenario(baseQuery + drivesQuery
+                                + QList<QPair<QString, QString>>{prettyPrint, {QStringLiteral("pageToken"), QStringLiteral("101")}, {QStringLiteral("fields"), fields}},
+                            R"({"kind": "drive#changeList", "newStartPageToken": "150", "largestChangeId": "149", "items": [{"kind": "drive#change", "fileId": "file2"}]})"),
+            changesScenario(baseQuery + QList<QPair<QString, QString>>{{QStringLiteral("pageToken"), QStringLiteral("150")}} + drivesQuery
+                                + QList<QPair<QString, QString>>{prettyPrint},
+                            R"({"kind": "drive#changeList", "newStartPageToken": "160", "items": []})"),
+        });
+
+        MemorySyncStateStore store;
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::ChangeFetchJob(account);
+        job->setPageToken(QStringLiteral("100"));
+        job->setFields({Drive::Change::Fields::FileId, Drive::Change::Fields::Deleted});
+        job->setStreaming(true);
+        job->setSyncStateStore(&store, QStringLiteral("changes"));
+        QStringList fileIds;
+        connect(job, &FetchJob::itemsReceived, this, [&fileIds](FetchJob *, const ObjectsList &items) {
+            QCOMPARE(items.count(), 1);
+            fileIds << items.at(0).dynamicCast<Drive::Change>()->fileId();
+        });
+        QVERIFY(execJob(job));
+        QCOMPARE(fileIds, (QStringList{QStringLiteral("file1"), QStringLiteral("file2")}));
+        QVERIFY(job->items().isEmpty());
+        QCOMPARE(job->newStartPageToken(), QStringLiteral("150"));
+        QCOMPARE(store.load(QStringLiteral("changes")), QStringLiteral("pageToken:150"));
+
+        // Continues from the stored token
+        job = new Drive::ChangeFetchJob(account);
+        job->setSyncStateStore(&store, QStringLiteral("changes"));
+        QVERIFY(execJob(job));
+        QVERIFY(job->items().isEmpty());
+        QCOMPARE(job->newStartPageToken(), QStringLiteral("160"));
+        QCOMPARE(store.load(QStringLiteral("changes")), QStringLiteral("pageToken:160"));
+        // The stored token is not written to the properties of the job
+        QVERIFY(job->pageToken().isEmpty());
+        QCOMPARE(job->startChangeId(), 0LL);
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
 };
 
 QTEST_GUILESS_MAIN(ChangeFetchJobTest)
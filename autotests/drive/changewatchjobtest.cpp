@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QObject>
+#include <QTest>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "changewatchjob.h"
+#include "push/channel.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+class ChangeWatchJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testWatch()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/changes_watch_request.txt"), QFINDTESTDATA("data/changes_watch_response.txt"))});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto requested =
+            ChannelPtr::create(QStringLiteral("MockChannel"), QUrl(QStringLiteral("https://push.kde.test/notifications")), QStringLiteral("MockChannelToken"));
+        auto job = new Drive::ChangeWatchJob(requested, account);
+        job->setIncludeDeleted(false);
+        job->setStartChangeId(42);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+
+        const auto channel = job->channel();
+        QVERIFY(channel);
+        QCOMPARE(channel->id(), QStringLiteral("MockChannel"));
+        QCOMPARE(channel->resourceId(), QStringLiteral("MockResourceId"));
+        QCOMPARE(channel->expiration().toMSecsSinceEpoch(), Q_INT64_C(1776600000000));
+        // Not repeated in the response
+        QCOMPARE(channel->token(), QStringLiteral("MockChannelToken"));
+        QCOMPARE(channel->address(), requested->address());
+        QCOMPARE(job->items().count(), 1);
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+};
+
+QTEST_GUILESS_MAIN(ChangeWatchJobTest)
+
+#include "changewatchjobtest.moc"
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QObject>
+#include <QTest>
+
+#include "change.h"
+#include "driveindex.h"
+#include "file.h"
+
+using namespace KGAPI2;
+
+namespace
+{
+QString fileJSON(const QString &id, const QString &title, const QString &parentId, bool trashed = false)
+{
+    const bool isRoot = parentId == QLatin1StringView("RootId");
+    return QStringLiteral(R"({"kind": "drive#file", "id": "%1", "title": "%2", "labels": {"trashed": %3},)"
+                          R"( "parents": [{"kind": "drive#parentReference", "id": "%4", "isRoot": %5}]})")
+        .arg(id, title, trashed ? QStringLiteral("true") : QStringLiteral("false"), parentId, isRoot ? QStringLiteral("true") : QStringLiteral("false"));
+}
+
+Drive::FilePtr file(const QString &id, const QString &title, const QString &parentId, bool trashed = false)
+{
+    return Drive::File::fromJSON(fileJSON(id, title, parentId, trashed).toUtf8());
+}
+
+Drive::ChangePtr change(qlonglong id, const QString &fileId, const QString &title, const QString &parentId, bool trashed = false)
+{
+    return Drive::Change::fromJSON(QStringLiteral(R"({"kind": "drive#change", "id": "%1", "fileId": "%2", "deleted": false, "file": %3})")
+                                       .arg(id)
+                                       .arg(fileId, fileJSON(fileId, title, parentId, trashed))
+                                       .toUtf8());
+}
+
+Drive::ChangePtr deletion(qlonglong id, const QString &fileId)
+{
+    return Drive::Change::fromJSON(QStringLiteral(R"({"kind": "drive#change", "id": "%1", "fileId": "%2", "deleted": true})").arg(id).arg(fileId).toUtf8());
+}
+
+QStringList sorted(QStringList list)
+{
+    list.sort();
+    return list;
+}
+} // namespace
+
+class DriveIndexTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void testInitialListing()
+    {
+        Drive::DriveIndex index;
+        index.addFiles({file(QStringLiteral("Documents"), QStringLiteral("Documents"), QStringLiteral("RootId")),
+                        file(QStringLiteral("Report"), QStringLiteral("report.pdf"), QStringLiteral("Documents")),
+                        file(QStringLiteral("Notes"), QStringLiteral("notes.txt"), QStringLiteral("Documents")),
+                        file(QStringLiteral("Old"), QStringLiteral("old.txt"), QStringLiteral("Documents"), true)});
+
+        QCOMPARE(index.count(), 3);
+        QCOMPARE(index.rootFolderId(), QStringLiteral("RootId"));
+        QVERIFY(!index.contains(QStringLiteral("Old")));
+
+        QCOMPARE(sorted(index.childIds(QStringLiteral("Documents"))), (QStringList{QStringLiteral("Notes"), QStringLiteral("Report")}));
+        QCOMPARE(index.children(QStringLiteral("RootId")).size(), 1);
+        QCOMPARE(index.idForPath(QStringLiteral("/Documents/report.pdf")), QStringLiteral("Report"));
+        QCOMPARE(index.idForPath(QStringLiteral("Documents/")), QStringLiteral("Documents"));
+        QCOMPARE(index.idForPath(QStringLiteral("/")), QStringLiteral("RootId"));
+        QVERIFY(index.idForPath(QStringLiteral("/Documents/missing.txt")).isEmpty());
+        QCOMPARE(index.fileForPath(QStringLiteral("/Documents/notes.txt"))->id(), QStringLiteral("Notes"));
+        QCOMPARE(index.path(QStringLiteral("Report")), QStringLiteral("/Documents/report.pdf"));
+    }
+
+    void testApplyChanges()
+    {
+        Drive::DriveIndex index;
+        index.addFiles({file(QStringLiteral("Documents"), QStringLiteral("Documents"), QStringLiteral("RootId")),
+                        file(QStringLiteral("Archive"), QStringLiteral("Archive"), QStringLiteral("RootId")),
+                        file(QStringLiteral("Report"), QStringLiteral("report.pdf"), QStringLiteral("Documents")),
+                        file(QStringLiteral("Notes"), QStringLiteral("notes.txt"), QStringLiteral("Documents"))});
+
+        index.applyChanges({// Renamed and moved
+                            change(10, QStringLiteral("Report"), QStringLiteral("report-2025.pdf"), QStringLiteral("Archive")),
+                            // Trashed
+                            change(11, QStringLiteral("Notes"), QStringLiteral("notes.txt"), QStringLiteral("Documents"), true),
+                            // Created
+                            change(12, QStringLiteral("Plan"), QStringLiteral("plan.odt"), QStringLiteral("Documents")),
+                            // Deleted
+                            deletion(13, QStringLiteral("Plan"))});
+
+        QCOMPARE(index.largestChangeId(), qlonglong(13));
+        QCOMPARE(index.count(), 3);
+        QVERIFY(index.childIds(QStringLiteral("Documents")).isEmpty());
+        QCOMPARE(index.childIds(QStringLiteral("Archive")), QStringList{QStringLiteral("Report")});
+        QVERIFY(index.idForPath(QStringLiteral("/Documents/report.pdf")).isEmpty());
+        QCOMPARE(index.idForPath(QStringLiteral("/Archive/report-2025.pdf")), QStringLiteral("Report"));
+        QCOMPARE(index.path(QStringLiteral("Report")), QStringLiteral("/Archive/report-2025.pdf"));
+
+        // Renaming a folder changes paths of all its children
+        index.applyChanges({change(14, QStringLiteral("Archive"), QStringLiteral("2025"), QStringLiteral("RootId"))});
+        QCOMPARE(index.path(QStringLiteral("Report")), QStringLiteral("/2025/report-2025.pdf"));
+        QCOMPARE(index.idForPath(QStringLiteral("/2025/report-2025.pdf")), QStringLiteral("Report"));
+    }
+};
+
+QTEST_GUILESS_MAIN(DriveIndexTest)
+
+#include "driveindextest.moc"
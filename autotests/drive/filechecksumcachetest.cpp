@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QFile>
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "filechecksumcache.h"
+
+using namespace KGAPI2;
+
+namespace
+{
+bool writeFile(const QString &filePath, const QByteArray &data, const QDateTime &modified)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size()) {
+        return false;
+    }
+    file.close();
+    return file.open(QIODevice::ReadWrite) && file.setFileTime(modified, QFileDevice::FileModificationTime);
+}
+
+QString md5(const QByteArray &data)
+{
+    return QString::fromLatin1(QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex());
+}
+} // namespace
+
+class FileChecksumCacheTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void testComputeChecksum()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString filePath = dir.filePath(QStringLiteral("file.txt"));
+        QVERIFY(writeFile(filePath, "Hello World\n", QDateTime::currentDateTimeUtc()));
+
+        QCOMPARE(Drive::FileChecksumCache::computeChecksum(filePath), md5("Hello World\n"));
+        QVERIFY(Drive::FileChecksumCache::computeChecksum(dir.filePath(QStringLiteral("missing.txt"))).isEmpty());
+    }
+
+    void testCachedChecksum()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString filePath = dir.filePath(QStringLiteral("file.txt"));
+        const QString cachePath = dir.filePath(QStringLiteral("cache/checksums.json"));
+        const auto modified = QDateTime::currentDateTimeUtc().addDays(-1);
+        QVERIFY(writeFile(filePath, "Hello World\n", modified));
+
+        {
+            Drive::FileChecksumCache cache(cachePath);
+            QCOMPARE(cache.checksum(filePath), md5("Hello World\n"));
+            QVERIFY(cache.save());
+        }
+        QVERIFY(QFile::exists(cachePath));
+
+        // Same size and modification time, the cached checksum is used
+        QVERIFY(writeFile(filePath, "Hello Earth\n", modified));
+        {
+            Drive::FileChecksumCache cache(cachePath);
+            QCOMPARE(cache.checksum(filePath), md5("Hello World\n"));
+        }
+
+        // Modified file is read again
+        QVERIFY(writeFile(filePath, "Hello Earth\n", modified.addSecs(60)));
+        {
+            Drive::FileChecksumCache cache(cachePath);
+            QCOMPARE(cache.checksum(filePath), md5("Hello Earth\n"));
+        }
+        {
+            // The new checksum has been saved by the destructor
+            Drive::FileChecksumCache cache(cachePath);
+            QVERIFY(writeFile(filePath, "Hello World\n", modified.addSecs(60)));
+            QCOMPARE(cache.checksum(filePath), md5("Hello Earth\n"));
+
+            cache.clear();
+            QCOMPARE(cache.checksum(filePath), md5("Hello World\n"));
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(FileChecksumCacheTest)
+
+#include "filechecksumcachetest.moc"
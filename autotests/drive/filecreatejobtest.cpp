@@ -18,6 +18,7 @@
  * License along with this library.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <QCryptographicHash>
 #include <QObject>
 #include <QTest>
 
@@ -26,6 +27,7 @@
 #include "testutils.h"
 
 #include "account.h"
+#include "bandwidthlimiter.h"
 #include "file.h"
 #include "filecreatejob.h"
 #include "types.h"
@@ -35,6 +37,26 @@ using namespace KGAPI2;
 Q_DECLARE_METATYPE(QList<FakeNetworkAccessManager::Scenario>)
 Q_DECLARE_METATYPE(KGAPI2::Drive::FilePtr)
 
+namespace
+{
+// The multipart boundary is random, the request data only use it as a placeholder
+FakeNetworkAccessManager::Scenario randomBoundaryScenario(FakeNetworkAccessManager::Scenario scenario)
+{
+    scenario.matchRequestData = false;
+    scenario.requestHeaders.removeIf([](const auto &header) {
+        return header.first == "Content-Type";
+    });
+    return scenario;
+}
+
+QByteArray lastRequestBoundary()
+{
+    const auto contentType = FakeNetworkAccessManagerFactory::get()->lastRequest().rawHeader("Content-Type");
+    const QByteArray prefix = "multipart/related; boundary=";
+    return contentType.startsWith(prefix) ? contentType.mid(prefix.size()) : QByteArray();
+}
+}
+
 class FileCreateJobTest : public QObject
 {
     Q_OBJECT
@@ -50,17 +72,19 @@ private Q_SLOTS:
         QTest::addColumn<Drive::FilePtr>("sourceFile");
         QTest::addColumn<QString>("uploadFilePath");
         QTest::addColumn<Drive::FilePtr>("expectedResult");
+        QTest::addColumn<QByteArray>("boundaryPlaceholder");
 
         QTest::newRow("metadata only") << QList<FakeNetworkAccessManager::Scenario>{scenarioFromFile(QFINDTESTDATA("data/file1_create_request.txt"),
                                                                                                      QFINDTESTDATA("data/file1_create_response.txt"))}
-                                       << fileFromFile(QFINDTESTDATA("data/file1.json")) << QString() << fileFromFile(QFINDTESTDATA("data/file1.json"));
+                                       << fileFromFile(QFINDTESTDATA("data/file1.json")) << QString() << fileFromFile(QFINDTESTDATA("data/file1.json"))
+                                       << QByteArray();
 
         // NOTE: The scenarios are reversed due use of QMap, which orders the files
         // by ID
-        QTest::newRow("upload") << QList<FakeNetworkAccessManager::Scenario>{scenarioFromFile(QFINDTESTDATA("data/file2_create_request.txt"),
-                                                                                              QFINDTESTDATA("data/file2_create_response.txt"))}
+        QTest::newRow("upload") << QList<FakeNetworkAccessManager::Scenario>{randomBoundaryScenario(
+            scenarioFromFile(QFINDTESTDATA("data/file2_create_request.txt"), QFINDTESTDATA("data/file2_create_response.txt")))}
                                 << fileFromFile(QFINDTESTDATA("data/file2.json")) << QFINDTESTDATA("data/DSC_1287.JPG")
-                                << fileFromFile(QFINDTESTDATA("data/file2.json"));
+                                << fileFromFile(QFINDTESTDATA("data/file2.json")) << QByteArray("c585ba247f6135ca1b86d3f82a13757e");
     }
 
     void testCreate()
@@ -69,6 +93,7 @@ private Q_SLOTS:
         QFETCH(Drive::FilePtr, sourceFile);
         QFETCH(QString, uploadFilePath);
         QFETCH(Drive::FilePtr, expectedResult);
+        QFETCH(QByteArray, boundaryPlaceholder);
 
         FakeNetworkAccessManagerFactory::get()->setScenarios(scenarios);
 
@@ -85,6 +110,62 @@ private Q_SLOTS:
         QCOMPARE(items.count(), 1);
         QVERIFY(*items.cbegin());
         QCOMPARE(**items.cbegin(), *expectedResult);
+
+        if (!boundaryPlaceholder.isEmpty()) {
+            const QByteArray boundary = lastRequestBoundary();
+            QVERIFY(!boundary.isEmpty());
+            QVERIFY(boundary != boundaryPlaceholder);
+            QCOMPARE(FakeNetworkAccessManagerFactory::get()->lastRequestData(), QByteArray(scenarios.first().requestData).replace(boundaryPlaceholder, boundary));
+        }
+    }
+
+    void testRandomBoundary()
+    {
+        const QString uploadFilePath = QFINDTESTDATA("data/DSC_1287.JPG");
+        const auto scenario =
+            randomBoundaryScenario(scenarioFromFile(QFINDTESTDATA("data/file2_create_request.txt"), QFINDTESTDATA("data/file2_create_response.txt")));
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+
+        QList<QByteArray> boundaries;
+        for (int i = 0; i < 2; ++i) {
+            FakeNetworkAccessManagerFactory::get()->setScenarios({scenario});
+            auto job = new Drive::FileCreateJob(uploadFilePath, fileFromFile(QFINDTESTDATA("data/file2.json")), account);
+            QVERIFY(execJob(job));
+            boundaries << lastRequestBoundary();
+        }
+
+        // Not derived from the file name, so uploads of files with the same
+        // name don't share it
+        const QByteArray nameHash = QCryptographicHash::hash(QByteArrayLiteral("DSC_1287.JPG"), QCryptographicHash::Md5).toHex();
+        QVERIFY(!boundaries[0].isEmpty());
+        QVERIFY(boundaries[0] != nameHash);
+        QVERIFY(boundaries[1] != nameHash);
+        QVERIFY(boundaries[0] != boundaries[1]);
+    }
+
+    void testThrottledUpload()
+    {
+        const auto scenario =
+            randomBoundaryScenario(scenarioFromFile(QFINDTESTDATA("data/file2_create_request.txt"), QFINDTESTDATA("data/file2_create_response.txt")));
+        FakeNetworkAccessManagerFactory::get()->setScenarios({scenario});
+
+        // The whole request fits into the first burst
+        Drive::BandwidthLimiter limiter;
+        limiter.setRate(Drive::BandwidthLimiter::Upload, 1024 * 1024);
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileCreateJob(QFINDTESTDATA("data/DSC_1287.JPG"), fileFromFile(QFINDTESTDATA("data/file2.json")), account);
+        job->setBandwidthLimiter(&limiter);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->files().count(), 1);
+
+        // Same multipart body as without the limiter
+        const QByteArray boundary = lastRequestBoundary();
+        QVERIFY(!boundary.isEmpty());
+        const QByteArray data = FakeNetworkAccessManagerFactory::get()->lastRequestData();
+        QCOMPARE(data, QByteArray(scenario.requestData).replace("c585ba247f6135ca1b86d3f82a13757e", boundary));
+        QCOMPARE(FakeNetworkAccessManagerFactory::get()->lastRequest().header(QNetworkRequest::ContentLengthHeader).toLongLong(), qint64(data.size()));
     }
 };
 
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QObject>
+#include <QTest>
+
+#include "testutils.h"
+
+#include "file.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+namespace
+{
+// Maximum number of items in a page of files.list
+constexpr int PageSize = 1000;
+// Pages parsed by the benchmark, i.e. a listing of 100k files
+constexpr int PageCount = 100;
+
+QByteArray readFile(const QString &path)
+{
+    QFile file(path);
+    VERIFY_RET(file.open(QIODevice::ReadOnly), {});
+    return file.readAll();
+}
+
+QByteArray filesPage(const QByteArray &item)
+{
+    QByteArray page = R"({"kind": "drive#fileList", "items": [)";
+    page.reserve(PageSize * (item.size() + 2) + 64);
+    for (int i = 0; i < PageSize; ++i) {
+        if (i > 0) {
+            page += ',';
+        }
+        page += QByteArray(item).replace("abcdefghijklmnopqrstuvwxyz", "file" + QByteArray::number(i));
+    }
+    page += "]}";
+    return page;
+}
+} // namespace
+
+class FileDecodingBenchmark : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void benchmarkFeed_data()
+    {
+        QTest::addColumn<bool>("allFields");
+
+        QTest::newRow("basic fields") << false;
+        QTest::newRow("all fields") << true;
+    }
+
+    void benchmarkFeed()
+    {
+        QFETCH(bool, allFields);
+
+        const QByteArray page = filesPage(QJsonDocument::fromJson(readFile(QFINDTESTDATA("data/file1.json"))).toJson(QJsonDocument::Compact));
+        QBENCHMARK {
+            int count = 0;
+            for (int i = 0; i < PageCount; ++i) {
+                FeedData feedData;
+                const auto files = Drive::File::fromJSONFeed(page, feedData);
+                for (const auto &file : files) {
+                    // What a sync client typically looks at
+                    count += file->id().size() + file->title().size() + file->mimeType().size() + file->md5Checksum().size() + file->parents().size();
+                    if (allFields) {
+                        count += file->labels()->trashed() + file->exportLinks().size() + file->owners().size() + (file->lastModifyingUser() ? 1 : 0);
+                    }
+                }
+            }
+            QVERIFY(count > 0);
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(FileDecodingBenchmark)
+
+#include "filedecodingbenchmark.moc"
@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QObject>
+#include <QTest>
+
+#include "drivetestutils.h"
+#include "testutils.h"
+
+#include "file.h"
+#include "parentreference.h"
+#include "user.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+namespace
+{
+QByteArray readFile(const QString &path)
+{
+    QFile file(path);
+    VERIFY_RET(file.open(QIODevice::ReadOnly), {});
+    return file.readAll();
+}
+
+QByteArray filesPage(const QByteArray &item, int count)
+{
+    QByteArray page = R"({"kind": "drive#fileList", "items": [)";
+    for (int i = 0; i < count; ++i) {
+        if (i > 0) {
+            page += ',';
+        }
+        page += QByteArray(item).replace("abcdefghijklmnopqrstuvwxyz", "file" + QByteArray::number(i));
+    }
+    page += "]}";
+    return page;
+}
+} // namespace
+
+class FileDecodingTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void testLazyDecoding()
+    {
+        const QByteArray data = readFile(QFINDTESTDATA("data/file1.json"));
+        const auto file = Drive::File::fromJSON(data);
+        QVERIFY(file);
+        QCOMPARE(file->id(), QStringLiteral("abcdefghijklmnopqrstuvwxyz"));
+        QCOMPARE(file->parents().size(), 1);
+        QCOMPARE(file->parents().constFirst()->id(), QStringLiteral("zyxwvutsrqponmlkjihgfedcba"));
+
+        QVERIFY(file->labels());
+        QVERIFY(!file->labels()->trashed());
+        QCOMPARE(file->exportLinks().size(), 7);
+        QCOMPARE(file->owners().size(), 1);
+        QCOMPARE(file->owners().constFirst()->displayName(), QStringLiteral("Konqui Dev"));
+        QCOMPARE(file->lastModifyingUser()->displayName(), QStringLiteral("John Doe"));
+        QVERIFY(file->userPermission());
+
+        // Copies of a partially decoded file decode the rest on their own
+        const auto other = Drive::File::fromJSON(QJsonDocument::fromJson(data).toVariant().toMap());
+        QVERIFY(other);
+        const Drive::File copy(*other);
+        QCOMPARE(copy, *file);
+        QCOMPARE(*other, *file);
+    }
+
+    void testSetterBeforeDecoding()
+    {
+        const auto file = Drive::File::fromJSON(readFile(QFINDTESTDATA("data/file1.json")));
+        QVERIFY(file);
+
+        Drive::File::LabelsPtr labels(new Drive::File::Labels);
+        labels->setStarred(true);
+        file->setLabels(labels);
+        QCOMPARE(file->labels(), labels);
+        QVERIFY(file->labels()->starred());
+    }
+
+    void testFeedDecoding()
+    {
+        const QByteArray item = QJsonDocument::fromJson(readFile(QFINDTESTDATA("data/file1.json"))).toJson(QJsonDocument::Compact);
+        FeedData feedData;
+        const auto files = Drive::File::fromJSONFeed(filesPage(item, 3), feedData);
+        QCOMPARE(files.size(), 3);
+
+        // Files of a feed with only some of the fields decoded equal a file
+        // that the comparison decodes as a whole
+        for (int i = 0; i < files.size(); ++i) {
+            const auto &file = files.at(i);
+            QCOMPARE(file->id(), QStringLiteral("file%1").arg(i));
+            QCOMPARE(file->owners().size(), 1);
+            const auto eager = Drive::File::fromJSON(QByteArray(item).replace("abcdefghijklmnopqrstuvwxyz", "file" + QByteArray::number(i)));
+            QVERIFY(eager);
+            QCOMPARE(*file, *eager);
+            QCOMPARE(Drive::File::toJSON(file), Drive::File::toJSON(eager));
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(FileDecodingTest)
+
+#include "filedecodingtest.moc"
@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QObject>
+#include <QTest>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "filedeletejob.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+class FileDeleteJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testDelete()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios({
+            FakeNetworkAccessManager::Scenario(QUrl(QStringLiteral("https://www.googleapis.com/drive/v2/files/file1")),
+                                               QNetworkAccessManager::DeleteOperation,
+                                               {},
+                                               KGAPI2::NoContent,
+                                               {}),
+            FakeNetworkAccessManager::Scenario(QUrl(QStringLiteral("https://www.googleapis.com/drive/v2/files/file2")),
+                                               QNetworkAccessManager::DeleteOperation,
+                                               {},
+                                               KGAPI2::NoContent,
+                                               {}),
+        });
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileDeleteJob(QStringList{QStringLiteral("file1"), QStringLiteral("file2")}, account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->itemResults().count(), 2);
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testBatchDelete()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {scenarioFromFile(QFINDTESTDATA("data/files_batch_delete_request.txt"), QFINDTESTDATA("data/files_batch_delete_response.txt"))});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileDeleteJob(QStringList{QStringLiteral("file1"), QStringLiteral("file2")}, account);
+        job->setBatchSize(100);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NotFound);
+
+        const auto results = job->itemResults();
+        QCOMPARE(results.count(), 2);
+        QCOMPARE(results.at(0).error, KGAPI2::NoError);
+        QCOMPARE(results.at(1).error, KGAPI2::NotFound);
+        QCOMPARE(results.at(1).errorString, QStringLiteral("File not found: file2"));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+};
+
+QTEST_GUILESS_MAIN(FileDeleteJobTest)
+
+#include "filedeletejobtest.moc"
@@ -0,0 +1,248 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QBuffer>
+#include <QObject>
+#include <QTest>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "bandwidthlimiter.h"
+#include "file.h"
+#include "filefetchcontentjob.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+namespace
+{
+const QUrl downloadUrl(QStringLiteral("https://example.test/download/file"));
+
+QByteArray testData(int size)
+{
+    QByteArray data(size, Qt::Uninitialized);
+    for (int i = 0; i < size; ++i) {
+        data[i] = static_cast<char>(i % 251);
+    }
+    return data;
+}
+
+FakeNetworkAccessManager::Scenario downloadScenario(const QByteArray &range, int responseCode, const QByteArray &data)
+{
+    FakeNetworkAccessManager::Scenario scenario(QUrl(QStringLiteral("https://example.test/download/file?prettyPrint=false")),
+                                                QNetworkAccessManager::GetOperation,
+                                                {},
+                                                responseCode,
+                                                data);
+    if (!range.isEmpty()) {
+        scenario.requestHeaders = {{"Range", range}};
+    }
+    return scenario;
+}
+} // namespace
+
+class FileFetchContentJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testFetchToMemory()
+    {
+        const auto content = testData(4096);
+        FakeNetworkAccessManagerFactory::get()->setScenarios({downloadScenario({}, KGAPI2::OK, content)});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileFetchContentJob(downloadUrl, account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->data(), content);
+        QCOMPARE(job->completedOffset(), qint64(content.size()));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testFetchToDevice()
+    {
+        const auto content = testData(4096);
+        FakeNetworkAccessManagerFactory::get()->setScenarios({downloadScenario({}, KGAPI2::OK, content)});
+
+        QBuffer device;
+        QVERIFY(device.open(QIODevice::WriteOnly));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileFetchContentJob(downloadUrl, account);
+        job->setDevice(&device);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QVERIFY(job->data().isEmpty());
+        QCOMPARE(device.data(), content);
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testResume()
+    {
+        const auto content = testData(4096);
+        FakeNetworkAccessManagerFactory::get()->setScenarios({downloadScenario("bytes=1000-", KGAPI2::PartialContent, content.sliced(1000))});
+
+        // Content received by a previous, interrupted job
+        QBuffer device;
+        device.setData(content.first(1000));
+        QVERIFY(device.open(QIODevice::ReadWrite));
+        QVERIFY(device.seek(1000));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileFetchContentJob(downloadUrl, account);
+        job->setDevice(&device);
+        job->setStartOffset(1000);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(device.data(), content);
+        QCOMPARE(job->completedOffset(), qint64(content.size()));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testParallelRanges()
+    {
+        const int size = 3 * 1024 * 1024;
+        const int rangeSize = 1024 * 1024;
+        const auto content = testData(size);
+        FakeNetworkAccessManagerFactory::get()->setScenarios({
+            downloadScenario("bytes=0-1048575", KGAPI2::PartialContent, content.sliced(0, rangeSize)),
+            downloadScenario("bytes=1048576-2097151", KGAPI2::PartialContent, content.sliced(rangeSize, rangeSize)),
+            downloadScenario("bytes=2097152-3145727", KGAPI2::PartialContent, content.sliced(2 * rangeSize)),
+        });
+
+        const auto file = Drive::File::fromJSON(QByteArrayLiteral(R"({"kind": "drive#file", "id": "MockFileId",)"
+                                                                  R"( "downloadUrl": "https://example.test/download/file", "fileSize": "3145728"})"));
+        QVERIFY(file);
+
+        QBuffer device;
+        QVERIFY(device.open(QIODevice::WriteOnly));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileFetchContentJob(file, account);
+        job->setDevice(&device);
+        job->setParallelDownloads(4);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(device.data().size(), size);
+        QVERIFY(device.data() == content);
+        QCOMPARE(job->completedOffset(), qint64(size));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testThrottledRanges()
+    {
+        const int size = 2 * 1024 * 1024;
+        const int rangeSize = 1024 * 1024;
+        const auto content = testData(size);
+        FakeNetworkAccessManagerFactory::get()->setScenarios({
+            downloadScenario("bytes=0-1048575", KGAPI2::PartialContent, content.sliced(0, rangeSize)),
+            downloadScenario("bytes=1048576-2097151", KGAPI2::PartialContent, content.sliced(rangeSize)),
+        });
+
+        const auto file = Drive::File::fromJSON(QByteArrayLiteral(R"({"kind": "drive#file", "id": "MockFileId",)"
+                                                                  R"( "downloadUrl": "https://example.test/download/file", "fileSize": "2097152"})"));
+        QVERIFY(file);
+
+        QBuffer device;
+        QVERIFY(device.open(QIODevice::WriteOnly));
+
+        // Only a part of the first range fits into the bucket, the content
+        // held back by the limiter is written once the replies finish
+        Drive::BandwidthLimiter limiter;
+        limiter.setRate(Drive::BandwidthLimiter::Download, 4096);
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileFetchContentJob(file, account);
+        job->setDevice(&device);
+        job->setParallelDownloads(4);
+        job->setBandwidthLimiter(&limiter);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(device.data().size(), size);
+        QVERIFY(device.data() == content);
+        QCOMPARE(job->completedOffset(), qint64(size));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testRangeIgnored()
+    {
+        const auto content = testData(4096);
+        FakeNetworkAccessManagerFactory::get()->setScenarios({downloadScenario("bytes=1000-", KGAPI2::OK, content)});
+
+        QBuffer device;
+        QVERIFY(device.open(QIODevice::WriteOnly));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileFetchContentJob(downloadUrl, account);
+        job->setDevice(&device);
+        job->setStartOffset(1000);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::UnknownError);
+        QVERIFY(device.data().isEmpty());
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testInterrupted()
+    {
+        const auto content = testData(4096);
+        auto scenario = downloadScenario({}, KGAPI2::OK, content.first(1000));
+        scenario.networkError = QNetworkReply::RemoteHostClosedError;
+        FakeNetworkAccessManagerFactory::get()->setScenarios({scenario});
+
+        QBuffer device;
+        QVERIFY(device.open(QIODevice::WriteOnly));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileFetchContentJob(downloadUrl, account);
+        job->setDevice(&device);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NetworkError);
+        QVERIFY(device.data() == content.first(1000));
+        QCOMPARE(job->completedOffset(), qint64(1000));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testTruncated()
+    {
+        // The connection is closed cleanly, but before the end of the file
+        const auto content = testData(4096);
+        FakeNetworkAccessManagerFactory::get()->setScenarios({downloadScenario({}, KGAPI2::OK, content.first(1000))});
+
+        const auto file = Drive::File::fromJSON(QByteArrayLiteral(R"({"kind": "drive#file", "id": "MockFileId",)"
+                                                                  R"( "downloadUrl": "https://example.test/download/file", "fileSize": "4096"})"));
+        QVERIFY(file);
+
+        QBuffer device;
+        QVERIFY(device.open(QIODevice::WriteOnly));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileFetchContentJob(file, account);
+        job->setDevice(&device);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NetworkError);
+        QCOMPARE(job->completedOffset(), qint64(1000));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+};
+
+QTEST_GUILESS_MAIN(FileFetchContentJobTest)
+
+#include "filefetchcontentjobtest.moc"
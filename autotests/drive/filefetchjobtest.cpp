@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QObject>
+#include <QTest>
+#include <QUrlQuery>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "file.h"
+#include "filefetchjob.h"
+#include "filesearchquery.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+namespace
+{
+FakeNetworkAccessManager::Scenario searchScenario(const Drive::SearchQuery &query, const QByteArray &data)
+{
+    QUrl url(QStringLiteral("https://www.googleapis.com/drive/v2/files"));
+    QUrlQuery urlQuery;
+    urlQuery.addQueryItem(QStringLiteral("q"), query.serialize());
+    urlQuery.addQueryItem(QStringLiteral("includeItemsFromAllDrives"), QStringLiteral("true"));
+    urlQuery.addQueryItem(QStringLiteral("supportsAllDrives"), QStringLiteral("true"));
+    urlQuery.addQueryItem(QStringLiteral("prettyPrint"), QStringLiteral("false"));
+    url.setQuery(urlQuery);
+    return FakeNetworkAccessManager::Scenario(url, QNetworkAccessManager::GetOperation, {}, KGAPI2::OK, data);
+}
+
+QByteArray filesFeed(const QStringList &ids)
+{
+    QByteArrayList items;
+    for (const auto &id : ids) {
+        items << R"({"kind": "drive#file", "id": ")" + id.toLatin1() + R"("})";
+    }
+    return R"({"kind": "drive#fileList", "items": [)" + items.join(", ") + "]}";
+}
+} // namespace
+
+class FileFetchJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testSplitQuery()
+    {
+        Drive::FileSearchQuery parents(Drive::FileSearchQuery::Or);
+        for (int i = 0; i < 150; ++i) {
+            parents.addQuery(Drive::FileSearchQuery::Parents, Drive::FileSearchQuery::In, QStringLiteral("folder%1").arg(i, 3, 10, QLatin1Char('0')));
+        }
+        Drive::FileSearchQuery query;
+        query.addQuery(parents);
+        query.addQuery(Drive::FileSearchQuery::Trashed, Drive::FileSearchQuery::Equals, false);
+
+        // Too long for a single request
+        const auto queries = query.split();
+        QCOMPARE(queries.size(), 2);
+
+        // A file in folders from both parts is returned by both requests
+        FakeNetworkAccessManagerFactory::get()->setScenarios({
+            searchScenario(queries.at(0), filesFeed({QStringLiteral("file1"), QStringLiteral("shared")})),
+            searchScenario(queries.at(1), filesFeed({QStringLiteral("shared"), QStringLiteral("file2")})),
+        });
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileFetchJob(query, account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+
+        QStringList ids;
+        const auto items = job->items();
+        for (const auto &item : items) {
+            ids << item.dynamicCast<Drive::File>()->id();
+        }
+        ids.sort();
+        QCOMPARE(ids, (QStringList{QStringLiteral("file1"), QStringLiteral("file2"), QStringLiteral("shared")}));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+};
+
+QTEST_GUILESS_MAIN(FileFetchJobTest)
+
+#include "filefetchjobtest.moc"
@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "file.h"
+#include "filechecksumcache.h"
+#include "filemodifyjob.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+Q_DECLARE_METATYPE(QList<FakeNetworkAccessManager::Scenario>)
+
+using Scenarios = QList<FakeNetworkAccessManager::Scenario>;
+
+namespace
+{
+const QByteArray content("Hello World\n");
+
+QByteArray md5(const QByteArray &data)
+{
+    return QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex();
+}
+
+QByteArray remoteFile(const QByteArray &checksum)
+{
+    return R"({"kind": "drive#file", "id": "MockFileId", "md5Checksum": ")" + checksum + R"("})";
+}
+
+FakeNetworkAccessManager::Scenario checksumScenario(const QByteArray &checksum)
+{
+    return FakeNetworkAccessManager::Scenario(
+        QUrl(QStringLiteral("https://www.googleapis.com/drive/v2/files/MockFileId?supportsAllDrives=true&fields=kind,id,md5Checksum&prettyPrint=false")),
+        QNetworkAccessManager::GetOperation,
+        {},
+        KGAPI2::OK,
+        remoteFile(checksum));
+}
+
+FakeNetworkAccessManager::Scenario uploadScenario()
+{
+    return FakeNetworkAccessManager::Scenario(
+        QUrl(QStringLiteral("https://www.googleapis.com/upload/drive/v2/files/MockFileId?newRevision=true&setModifiedDate=false&updateViewedDate=true"
+                            "&convert=false&enforceSingleParent=false&ocr=false&pinned=false&useContentAsIndexableText=false&supportsAllDrives=true"
+                            "&uploadType=media&prettyPrint=false")),
+        QNetworkAccessManager::PutOperation,
+        content,
+        KGAPI2::OK,
+        remoteFile(md5(content)));
+}
+} // namespace
+
+class FileModifyJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testSkipUnchangedContent_data()
+    {
+        QTest::addColumn<QList<FakeNetworkAccessManager::Scenario>>("scenarios");
+        QTest::addColumn<bool>("skipUnchanged");
+        QTest::addColumn<bool>("expectUnchanged");
+
+        QTest::newRow("unchanged") << Scenarios{checksumScenario(md5(content))} << true << true;
+        QTest::newRow("changed") << Scenarios{checksumScenario(md5("Hello Earth\n")), uploadScenario()} << true << false;
+        QTest::newRow("disabled") << Scenarios{uploadScenario()} << false << false;
+    }
+
+    void testSkipUnchangedContent()
+    {
+        QFETCH(QList<FakeNetworkAccessManager::Scenario>, scenarios);
+        QFETCH(bool, skipUnchanged);
+        QFETCH(bool, expectUnchanged);
+
+        FakeNetworkAccessManagerFactory::get()->setScenarios(scenarios);
+
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString filePath = dir.filePath(QStringLiteral("backup.txt"));
+        QFile file(filePath);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write(content);
+        file.close();
+
+        Drive::FileChecksumCache cache;
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileModifyJob(filePath, QStringLiteral("MockFileId"), account);
+        job->setSkipUnchangedContent(skipUnchanged);
+        job->setChecksumCache(&cache);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->unchangedFiles(), expectUnchanged ? QStringList{filePath} : QStringList{});
+
+        const auto files = job->files();
+        QCOMPARE(files.count(), 1);
+        QCOMPARE((*files.cbegin())->id(), QStringLiteral("MockFileId"));
+        QCOMPARE((*files.cbegin())->md5Checksum(), QString::fromLatin1(md5(content)));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testSkipUnchangedContentWithMetadata()
+    {
+        const auto metaData = Drive::File::fromJSON(R"({"kind": "drive#file", "id": "MockFileId", "title": "backup.txt", "md5Checksum": ")"
+                                                    + md5(content) + R"("})");
+        QVERIFY(metaData);
+
+        // Only the metadata are sent
+        FakeNetworkAccessManagerFactory::get()->setScenarios(
+            {FakeNetworkAccessManager::Scenario(QUrl(QStringLiteral("https://www.googleapis.com/drive/v2/files/MockFileId?newRevision=true&setModifiedDate=false"
+                                                                    "&updateViewedDate=true&convert=false&enforceSingleParent=false&ocr=false&pinned=false"
+                                                                    "&useContentAsIndexableText=false&supportsAllDrives=true&prettyPrint=false")),
+                                                QNetworkAccessManager::PutOperation,
+                                                Drive::File::toJSON(metaData, Drive::File::ExcludeCreationDate),
+                                                KGAPI2::OK,
+                                                remoteFile(md5(content)))});
+
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString filePath = dir.filePath(QStringLiteral("backup.txt"));
+        QFile file(filePath);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write(content);
+        file.close();
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileModifyJob(filePath, metaData, account);
+        job->setSkipUnchangedContent(true);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->unchangedFiles(), QStringList{filePath});
+        QCOMPARE(job->files().count(), 1);
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+};
+
+QTEST_GUILESS_MAIN(FileModifyJobTest)
+
+#include "filemodifyjobtest.moc"
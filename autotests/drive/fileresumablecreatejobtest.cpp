@@ -0,0 +1,285 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QBuffer>
+#include <QObject>
+#include <QTest>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "file.h"
+#include "fileresumablecreatejob.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+Q_DECLARE_METATYPE(QList<FakeNetworkAccessManager::Scenario>)
+
+using Scenarios = QList<FakeNetworkAccessManager::Scenario>;
+
+namespace
+{
+const QUrl sessionUrl(QStringLiteral("https://upload.test/session"));
+
+QByteArray testData(int size)
+{
+    QByteArray data(size, Qt::Uninitialized);
+    for (int i = 0; i < size; ++i) {
+        data[i] = static_cast<char>(i % 251);
+    }
+    return data;
+}
+
+FakeNetworkAccessManager::Scenario sessionScenario()
+{
+    FakeNetworkAccessManager::Scenario scenario(
+        QUrl(QStringLiteral("https://www.googleapis.com/upload/drive/v2/files?convert=false&enforceSingleParent=false&ocr=false&pinned=false"
+                            "&useContentAsIndexableText=false&supportsAllDrives=true&uploadType=resumable&prettyPrint=false")),
+        QNetworkAccessManager::PostOperation,
+        {},
+        KGAPI2::OK,
+        {});
+    scenario.responseHeaders = {{"Location", sessionUrl.toString().toUtf8()}};
+    return scenario;
+}
+
+// @p committed is the number of bytes the server reports as committed, -1 when
+// the request completes the upload
+FakeNetworkAccessManager::Scenario uploadScenario(const QByteArray &range, const QByteArray &data, qint64 committed)
+{
+    const bool last = committed == -1;
+    FakeNetworkAccessManager::Scenario scenario(QUrl(QStringLiteral("https://upload.test/session?prettyPrint=false")),
+                                                QNetworkAccessManager::PutOperation,
+                                                data,
+                                                last ? KGAPI2::OK : KGAPI2::ResumeIncomplete,
+                                                last ? R"({"kind": "drive#file", "id": "MockFileId"})" : QByteArray());
+    scenario.requestHeaders = {{"Content-Range", range}};
+    if (committed > 0) {
+        scenario.responseHeaders = {{"Range", "bytes=0-" + QByteArray::number(committed - 1)}};
+    }
+    return scenario;
+}
+
+FakeNetworkAccessManager::Scenario chunkScenario(const QByteArray &range, const QByteArray &data, bool last)
+{
+    // Commit the whole chunk
+    const qint64 lastByte = range.mid(range.indexOf('-') + 1, range.indexOf('/') - range.indexOf('-') - 1).toLongLong();
+    return uploadScenario(range, data, last ? -1 : lastByte + 1);
+}
+} // namespace
+
+class FileResumableCreateJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testChunkSize()
+    {
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        Drive::FileResumableCreateJob job(account);
+        QCOMPARE(job.chunkSize(), qint64(256 * 1024));
+
+        job.setChunkSize(8 * 1024 * 1024);
+        QCOMPARE(job.chunkSize(), qint64(8 * 1024 * 1024));
+
+        job.setChunkSize(300000);
+        QCOMPARE(job.chunkSize(), qint64(256 * 1024));
+
+        job.setChunkSize(1000);
+        QCOMPARE(job.chunkSize(), qint64(256 * 1024));
+    }
+
+    void testUploadStateJSON()
+    {
+        Drive::FileAbstractResumableJob::UploadState state;
+        QVERIFY(!state.isValid());
+
+        state.sessionUrl = sessionUrl;
+        state.totalSize = 614400;
+        state.offset = 262144;
+        QVERIFY(state.isValid());
+
+        const auto parsed = Drive::FileAbstractResumableJob::UploadState::fromJSON(state.toJSON());
+        QVERIFY(parsed.isValid());
+        QCOMPARE(parsed.sessionUrl, state.sessionUrl);
+        QCOMPARE(parsed.totalSize, state.totalSize);
+        QCOMPARE(parsed.offset, state.offset);
+
+        QVERIFY(!Drive::FileAbstractResumableJob::UploadState::fromJSON("garbage").isValid());
+    }
+
+    void testUpload_data()
+    {
+        QTest::addColumn<bool>("fromDevice");
+        QTest::addColumn<int>("chunkSize");
+        QTest::addColumn<QList<FakeNetworkAccessManager::Scenario>>("scenarios");
+
+        const auto data = testData(600 * 1024);
+
+        QTest::newRow("device") << true << 512 * 1024
+                                << Scenarios{sessionScenario(),
+                                             chunkScenario("bytes 0-524287/*", data.first(524288), false),
+                                             chunkScenario("bytes 524288-614399/614400", data.sliced(524288), true)};
+
+        QTest::newRow("write") << false << 256 * 1024
+                               << Scenarios{sessionScenario(),
+                                            chunkScenario("bytes 0-262143/*", data.first(262144), false),
+                                            chunkScenario("bytes 262144-524287/*", data.sliced(262144, 262144), false),
+                                            chunkScenario("bytes 524288-614399/614400", data.sliced(524288), true)};
+    }
+
+    void testUpload()
+    {
+        QFETCH(bool, fromDevice);
+        QFETCH(int, chunkSize);
+        QFETCH(QList<FakeNetworkAccessManager::Scenario>, scenarios);
+
+        FakeNetworkAccessManagerFactory::get()->setScenarios(scenarios);
+
+        const auto data = testData(600 * 1024);
+        QBuffer device;
+        device.setData(data);
+        QVERIFY(device.open(QIODevice::ReadOnly));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        Drive::FileResumableCreateJob *job = nullptr;
+        if (fromDevice) {
+            job = new Drive::FileResumableCreateJob(&device, account);
+        } else {
+            job = new Drive::FileResumableCreateJob(account);
+            connect(
+                job,
+                &Drive::FileAbstractResumableJob::readyWrite,
+                job,
+                [&device](Drive::FileAbstractResumableJob *job) {
+                    // Write in pieces that don't align with the chunks
+                    job->write(device.read(100000));
+                },
+                Qt::DirectConnection);
+        }
+        job->setChunkSize(chunkSize);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->metadata()->id(), QStringLiteral("MockFileId"));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testResume()
+    {
+        const auto data = testData(600 * 1024);
+        FakeNetworkAccessManagerFactory::get()->setScenarios({uploadScenario("bytes */614400", {}, 262144),
+                                                              chunkScenario("bytes 262144-524287/614400", data.sliced(262144, 262144), false),
+                                                              chunkScenario("bytes 524288-614399/614400", data.sliced(524288), true)});
+
+        QBuffer device;
+        device.setData(data);
+        QVERIFY(device.open(QIODevice::ReadOnly));
+
+        Drive::FileAbstractResumableJob::UploadState state;
+        state.sessionUrl = sessionUrl;
+        state.totalSize = data.size();
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileResumableCreateJob(&device, account);
+        job->setUploadState(state);
+        QList<qint64> offsets;
+        connect(job, &Drive::FileAbstractResumableJob::uploadStateChanged, job, [&offsets](Drive::FileAbstractResumableJob *job) {
+            QCOMPARE(job->uploadState().sessionUrl, sessionUrl);
+            offsets << job->uploadState().offset;
+        });
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->metadata()->id(), QStringLiteral("MockFileId"));
+        QCOMPARE(offsets, (QList<qint64>{262144, 524288}));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testPartialCommit()
+    {
+        const auto data = testData(600 * 1024);
+        // The server commits the first chunk only partially, the rest of it
+        // must be sent again
+        FakeNetworkAccessManagerFactory::get()->setScenarios({sessionScenario(),
+                                                              uploadScenario("bytes 0-262143/*", data.first(262144), 100000),
+                                                              chunkScenario("bytes 100000-362143/*", data.sliced(100000, 262144), false),
+                                                              chunkScenario("bytes 362144-614399/614400", data.sliced(362144), true)});
+
+        QBuffer device;
+        device.setData(data);
+        QVERIFY(device.open(QIODevice::ReadOnly));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileResumableCreateJob(&device, account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->metadata()->id(), QStringLiteral("MockFileId"));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testResumeAfterServerError()
+    {
+        const auto data = testData(600 * 1024);
+        // The first chunk fails with a server error, the server has committed only half of it
+        auto failedChunk = uploadScenario("bytes 0-262143/*", data.first(262144), 0);
+        failedChunk.responseCode = 503;
+        FakeNetworkAccessManagerFactory::get()->setScenarios({sessionScenario(),
+                                                              failedChunk,
+                                                              uploadScenario("bytes */*", {}, 131072),
+                                                              chunkScenario("bytes 131072-393215/*", data.sliced(131072, 262144), false),
+                                                              chunkScenario("bytes 393216-614399/614400", data.sliced(393216), true)});
+
+        QBuffer device;
+        device.setData(data);
+        QVERIFY(device.open(QIODevice::ReadOnly));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileResumableCreateJob(&device, account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->metadata()->id(), QStringLiteral("MockFileId"));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testResumeAfterNetworkError()
+    {
+        const auto data = testData(600 * 1024);
+        // The connection drops while sending the first chunk, there is no status
+        auto failedChunk = uploadScenario("bytes 0-262143/*", data.first(262144), 0);
+        failedChunk.responseCode = 0;
+        failedChunk.networkError = QNetworkReply::RemoteHostClosedError;
+        FakeNetworkAccessManagerFactory::get()->setScenarios({sessionScenario(),
+                                                              failedChunk,
+                                                              uploadScenario("bytes */*", {}, 131072),
+                                                              chunkScenario("bytes 131072-393215/*", data.sliced(131072, 262144), false),
+                                                              chunkScenario("bytes 393216-614399/614400", data.sliced(393216), true)});
+
+        QBuffer device;
+        device.setData(data);
+        QVERIFY(device.open(QIODevice::ReadOnly));
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FileResumableCreateJob(&device, account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->metadata()->id(), QStringLiteral("MockFileId"));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+};
+
+QTEST_GUILESS_MAIN(FileResumableCreateJobTest)
+
+#include "fileresumablecreatejobtest.moc"
@@ -6,6 +6,7 @@
 
 #include <QObject>
 #include <QTest>
+#include <QUrl>
 
 #include "filesearchquery.h"
 
@@ -71,6 +72,56 @@ private Q_SLOTS:
         const QString serialized = query.serialize();
         QCOMPARE(serialized, expected);
     }
+
+    void testCopy()
+    {
+        FileSearchQuery query;
+        query.addQuery(FileSearchQuery::Title, FileSearchQuery::Equals, QLatin1StringView("Title"));
+        QCOMPARE(query.serialize(), QStringLiteral("((title = 'Title'))"));
+
+        // Modifying a copy must not change the original
+        FileSearchQuery copy(query);
+        copy.addQuery(FileSearchQuery::Trashed, FileSearchQuery::Equals, false);
+        QCOMPARE(copy.serialize(), QStringLiteral("((title = 'Title') and (trashed = false))"));
+        QCOMPARE(query.serialize(), QStringLiteral("((title = 'Title'))"));
+    }
+
+    void testSplit()
+    {
+        FileSearchQuery parents(FileSearchQuery::Or);
+        for (int i = 0; i < 10; ++i) {
+            parents.addQuery(FileSearchQuery::Parents, FileSearchQuery::In, QStringLiteral("f%1").arg(i));
+        }
+
+        // Short enough queries are not split
+        QCOMPARE(parents.split().size(), 1);
+        QCOMPARE(parents.split().constFirst().serialize(), parents.serialize());
+
+        auto queries = parents.split(100);
+        QCOMPARE(queries.size(), 5);
+        QCOMPARE(queries.at(0).serialize(), QStringLiteral("(('f0' in parents) or ('f1' in parents))"));
+        QCOMPARE(queries.at(4).serialize(), QStringLiteral("(('f8' in parents) or ('f9' in parents))"));
+        for (const auto &part : std::as_const(queries)) {
+            QVERIFY(QUrl::toPercentEncoding(part.serialize()).size() <= 100);
+        }
+
+        // Other terms of the query are repeated in every part
+        FileSearchQuery query;
+        query.addQuery(parents);
+        query.addQuery(FileSearchQuery::Trashed, FileSearchQuery::Equals, false);
+        queries = query.split(150);
+        QCOMPARE(queries.size(), 4);
+        QCOMPARE(queries.at(0).serialize(), QStringLiteral("((('f0' in parents) or ('f1' in parents) or ('f2' in parents)) and (trashed = false))"));
+        QCOMPARE(queries.at(3).serialize(), QStringLiteral("((('f9' in parents)) and (trashed = false))"));
+        for (const auto &part : std::as_const(queries)) {
+            QVERIFY(QUrl::toPercentEncoding(part.serialize()).size() <= 150);
+        }
+
+        // A single condition cannot be split
+        FileSearchQuery title;
+        title.addQuery(FileSearchQuery::Title, FileSearchQuery::Contains, QStringLiteral("A very long title"));
+        QCOMPARE(title.split(10).size(), 1);
+    }
 };
 
 QTEST_GUILESS_MAIN(FileSearchQueryTest)
@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QObject>
+#include <QTest>
+#include <QUrlQuery>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "file.h"
+#include "foldertreefetchjob.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+namespace
+{
+QUrl listUrl(const QString &q, const QString &pageToken = QString())
+{
+    QUrl url(QStringLiteral("https://www.googleapis.com/drive/v2/files"));
+    QUrlQuery query;
+    query.addQueryItem(QStringLiteral("q"), q);
+    query.addQueryItem(QStringLiteral("includeItemsFromAllDrives"), QStringLiteral("true"));
+    query.addQueryItem(QStringLiteral("supportsAllDrives"), QStringLiteral("true"));
+    if (!pageToken.isEmpty()) {
+        query.addQueryItem(QStringLiteral("pageToken"), pageToken);
+    }
+    url.setQuery(query);
+    return url;
+}
+
+QUrl requestUrl(const QUrl &url)
+{
+    QUrl requestUrl(url);
+    QUrlQuery query(requestUrl);
+    query.addQueryItem(QStringLiteral("prettyPrint"), QStringLiteral("false"));
+    requestUrl.setQuery(query);
+    return requestUrl;
+}
+
+QByteArray item(const QString &id, bool folder)
+{
+    const auto mimeType = folder ? QStringLiteral("application/vnd.google-apps.folder") : QStringLiteral("text/plain");
+    return QStringLiteral(R"({"kind": "drive#file", "id": "%1", "title": "%1", "mimeType": "%2"})").arg(id, mimeType).toUtf8();
+}
+
+FakeNetworkAccessManager::Scenario listScenario(const QUrl &url, const QList<QByteArray> &items, const QUrl &nextLink = QUrl())
+{
+    QByteArray response = R"({"kind": "drive#fileList", "items": [)" + items.join(", ") + "]";
+    if (nextLink.isValid()) {
+        response += R"(, "nextLink": ")" + nextLink.toString(QUrl::FullyEncoded).toUtf8() + '"';
+    }
+    response += '}';
+    return FakeNetworkAccessManager::Scenario(requestUrl(url), QNetworkAccessManager::GetOperation, {}, KGAPI2::OK, response);
+}
+} // namespace
+
+class FolderTreeFetchJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testFetchTree()
+    {
+        const auto level1Query = QStringLiteral("((('Root' in parents)) and (trashed = false))");
+        // Both subfolders are queried at once
+        const auto level2Query = QStringLiteral("((('Photos' in parents) or ('Music' in parents)) and (trashed = false))");
+        const auto level3Query = QStringLiteral("((('Albums' in parents)) and (trashed = false))");
+        FakeNetworkAccessManagerFactory::get()->setScenarios({
+            listScenario(listUrl(level1Query), {item(QStringLiteral("Photos"), true), item(QStringLiteral("Music"), true), item(QStringLiteral("a.txt"), false)}),
+            listScenario(listUrl(level2Query),
+                         {item(QStringLiteral("b.jpg"), false), item(QStringLiteral("Albums"), true)},
+                         listUrl(level2Query, QStringLiteral("page2"))),
+            listScenario(listUrl(level2Query, QStringLiteral("page2")), {item(QStringLiteral("c.mp3"), false)}),
+            listScenario(listUrl(level3Query), {item(QStringLiteral("d.jpg"), false)}),
+        });
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FolderTreeFetchJob(QStringLiteral("Root"), account);
+        QList<int> levels;
+        QList<int> levelSizes;
+        connect(job, &Drive::FolderTreeFetchJob::levelFetched, this, [&levels, &levelSizes](Drive::FolderTreeFetchJob *, int depth, const Drive::FilesList &files) {
+            levels << depth;
+            levelSizes << files.size();
+        });
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->items().size(), 7);
+        QCOMPARE(levels, (QList<int>{1, 2, 3}));
+        QCOMPARE(levelSizes, (QList<int>{3, 3, 1}));
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testMaxDepth()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios({
+            listScenario(listUrl(QStringLiteral("((('Root' in parents)) and (trashed = false))")),
+                         {item(QStringLiteral("Photos"), true), item(QStringLiteral("a.txt"), false)}),
+        });
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::FolderTreeFetchJob(QStringLiteral("Root"), account);
+        job->setMaxDepth(1);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->items().size(), 2);
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+};
+
+QTEST_GUILESS_MAIN(FolderTreeFetchJobTest)
+
+#include "foldertreefetchjobtest.moc"
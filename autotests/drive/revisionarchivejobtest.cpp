@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QBuffer>
+#include <QObject>
+#include <QSet>
+#include <QTest>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "revision.h"
+#include "revisionarchive.h"
+#include "revisionarchivejob.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+namespace
+{
+class MemoryArchive : public Drive::RevisionArchive
+{
+public:
+    bool containsChecksum(const QString &md5Checksum) const override
+    {
+        return checksums.contains(md5Checksum);
+    }
+
+    QIODevice *open(const QString &fileId, const Drive::RevisionPtr &revision, qint64 &offset) override
+    {
+        Q_UNUSED(fileId)
+
+        auto buffer = new QBuffer;
+        buffer->setData(partial.value(revision->id()));
+        buffer->open(QIODevice::ReadWrite);
+        buffer->seek(buffer->size());
+        offset = buffer->size();
+        return buffer;
+    }
+
+    void close(const QString &fileId, const Drive::RevisionPtr &revision, QIODevice *device, qint64 completedOffset, bool completed) override
+    {
+        Q_UNUSED(fileId)
+
+        const QByteArray data = static_cast<QBuffer *>(device)->data().first(completedOffset);
+        if (completed) {
+            checksums.insert(revision->md5Checksum());
+            archived.insert(revision->id(), data);
+        } else {
+            partial.insert(revision->id(), data);
+        }
+        delete device;
+    }
+
+    QSet<QString> checksums;
+    QHash<QString, QByteArray> partial;
+    QHash<QString, QByteArray> archived;
+};
+
+FakeNetworkAccessManager::Scenario revisionsScenario(const QString &fileId, int code, const QByteArray &data)
+{
+    return FakeNetworkAccessManager::Scenario(QUrl(QStringLiteral("https://www.googleapis.com/drive/v2/files/%1/revisions?prettyPrint=false").arg(fileId)),
+                                              QNetworkAccessManager::GetOperation,
+                                              {},
+                                              code,
+                                              data);
+}
+} // namespace
+
+class RevisionArchiveJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testArchive()
+    {
+        const QByteArray revisions = R"({"kind": "drive#revisionList", "items": [
+            {"kind": "drive#revision", "id": "rev0", "modifiedDate": "2025-06-01T10:00:00.000Z", "md5Checksum": "000",
+             "downloadUrl": "https://example.test/revisions/rev0"},
+            {"kind": "drive#revision", "id": "rev1", "modifiedDate": "2026-02-01T10:00:00.000Z", "md5Checksum": "aaa",
+             "downloadUrl": "https://example.test/revisions/rev1"},
+            {"kind": "drive#revision", "id": "rev2", "modifiedDate": "2026-03-01T10:00:00.000Z", "md5Checksum": "3e25960a79dbc69b674cd4ec67a72c62", "fileSize": "11",
+             "downloadUrl": "https://example.test/revisions/rev2"},
+            {"kind": "drive#revision", "id": "rev3", "modifiedDate": "2026-04-01T10:00:00.000Z"}
+        ]})";
+        FakeNetworkAccessManager::Scenario download(QUrl(QStringLiteral("https://example.test/revisions/rev2?prettyPrint=false")),
+                                                    QNetworkAccessManager::GetOperation,
+                                                    {},
+                                                    KGAPI2::PartialContent,
+                                                    "lo world");
+        download.requestHeaders = {{"Range", "bytes=3-"}};
+        FakeNetworkAccessManagerFactory::get()->setScenarios({
+            revisionsScenario(QStringLiteral("file1"), KGAPI2::OK, revisions),
+            download,
+            revisionsScenario(QStringLiteral("file2"), KGAPI2::NotFound, {}),
+        });
+
+        MemoryArchive archive;
+        archive.checksums.insert(QStringLiteral("aaa"));
+        // Left by an interrupted run
+        archive.partial.insert(QStringLiteral("rev2"), "Hel");
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::RevisionArchiveJob({QStringLiteral("file1"), QStringLiteral("file2")}, &archive, account);
+        job->setModifiedSince(QDateTime(QDate(2026, 1, 1), QTime(0, 0), QTimeZone::UTC));
+        job->setMaxParallelJobs(1);
+        QStringList archivedRevisions;
+        connect(job,
+                &Drive::RevisionArchiveJob::revisionArchived,
+                this,
+                [&archivedRevisions](Drive::RevisionArchiveJob *, const QString &, const Drive::RevisionPtr &revision) {
+                    archivedRevisions << revision->id();
+                });
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NotFound);
+        QCOMPARE(archivedRevisions, QStringList{QStringLiteral("rev2")});
+        QCOMPARE(archive.archived.value(QStringLiteral("rev2")), QByteArray("Hello world"));
+        auto skipped = job->skippedRevisions().values(QStringLiteral("file1"));
+        skipped.sort();
+        QCOMPARE(skipped, (QStringList{QStringLiteral("rev1"), QStringLiteral("rev3")}));
+        QCOMPARE(job->failedRevisions().keys(), QStringList{QStringLiteral("file2")});
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testVerify()
+    {
+        const QByteArray revisions = R"({"kind": "drive#revisionList", "items": [
+            {"kind": "drive#revision", "id": "short", "fileSize": "11", "downloadUrl": "https://example.test/revisions/short"},
+            {"kind": "drive#revision", "id": "corrupt", "md5Checksum": "3e25960a79dbc69b674cd4ec67a72c62",
+             "downloadUrl": "https://example.test/revisions/corrupt"},
+            {"kind": "drive#revision", "id": "good", "md5Checksum": "8b1a9953c4611296a827abf8c47804d7",
+             "downloadUrl": "https://example.test/revisions/good"}
+        ]})";
+        const auto downloadScenario = [](const QString &revisionId) {
+            return FakeNetworkAccessManager::Scenario(QUrl(QStringLiteral("https://example.test/revisions/%1?prettyPrint=false").arg(revisionId)),
+                                                      QNetworkAccessManager::GetOperation,
+                                                      {},
+                                                      KGAPI2::OK,
+                                                      "Hello");
+        };
+        FakeNetworkAccessManagerFactory::get()->setScenarios({
+            revisionsScenario(QStringLiteral("file1"), KGAPI2::OK, revisions),
+            downloadScenario(QStringLiteral("short")),
+            downloadScenario(QStringLiteral("corrupt")),
+            downloadScenario(QStringLiteral("good")),
+        });
+
+        MemoryArchive archive;
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::RevisionArchiveJob({QStringLiteral("file1")}, &archive, account);
+        job->setMaxParallelJobs(1);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::InvalidResponse);
+
+        auto failed = job->failedRevisions().values(QStringLiteral("file1"));
+        failed.sort();
+        QCOMPARE(failed, (QStringList{QStringLiteral("corrupt"), QStringLiteral("short")}));
+        QCOMPARE(archive.archived.keys(), QList<QString>{QStringLiteral("good")});
+        // The short download is resumed by the next run, the corrupted one starts over
+        QCOMPARE(archive.partial.value(QStringLiteral("short")), QByteArray("Hello"));
+        QVERIFY(archive.partial.value(QStringLiteral("corrupt")).isEmpty());
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+};
+
+QTEST_GUILESS_MAIN(RevisionArchiveJobTest)
+
+#include "revisionarchivejobtest.moc"
@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QBuffer>
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "fakenetworkaccessmanagerfactory.h"
+#include "testutils.h"
+
+#include "account.h"
+#include "file.h"
+#include "thumbnailcache.h"
+#include "thumbnailfetchjob.h"
+#include "types.h"
+
+using namespace KGAPI2;
+
+namespace
+{
+Drive::FilePtr file(const QString &id, bool withThumbnail = true)
+{
+    QString json = QStringLiteral(R"({"kind": "drive#file", "id": "%1", "modifiedDate": "2026-01-01T10:00:00.000Z")").arg(id);
+    if (withThumbnail) {
+        json += QStringLiteral(R"(, "thumbnailLink": "https://lh3.googleusercontent.com/%1=s220")").arg(id);
+    }
+    json += QLatin1Char('}');
+    return Drive::File::fromJSON(json.toUtf8());
+}
+
+QByteArray thumbnailData()
+{
+    QImage image(4, 4, QImage::Format_ARGB32);
+    image.fill(Qt::red);
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "PNG");
+    return data;
+}
+
+FakeNetworkAccessManager::Scenario thumbnailScenario(const QString &id, int code, const QByteArray &data, const QString &size = QStringLiteral("220"))
+{
+    return FakeNetworkAccessManager::Scenario(QUrl(QStringLiteral("https://lh3.googleusercontent.com/%1=s%2?prettyPrint=false").arg(id, size)),
+                                              QNetworkAccessManager::GetOperation,
+                                              {},
+                                              code,
+                                              data);
+}
+} // namespace
+
+class ThumbnailFetchJobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        NetworkAccessManagerFactory::setFactory(new FakeNetworkAccessManagerFactory);
+    }
+
+    void testFetchAndCache()
+    {
+        QTemporaryDir cacheDir;
+        QVERIFY(cacheDir.isValid());
+        Drive::ThumbnailCache cache(cacheDir.path());
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+
+        FakeNetworkAccessManagerFactory::get()->setScenarios({
+            thumbnailScenario(QStringLiteral("file1"), KGAPI2::OK, thumbnailData()),
+            thumbnailScenario(QStringLiteral("file2"), KGAPI2::NotFound, {}),
+        });
+
+        auto job = new Drive::ThumbnailFetchJob({file(QStringLiteral("file1")), file(QStringLiteral("file2")), file(QStringLiteral("file3"), false)}, account);
+        job->setCache(&cache);
+        QStringList fetched;
+        connect(job, &Drive::ThumbnailFetchJob::thumbnailFetched, this, [&fetched](Drive::ThumbnailFetchJob *, const QString &fileId, const QImage &) {
+            fetched << fileId;
+        });
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(fetched, QStringList{QStringLiteral("file1")});
+        QCOMPARE(job->thumbnails().value(QStringLiteral("file1")).size(), QSize(4, 4));
+        auto unavailable = job->unavailableFiles();
+        unavailable.sort();
+        QCOMPARE(unavailable, (QStringList{QStringLiteral("file2"), QStringLiteral("file3")}));
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+
+        // From memory
+        job = new Drive::ThumbnailFetchJob(file(QStringLiteral("file1")), account);
+        job->setCache(&cache);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->thumbnails().size(), 1);
+
+        // From disk
+        Drive::ThumbnailCache otherCache(cacheDir.path());
+        QVERIFY(otherCache.find(QStringLiteral("file1"), file(QStringLiteral("file1"))->modifiedDate(), 0, Drive::ThumbnailCache::MemoryOnly).isNull());
+        job = new Drive::ThumbnailFetchJob(file(QStringLiteral("file1")), account);
+        job->setCache(&otherCache);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->thumbnails().value(QStringLiteral("file1")).size(), QSize(4, 4));
+    }
+
+    void testThumbnailSize()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios({thumbnailScenario(QStringLiteral("file1"), KGAPI2::OK, thumbnailData(), QStringLiteral("64"))});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::ThumbnailFetchJob(file(QStringLiteral("file1")), account);
+        job->setThumbnailSize(64);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->thumbnails().size(), 1);
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+
+    void testError()
+    {
+        FakeNetworkAccessManagerFactory::get()->setScenarios({thumbnailScenario(QStringLiteral("file1"), KGAPI2::InternalError, {})});
+
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+        auto job = new Drive::ThumbnailFetchJob({file(QStringLiteral("file1")), file(QStringLiteral("file2"), false)}, account);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::InternalError);
+        QVERIFY(job->thumbnails().isEmpty());
+
+        QVERIFY(!FakeNetworkAccessManagerFactory::get()->hasScenario());
+    }
+};
+
+QTEST_GUILESS_MAIN(ThumbnailFetchJobTest)
+
+#include "thumbnailfetchjobtest.moc"
@@ -29,6 +29,7 @@ QNetworkReply *FakeNetworkAccessManager::createRequest(Operation op, const QNetw
         VERIFY2_RET(originalReq.hasRawHeader("Authorization"), "Missing Auth token header!", new FakeNetworkReply(op, originalReq));
     }
 
+    namFactory->setLastRequest(originalReq, {});
     COMPARE_RET(scenario.requestUrl, originalReq.url(), new FakeNetworkReply(op, originalReq));
     if (op != QNetworkAccessManager::CustomOperation) {
         COMPARE_RET(scenario.requestMethod, op, new FakeNetworkReply(op, originalReq));
@@ -51,7 +52,10 @@ QNetworkReply *FakeNetworkAccessManager::createRequest(Operation op, const QNetw
 
     if (outgoingData) {
         const auto actualRequest = outgoingData->readAll();
-        if (actualRequest.startsWith('<')) {
+        namFactory->setLastRequest(originalReq, actualRequest);
+        if (!scenario.matchRequestData) {
+            // Checked by the test
+        } else if (actualRequest.startsWith('<')) {
             const auto formattedInput = reformatXML(actualRequest);
             const auto formattedExpected = reformatXML(scenario.requestData);
             if (formattedInput != formattedExpected) {
@@ -70,7 +74,7 @@ QNetworkReply *FakeNetworkAccessManager::createRequest(Operation op, const QNetw
         }
     }
 
-    return new FakeNetworkReply(scenario);
+    return new FakeNetworkReply(scenario, originalReq);
 }
 
 #include "moc_fakenetworkaccessmanager.cpp"
@@ -9,6 +9,7 @@
 #include <QByteArray>
 #include <QList>
 #include <QNetworkAccessManager>
+#include <QNetworkReply>
 #include <QUrl>
 
 class FakeNetworkAccessManager : public QNetworkAccessManager
@@ -45,6 +46,11 @@ public:
         QList<QPair<QByteArray, QByteArray>> responseHeaders;
         QByteArray responseData;
         bool needsAuth = true;
+        // Random request data, see FakeNetworkAccessManagerFactory::lastRequestData()
+        bool matchRequestData = true;
+        // Fails the reply after the response data, e.g. with a TimeoutError;
+        // there is no HTTP status unless responseCode is set
+        QNetworkReply::NetworkError networkError = QNetworkReply::NoError;
     };
 
     explicit FakeNetworkAccessManager(QObject *parent = nullptr);
@@ -26,6 +26,22 @@ FakeNetworkAccessManager::Scenario FakeNetworkAccessManagerFactory::nextScenario
     return mScenarios.takeFirst();
 }
 
+QNetworkRequest FakeNetworkAccessManagerFactory::lastRequest() const
+{
+    return mLastRequest;
+}
+
+QByteArray FakeNetworkAccessManagerFactory::lastRequestData() const
+{
+    return mLastRequestData;
+}
+
+void FakeNetworkAccessManagerFactory::setLastRequest(const QNetworkRequest &request, const QByteArray &data)
+{
+    mLastRequest = request;
+    mLastRequestData = data;
+}
+
 QNetworkAccessManager *FakeNetworkAccessManagerFactory::networkAccessManager(QObject *parent) const
 {
     return new FakeNetworkAccessManager(parent);
@@ -10,6 +10,7 @@
 #include "fakenetworkaccessmanager.h"
 
 #include <QList>
+#include <QNetworkRequest>
 
 class FakeNetworkAccessManagerFactory : public KGAPI2::NetworkAccessManagerFactory
 {
@@ -22,8 +23,15 @@ public:
     bool hasScenario() const;
     FakeNetworkAccessManager::Scenario nextScenario();
 
+    // The last request received by any of the managers and its data
+    QNetworkRequest lastRequest() const;
+    QByteArray lastRequestData() const;
+    void setLastRequest(const QNetworkRequest &request, const QByteArray &data);
+
     QNetworkAccessManager *networkAccessManager(QObject *parent = nullptr) const override;
 
 private:
     QList<FakeNetworkAccessManager::Scenario> mScenarios;
+    QNetworkRequest mLastRequest;
+    QByteArray mLastRequestData;
 };
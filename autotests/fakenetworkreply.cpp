@@ -7,12 +7,15 @@
 #include "fakenetworkreply.h"
 #include "types.h"
 
-FakeNetworkReply::FakeNetworkReply(const FakeNetworkAccessManager::Scenario &scenario)
+FakeNetworkReply::FakeNetworkReply(const FakeNetworkAccessManager::Scenario &scenario, const QNetworkRequest &originalRequest)
     : QNetworkReply()
 {
+    setRequest(originalRequest);
     setUrl(scenario.requestUrl);
     setOperation(scenario.requestMethod);
-    setAttribute(QNetworkRequest::HttpStatusCodeAttribute, scenario.responseCode);
+    if (scenario.networkError == QNetworkReply::NoError || scenario.responseCode > 0) {
+        setAttribute(QNetworkRequest::HttpStatusCodeAttribute, scenario.responseCode);
+    }
     setHeader(QNetworkRequest::ContentLengthHeader, scenario.responseData.size());
     if (scenario.responseData.startsWith('<')) {
         setHeader(QNetworkRequest::ContentTypeHeader, QStringLiteral("application/atom+xml"));
@@ -35,6 +38,10 @@ FakeNetworkReply::FakeNetworkReply(const FakeNetworkAccessManager::Scenario &sce
     open(QIODevice::ReadOnly);
     setFinished(true);
     QMetaObject::invokeMethod(this, "readyRead", Qt::QueuedConnection);
+    if (scenario.networkError != QNetworkReply::NoError) {
+        setError(scenario.networkError, QStringLiteral("Simulated network error"));
+        QMetaObject::invokeMethod(this, "errorOccurred", Qt::QueuedConnection, Q_ARG(QNetworkReply::NetworkError, scenario.networkError));
+    }
     QMetaObject::invokeMethod(this, "finished", Qt::QueuedConnection);
 }
 
@@ -17,7 +17,7 @@ class FakeNetworkReply : public QNetworkReply
 {
     Q_OBJECT
 public:
-    FakeNetworkReply(const FakeNetworkAccessManager::Scenario &scenario);
+    FakeNetworkReply(const FakeNetworkAccessManager::Scenario &scenario, const QNetworkRequest &originalRequest = QNetworkRequest());
     explicit FakeNetworkReply(QNetworkAccessManager::Operation operation, const QNetworkRequest &originalRequest);
 
     void abort() override;
@@ -6,12 +6,14 @@
 
 #include <QObject>
 #include <QTest>
+#include <QUrlQuery>
 
 #include "fakenetworkaccessmanagerfactory.h"
 #include "taskstestutils.h"
 #include "testutils.h"
 
 #include "account.h"
+#include "syncstatestore.h"
 #include "task.h"
 #include "taskfetchjob.h"
 #include "types.h"
@@ -21,6 +23,24 @@ using namespace KGAPI2;
 Q_DECLARE_METATYPE(QList<FakeNetworkAccessManager::Scenario>)
 Q_DECLARE_METATYPE(KGAPI2::TasksList)
 
+namespace
+{
+FakeNetworkAccessManager::Scenario updatedTasksScenario(const QDateTime &updatedMin, const QByteArray &serverDate)
+{
+    QUrl url(QStringLiteral("https://www.googleapis.com/tasks/v1/lists/MockAccount/tasks"));
+    QUrlQuery query;
+    query.addQueryItem(QStringLiteral("showDeleted"), QStringLiteral("true"));
+    query.addQueryItem(QStringLiteral("showCompleted"), QStringLiteral("true"));
+    query.addQueryItem(QStringLiteral("updatedMin"), updatedMin.toUTC().toString(Qt::ISODate));
+    query.addQueryItem(QStringLiteral("prettyPrint"), QStringLiteral("false"));
+    url.setQuery(query);
+
+    FakeNetworkAccessManager::Scenario scenario(url, QNetworkAccessManager::GetOperation, {}, KGAPI2::OK, R"({"kind": "tasks#tasks", "items": []})");
+    scenario.responseHeaders = {{"Date", serverDate}};
+    return scenario;
+}
+}
+
 class TaskFetchJobTest : public QObject
 {
     Q_OBJECT
@@ -67,6 +87,40 @@ private Q_SLOTS:
         QVERIFY(returnedTask);
         QCOMPARE(*returnedTask, *task);
     }
+
+    void testSyncStateStore()
+    {
+        const QDateTime stored({2026, 10, 1}, {12, 0, 0}, QTimeZone::UTC);
+        const QDateTime explicitlySet({2026, 9, 1}, {12, 0, 0}, QTimeZone::UTC);
+        const QDateTime serverTime({2026, 10, 14}, {10, 0, 0}, QTimeZone::UTC);
+
+        MemorySyncStateStore store;
+        const auto key = QStringLiteral("MockAccount/tasks");
+        store.commit(key, QString::number(stored.toSecsSinceEpoch()));
+        auto account = AccountPtr::create(QStringLiteral("MockAccount"), QStringLiteral("MockToken"));
+
+        // The explicitly set timestamp wins over the stored one and is kept
+        FakeNetworkAccessManagerFactory::get()->setScenarios({updatedTasksScenario(explicitlySet, "Wed, 14 Oct 2026 10:00:00 GMT")});
+        auto job = new TaskFetchJob(QStringLiteral("MockAccount"), account);
+        job->setSyncStateStore(&store, key);
+        job->setFetchOnlyUpdated(explicitlySet.toSecsSinceEpoch());
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->fetchOnlyUpdated(), quint64(explicitlySet.toSecsSinceEpoch()));
+
+        // The stored state comes from the time of the server, not of the client
+        const auto syncState = QString::number(serverTime.addSecs(-5 * 60).toSecsSinceEpoch());
+        QTRY_COMPARE(store.load(key), syncState);
+
+        // The stored timestamp is used when none is set, without setting it
+        FakeNetworkAccessManagerFactory::get()->setScenarios({updatedTasksScenario(serverTime.addSecs(-5 * 60), "Wed, 14 Oct 2026 11:00:00 GMT")});
+        job = new TaskFetchJob(QStringLiteral("MockAccount"), account);
+        job->setSyncStateStore(&store, key);
+        QVERIFY(execJob(job));
+        QCOMPARE(job->error(), KGAPI2::NoError);
+        QCOMPARE(job->fetchOnlyUpdated(), quint64(0));
+        QTRY_COMPARE(store.load(key), QString::number(serverTime.addSecs(55 * 60).toSecsSinceEpoch()));
+    }
 };
 
 QTEST_GUILESS_MAIN(TaskFetchJobTest)
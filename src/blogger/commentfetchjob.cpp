@@ -25,7 +25,6 @@ public:
     const QString blogId;
     const QString postId;
     const QString commentId;
-    uint maxResults;
     QDateTime startDate;
     QDateTime endDate;
     bool fetchBodies;
@@ -38,7 +37,6 @@ CommentFetchJob::Private::Private(const QString &blogId_, const QString &postId_
     : blogId(blogId_)
     , postId(postId_)
     , commentId(commentId_)
-    , maxResults(0)
     , fetchBodies(true)
     , q(parent)
 {
@@ -52,12 +50,14 @@ CommentFetchJob::CommentFetchJob(const QString &blogId, const AccountPtr &accoun
     : FetchJob(account, parent)
     , d(new Private(blogId, QString(), QString(), this))
 {
+    setPageSizeParameter(QStringLiteral("maxResults"));
 }
 
 CommentFetchJob::CommentFetchJob(const QString &blogId, const QString &postId, const AccountPtr &account, QObject *parent)
     : FetchJob(account, parent)
     , d(new Private(blogId, postId, QString(), this))
 {
+    setPageSizeParameter(QStringLiteral("maxResults"));
 }
 
 CommentFetchJob::CommentFetchJob(const QString &blogId, const QString &postId, const QString &commentId, const AccountPtr &account, QObject *parent)
@@ -93,12 +93,13 @@ void CommentFetchJob::setStartDate(const QDateTime &startDate)
 
 uint CommentFetchJob::maxResults() const
 {
-    return d->maxResults;
+    return pageSize();
 }
 
 void CommentFetchJob::setMaxResults(uint maxResults)
 {
-    d->maxResults = maxResults;
+    // maxResults is the page size parameter, FetchJob sets it on every page
+    setPageSize(maxResults);
 }
 
 bool CommentFetchJob::fetchBodies() const
@@ -121,9 +122,6 @@ void CommentFetchJob::start()
     if (d->endDate.isValid()) {
         query.addQueryItem(QStringLiteral("endDate"), d->endDate.toString(Qt::ISODate));
     }
-    if (d->maxResults > 0) {
-        query.addQueryItem(QStringLiteral("maxResults"), QString::number(d->maxResults));
-    }
     query.addQueryItem(QStringLiteral("fetchBodies"), Utils::bool2Str(d->fetchBodies));
     if (account()) {
         query.addQueryItem(QStringLiteral("view"), QStringLiteral("ADMIN"));
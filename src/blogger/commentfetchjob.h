@@ -26,6 +26,9 @@ class KGAPIBLOGGER_EXPORT CommentFetchJob : public KGAPI2::FetchJob
 
     Q_PROPERTY(bool fetchBodies READ fetchBodies WRITE setFetchBodies)
 
+    /**
+     * Maximum number of results per page, same as FetchJob::pageSize.
+     */
     Q_PROPERTY(uint maxResults READ maxResults WRITE setMaxResults)
 
 public:
@@ -26,7 +26,6 @@ public:
 
     bool fetchBodies = true;
     bool fetchImages = true;
-    uint maxResults = 0;
     QStringList filterLabels;
     QDateTime startDate;
     QDateTime endDate;
@@ -47,6 +46,7 @@ PostFetchJob::PostFetchJob(const QString &blogId, const AccountPtr &account, QOb
     : FetchJob(account, parent)
     , d(new Private(blogId, QString(), this))
 {
+    setPageSizeParameter(QStringLiteral("maxResults"));
 }
 
 PostFetchJob::PostFetchJob(const QString &blogId, const QString &postId, const AccountPtr &account, QObject *parent)
@@ -82,12 +82,13 @@ void PostFetchJob::setFetchImages(bool fetchImages)
 
 uint PostFetchJob::maxResults() const
 {
-    return d->maxResults;
+    return pageSize();
 }
 
 void PostFetchJob::setMaxResults(uint maxResults)
 {
-    d->maxResults = maxResults;
+    // maxResults is the page size parameter, FetchJob sets it on every page
+    setPageSize(maxResults);
 }
 
 QStringList PostFetchJob::filterLabels() const
@@ -141,9 +142,6 @@ void PostFetchJob::start()
         if (d->endDate.isValid()) {
             query.addQueryItem(QStringLiteral("endDate"), d->endDate.toString(Qt::ISODate));
         }
-        if (d->maxResults > 0) {
-            query.addQueryItem(QStringLiteral("maxResults"), QString::number(d->maxResults));
-        }
         if (!d->filterLabels.isEmpty()) {
             query.addQueryItem(QStringLiteral("labels"), d->filterLabels.join(QLatin1Char(',')));
         }
@@ -26,6 +26,9 @@ class KGAPIBLOGGER_EXPORT PostFetchJob : public KGAPI2::FetchJob
 
     Q_PROPERTY(bool fetchImages READ fetchImages WRITE setFetchImages)
 
+    /**
+     * Maximum number of results per page, same as FetchJob::pageSize.
+     */
     Q_PROPERTY(uint maxResults READ maxResults WRITE setMaxResults)
 
     Q_PROPERTY(QStringList filterLabels READ filterLabels WRITE setFilterLabels)
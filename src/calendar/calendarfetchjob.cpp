@@ -28,6 +28,7 @@ CalendarFetchJob::CalendarFetchJob(const AccountPtr &account, QObject *parent)
     : FetchJob(account, parent)
     , d(new Private())
 {
+    setPageSizeParameter(QStringLiteral("maxResults"), 250);
 }
 
 CalendarFetchJob::CalendarFetchJob(const QString &calendarId, const AccountPtr &account, QObject *parent)
@@ -9,6 +9,7 @@
 #include "calendarservice.h"
 #include "calendar.h"
 #include "debug.h"
+#include "private/jsonwriter_p.h"
 #include "reminder.h"
 #include "utils.h"
 
@@ -21,6 +22,7 @@
 #include <KCalendarCore/RecurrenceRule>
 
 #include <QJsonDocument>
+#include <QJsonObject>
 #include <QNetworkRequest>
 #include <QTimeZone>
 #include <QUrlQuery>
@@ -122,6 +124,13 @@ QUrl fetchEventUrl(const QString &calendarID, const QString &eventID)
     return url;
 }
 
+QUrl fetchEventInstancesUrl(const QString &calendarID, const QString &eventID)
+{
+    QUrl url(Private::GoogleApisUrl);
+    url.setPath(Private::CalendarBasePath % QLatin1Char('/') % calendarID % QLatin1StringView("/events/") % eventID % QLatin1StringView("/instances"));
+    return url;
+}
+
 namespace
 {
 
@@ -196,6 +205,41 @@ QUrl freeBusyQueryUrl()
     return url;
 }
 
+QUrl batchUrl()
+{
+    QUrl url(Private::GoogleApisUrl);
+    url.setPath(QStringLiteral("/batch/calendar/v3"));
+    return url;
+}
+
+QUrl watchEventsUrl(const QString &calendarID)
+{
+    QUrl url(Private::GoogleApisUrl);
+    url.setPath(Private::CalendarBasePath % QLatin1Char('/') % calendarID % QLatin1StringView("/events/watch"));
+    return url;
+}
+
+QUrl stopChannelUrl()
+{
+    QUrl url(Private::GoogleApisUrl);
+    url.setPath(QStringLiteral("/calendar/v3/channels/stop"));
+    return url;
+}
+
+QUrl fetchColorsUrl()
+{
+    QUrl url(Private::GoogleApisUrl);
+    url.setPath(QStringLiteral("/calendar/v3/colors"));
+    return url;
+}
+
+QUrl fetchSettingsUrl()
+{
+    QUrl url(Private::GoogleApisUrl);
+    url.setPath(QStringLiteral("/calendar/v3/users/me/settings"));
+    return url;
+}
+
 namespace
 {
 
@@ -611,182 +655,222 @@ namespace
 enum class SerializeDtFlag { AllDay = 1 << 0, IsDtEnd = 1 << 1, HasRecurrence = 1 << 2 };
 using SerializeDtFlags = QFlags<SerializeDtFlag>;
 
-QVariantMap serializeDt(const EventPtr &event, const QDateTime &dt, SerializeDtFlags flags)
+void writeDt(JsonWriter &writer, const QString &key, const EventPtr &event, const QDateTime &dt, SerializeDtFlags flags)
 {
-    QVariantMap rv;
+    writer.beginObject(key);
     if (flags & SerializeDtFlag::AllDay) {
         /* For Google, all-day events starts on Monday and ends on Tuesday,
          * while in KDE, it both starts and ends on Monday. */
         const auto adjusted = dt.addDays((flags & SerializeDtFlag::IsDtEnd) ? 1 : 0);
-        rv.insert(dateParam, adjusted.toString(QStringLiteral("yyyy-MM-dd")));
+        writer.insert(dateParam, adjusted.toString(QStringLiteral("yyyy-MM-dd")));
     } else {
-        rv.insert(dateTimeParam, Utils::rfc3339DateToString(dt));
+        writer.insert(dateTimeParam, Utils::rfc3339DateToString(dt));
         QString tzEnd = QString::fromUtf8(dt.timeZone().id());
         if (flags & SerializeDtFlag::HasRecurrence && tzEnd.isEmpty()) {
             tzEnd = QString::fromUtf8(QTimeZone::utc().id());
         }
         if (!tzEnd.isEmpty()) {
-            rv.insert(timeZoneParam, Private::checkAndConverCDOTZID(tzEnd, event));
+            writer.insert(timeZoneParam, Private::checkAndConverCDOTZID(tzEnd, event));
         }
     }
-
-    return rv;
+    writer.endObject();
 }
 
 } // namespace
 
 QByteArray eventToJSON(const EventPtr &event, EventSerializeFlags flags)
 {
-    QVariantMap data;
+    JsonWriter writer;
+    writer.beginObject();
 
-    data.insert(kindParam, eventKind);
+    writer.insert(kindParam, eventKind);
 
     if (!(flags & EventSerializeFlag::NoID)) {
-        data.insert(idParam, event->id());
+        writer.insert(idParam, event->id());
     }
 
-    data.insert(eventiCalUIDParam, event->uid());
+    writer.insert(eventiCalUIDParam, event->uid());
 
     if (event->status() == KCalendarCore::Incidence::StatusConfirmed) {
-        data.insert(eventStatusParam, confirmedStatus);
+        writer.insert(eventStatusParam, confirmedStatus);
     } else if (event->status() == KCalendarCore::Incidence::StatusCanceled) {
-        data.insert(eventStatusParam, canceledStatus);
+        writer.insert(eventStatusParam, canceledStatus);
     } else if (event->status() == KCalendarCore::Incidence::StatusTentative) {
-        data.insert(eventStatusParam, tentativeStatus);
+        writer.insert(eventStatusParam, tentativeStatus);
     }
 
-    data.insert(eventSummaryParam, event->summary());
-    data.insert(eventDescriptionParam, event->description());
-    data.insert(eventLocationParam, event->location());
+    writer.insert(eventSummaryParam, event->summary());
+    writer.insert(eventDescriptionParam, event->description());
+    writer.insert(eventLocationParam, event->location());
 
-    QVariantList recurrence;
     KCalendarCore::ICalFormat format;
     const auto exRules = event->recurrence()->exRules();
     const auto rRules = event->recurrence()->rRules();
-    recurrence.reserve(rRules.size() + rRules.size() + 2);
-    for (KCalendarCore::RecurrenceRule *rRule : rRules) {
-        recurrence.push_back(format.toString(rRule).remove(QStringLiteral("\r\n")));
-    }
-    for (KCalendarCore::RecurrenceRule *rRule : exRules) {
-        recurrence.push_back(format.toString(rRule).remove(QStringLiteral("\r\n")));
-    }
-
-    QStringList dates;
     const auto rDates = event->recurrence()->rDates();
-    dates.reserve(rDates.size());
-    for (const auto &rDate : rDates) {
-        dates.push_back(rDate.toString(QStringLiteral("yyyyMMdd")));
-    }
-
-    if (!dates.isEmpty()) {
-        recurrence.push_back(QString(QStringLiteral("RDATE;VALUE=DATA:") + dates.join(QLatin1Char(','))));
-    }
-
-    dates.clear();
     const auto exDates = event->recurrence()->exDates();
-    dates.reserve(exDates.size());
-    for (const auto &exDate : exDates) {
-        dates.push_back(exDate.toString(QStringLiteral("yyyyMMdd")));
-    }
+    const bool hasRecurrence = !rRules.isEmpty() || !exRules.isEmpty() || !rDates.isEmpty() || !exDates.isEmpty();
+    if (hasRecurrence) {
+        writer.beginArray(eventRecurrenceParam);
+        for (KCalendarCore::RecurrenceRule *rRule : rRules) {
+            writer.value(format.toString(rRule).remove(QStringLiteral("\r\n")));
+        }
+        for (KCalendarCore::RecurrenceRule *rRule : exRules) {
+            writer.value(format.toString(rRule).remove(QStringLiteral("\r\n")));
+        }
 
-    if (!dates.isEmpty()) {
-        recurrence.push_back(QString(QStringLiteral("EXDATE;VALUE=DATE:") + dates.join(QLatin1Char(','))));
-    }
+        QStringList dates;
+        dates.reserve(rDates.size());
+        for (const auto &rDate : rDates) {
+            dates.push_back(rDate.toString(QStringLiteral("yyyyMMdd")));
+        }
+        if (!dates.isEmpty()) {
+            writer.value(QString(QStringLiteral("RDATE;VALUE=DATA:") + dates.join(QLatin1Char(','))));
+        }
 
-    if (!recurrence.isEmpty()) {
-        data.insert(eventRecurrenceParam, recurrence);
+        dates.clear();
+        dates.reserve(exDates.size());
+        for (const auto &exDate : exDates) {
+            dates.push_back(exDate.toString(QStringLiteral("yyyyMMdd")));
+        }
+        if (!dates.isEmpty()) {
+            writer.value(QString(QStringLiteral("EXDATE;VALUE=DATE:") + dates.join(QLatin1Char(','))));
+        }
+        writer.endArray();
     }
 
     SerializeDtFlags dtFlags;
     if (event->allDay()) {
         dtFlags |= SerializeDtFlag::AllDay;
     }
-    if (!recurrence.isEmpty()) {
+    if (hasRecurrence) {
         dtFlags |= SerializeDtFlag::HasRecurrence;
     }
 
-    data.insert(eventStartPram, serializeDt(event, event->dtStart(), dtFlags));
-    data.insert(eventEndParam, serializeDt(event, event->dtEnd(), dtFlags | SerializeDtFlag::IsDtEnd));
+    writeDt(writer, eventStartPram, event, event->dtStart(), dtFlags);
+    writeDt(writer, eventEndParam, event, event->dtEnd(), dtFlags | SerializeDtFlag::IsDtEnd);
+
+    const auto attendees = event->attendees();
+    /* According to RFC, event without attendees should not have
+     * any organizer. */
+    const auto organizer = event->organizer();
+    const bool writeOrganizer = !attendees.isEmpty() && !organizer.isEmpty();
 
     if (event->hasRecurrenceId()) {
-        data.insert(eventOrganizerParam, serializeDt(event, event->recurrenceId(), dtFlags));
-        data.insert(eventRecurringEventIdParam, event->id());
+        if (!writeOrganizer) {
+            writeDt(writer, eventOrganizerParam, event, event->recurrenceId(), dtFlags);
+        }
+        writer.insert(eventRecurringEventIdParam, event->id());
     }
 
     if (event->transparency() == Event::Transparent) {
-        data.insert(eventTransparencyParam, transparentTransparency);
+        writer.insert(eventTransparencyParam, transparentTransparency);
     } else {
-        data.insert(eventTransparencyParam, opaqueTransparency);
+        writer.insert(eventTransparencyParam, opaqueTransparency);
     }
 
-    QVariantList atts;
-    const auto attendees = event->attendees();
-    for (const auto &attee : attendees) {
-        QVariantMap att{{attendeeDisplayNameParam, attee.name()}, {attendeeEmailParam, attee.email()}};
-
-        if (attee.status() == KCalendarCore::Attendee::Accepted) {
-            att.insert(attendeeResponseStatusParam, acceptedStatus);
-        } else if (attee.status() == KCalendarCore::Attendee::Declined) {
-            att.insert(attendeeResponseStatusParam, declinedStatus);
-        } else if (attee.status() == KCalendarCore::Attendee::Tentative) {
-            att.insert(attendeeResponseStatusParam, tentativeStatus);
-        } else {
-            att.insert(attendeeResponseStatusParam, needsActionStatus);
-        }
+    if (!attendees.isEmpty()) {
+        writer.beginArray(eventAttendeesParam);
+        for (const auto &attee : attendees) {
+            writer.beginObject();
+            writer.insert(attendeeDisplayNameParam, attee.name());
+            writer.insert(attendeeEmailParam, attee.email());
+
+            if (attee.status() == KCalendarCore::Attendee::Accepted) {
+                writer.insert(attendeeResponseStatusParam, acceptedStatus);
+            } else if (attee.status() == KCalendarCore::Attendee::Declined) {
+                writer.insert(attendeeResponseStatusParam, declinedStatus);
+            } else if (attee.status() == KCalendarCore::Attendee::Tentative) {
+                writer.insert(attendeeResponseStatusParam, tentativeStatus);
+            } else {
+                writer.insert(attendeeResponseStatusParam, needsActionStatus);
+            }
 
-        if (attee.role() == KCalendarCore::Attendee::OptParticipant) {
-            att.insert(attendeeOptionalParam, true);
-        }
-        if (!attee.uid().isEmpty()) {
-            att.insert(idParam, attee.uid());
+            if (attee.role() == KCalendarCore::Attendee::OptParticipant) {
+                writer.insert(attendeeOptionalParam, true);
+            }
+            if (!attee.uid().isEmpty()) {
+                writer.insert(idParam, attee.uid());
+            }
+            writer.endObject();
         }
-        atts.append(att);
-    }
-
-    if (!atts.isEmpty()) {
-        data.insert(eventAttendeesParam, atts);
+        writer.endArray();
 
-        /* According to RFC, event without attendees should not have
-         * any organizer. */
-        const auto organizer = event->organizer();
-        if (!organizer.isEmpty()) {
-            data.insert(eventOrganizerParam, QVariantMap{{organizerDisplayNameParam, organizer.fullName()}, {organizerEmailParam, organizer.email()}});
+        if (writeOrganizer) {
+            writer.beginObject(eventOrganizerParam);
+            writer.insert(organizerDisplayNameParam, organizer.fullName());
+            writer.insert(organizerEmailParam, organizer.email());
+            writer.endObject();
         }
     }
 
-    QVariantList overrides;
+    writer.beginObject(eventRemindersParam);
+    writer.insert(reminderUseDefaultParam, false);
+    writer.beginArray(reminderOverridesParam);
     const auto alarms = event->alarms();
     for (const auto &alarm : alarms) {
-        QVariantMap reminderOverride;
+        QString method;
         if (alarm->type() == KCalendarCore::Alarm::Display) {
-            reminderOverride.insert(reminderMethodParam, popupMethod);
+            method = popupMethod;
         } else if (alarm->type() == KCalendarCore::Alarm::Email) {
-            reminderOverride.insert(reminderMethodParam, emailMethod);
+            method = emailMethod;
         } else {
             continue;
         }
-        reminderOverride.insert(reminderMinutesParam, (int)(alarm->startOffset().asSeconds() / -60));
-
-        overrides.push_back(reminderOverride);
+        writer.beginObject();
+        writer.insert(reminderMethodParam, method);
+        writer.insert(reminderMinutesParam, (int)(alarm->startOffset().asSeconds() / -60));
+        writer.endObject();
     }
-
-    data.insert(eventRemindersParam, QVariantMap{{reminderUseDefaultParam, false}, {reminderOverridesParam, overrides}});
+    writer.endArray();
+    writer.endObject();
 
     if (!event->categories().isEmpty()) {
-        data.insert(eventExtendedPropertiesParam, QVariantMap{{propertySharedParam, QVariantMap{{categoriesProperty, event->categoriesStr()}}}});
+        writer.beginObject(eventExtendedPropertiesParam);
+        writer.beginObject(propertySharedParam);
+        writer.insert(categoriesProperty, event->categoriesStr());
+        writer.endObject();
+        writer.endObject();
     }
 
     // eventType not allowed in update, only in create
-    if (!data.contains(idParam)) {
-        data.insert(eventTypeParam, eventTypeToString(event->eventType()));
+    if (flags & EventSerializeFlag::NoID) {
+        writer.insert(eventTypeParam, eventTypeToString(event->eventType()));
     }
 
     /* TODO: Implement support for additional features:
      * https://developers.google.com/calendar/api/v3/reference/events/insert
      */
 
-    const auto document = QJsonDocument::fromVariant(data);
-    return document.toJson(QJsonDocument::Compact);
+    writer.endObject();
+    return writer.data();
+}
+
+QByteArray eventToJSONPatch(const EventPtr &modified, const EventPtr &original)
+{
+    const QJsonObject modifiedData = QJsonDocument::fromJson(eventToJSON(modified, EventSerializeFlag::Default)).object();
+    const QJsonObject originalData = QJsonDocument::fromJson(eventToJSON(original, EventSerializeFlag::Default)).object();
+
+    // The diff is done on the top-level properties only, nested objects and
+    // lists (start, attendees, reminders, ...) are sent whole when changed.
+    QJsonObject patch;
+    for (auto it = modifiedData.constBegin(), end = modifiedData.constEnd(); it != end; ++it) {
+        if (it.key() == kindParam || it.key() == idParam) {
+            continue;
+        }
+        const auto originalIt = originalData.constFind(it.key());
+        if (originalIt == originalData.constEnd() || originalIt.value() != it.value()) {
+            patch.insert(it.key(), it.value());
+        }
+    }
+    // Properties no longer present in the modified event must be explicitly
+    // cleared, PATCH leaves properties missing in the request untouched.
+    for (auto it = originalData.constBegin(), end = originalData.constEnd(); it != end; ++it) {
+        if (!modifiedData.contains(it.key())) {
+            patch.insert(it.key(), QJsonValue::Null);
+        }
+    }
+
+    return QJsonDocument(patch).toJson(QJsonDocument::Compact);
 }
 
 ObjectsList parseEventJSONFeed(const QByteArray &jsonFeed, FeedData &feedData)
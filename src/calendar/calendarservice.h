@@ -77,6 +77,19 @@ namespace CalendarService
      */
     KGAPICALENDAR_EXPORT QByteArray eventToJSON(const EventPtr& event, EventSerializeFlags flags = EventSerializeFlag::Default);
 
+    /**
+     * @brief Serializes changes between two versions of an Event into JSON
+     *
+     * Only properties that differ between @p modified and @p original are
+     * included, properties removed in @p modified are set to null. The
+     * result is suitable as a body of a PATCH request.
+     *
+     * @param modified The modified event
+     * @param original The event as last fetched from the server
+     * @since 6.4
+     */
+    KGAPICALENDAR_EXPORT QByteArray eventToJSONPatch(const EventPtr &modified, const EventPtr &original);
+
     /**
      * @brief Parses JSON feed into list of Events
      *
@@ -147,6 +160,16 @@ namespace CalendarService
      */
     KGAPICALENDAR_EXPORT QUrl fetchEventUrl(const QString &calendarID, const QString &eventID);
 
+    /**
+     * @brief Returns URL for fetching instances of a recurring event.
+     *
+     * @param calendarID ID of calendar in which the event is
+     * @param eventID ID of the recurring event
+     *
+     * @since 6.4
+     */
+    KGAPICALENDAR_EXPORT QUrl fetchEventInstancesUrl(const QString &calendarID, const QString &eventID);
+
     /**
      * @brief Returns URL for updating a single event
      *
@@ -195,6 +218,46 @@ namespace CalendarService
      */
     KGAPICALENDAR_EXPORT QUrl freeBusyQueryUrl();
 
+    /**
+     * @brief Returns URL of the batch endpoint
+     *
+     * Up to 50 Calendar API calls can be sent in a single multipart/mixed
+     * request to this URL.
+     *
+     * @since 6.4
+     */
+    KGAPICALENDAR_EXPORT QUrl batchUrl();
+
+    /**
+     * @brief Returns URL for watching changes of events in a calendar
+     *
+     * @param calendarID ID of calendar to watch
+     *
+     * @since 6.4
+     */
+    KGAPICALENDAR_EXPORT QUrl watchEventsUrl(const QString &calendarID);
+
+    /**
+     * @brief Returns URL for stopping push notification channels
+     *
+     * @since 6.4
+     */
+    KGAPICALENDAR_EXPORT QUrl stopChannelUrl();
+
+    /**
+     * @brief Returns URL for fetching color palettes of calendars and events
+     *
+     * @since 6.4
+     */
+    KGAPICALENDAR_EXPORT QUrl fetchColorsUrl();
+
+    /**
+     * @brief Returns URL for fetching settings of the user's calendar
+     *
+     * @since 6.4
+     */
+    KGAPICALENDAR_EXPORT QUrl fetchSettingsUrl();
+
 } // namespace CalendarService
 
 } // namespace KGAPI
@@ -0,0 +1,200 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "calendarsyncjob.h"
+#include "debug.h"
+#include "event.h"
+#include "eventfetchjob.h"
+#include "syncstatestore.h"
+
+#include <QQueue>
+
+using namespace KGAPI2;
+
+class Q_DECL_HIDDEN CalendarSyncJob::Private
+{
+public:
+    Private(CalendarSyncJob *parent)
+        : q(parent)
+    {
+    }
+
+    void startNext()
+    {
+        while (runningJobs < maxParallelJobs && !pendingCalendars.isEmpty()) {
+            const QString calendarId = pendingCalendars.dequeue();
+            QString syncToken = syncTokens.value(calendarId);
+
+            auto job = new EventFetchJob(calendarId, q->account(), q);
+            if (syncStateStore) {
+                const QString key = syncStateKeyPrefix + calendarId;
+                if (syncToken.isEmpty()) {
+                    syncToken = syncStateStore->load(key);
+                    syncTokens[calendarId] = syncToken;
+                }
+                // The fetch job commits the new token only after
+                // calendarSynced() has been handled
+                job->setSyncStateStore(syncStateStore, key);
+            }
+            if (!syncToken.isEmpty()) {
+                job->setSyncToken(syncToken);
+            }
+            // Deleted events must be reported, otherwise the client cannot
+            // remove them from its local copy.
+            job->setFetchDeleted(true);
+            QObject::connect(job, &Job::finished, q, [this, calendarId](Job *job) {
+                jobFinished(calendarId, static_cast<EventFetchJob *>(job));
+            });
+            ++runningJobs;
+        }
+    }
+
+    void jobFinished(const QString &calendarId, EventFetchJob *job)
+    {
+        --runningJobs;
+
+        SyncResult &result = results[calendarId];
+        result.error = job->error();
+        result.errorString = job->errorString();
+        if (job->error() == KGAPI2::NoError) {
+            const ObjectsList items = job->items();
+            result.events.reserve(items.size());
+            for (const ObjectPtr &item : items) {
+                result.events << item.dynamicCast<Event>();
+            }
+            result.syncToken = job->syncToken();
+            result.fullSync = syncTokens.value(calendarId).isEmpty() || job->syncTokenExpired();
+        } else {
+            ++failedCalendars;
+            lastError = job->error();
+            lastErrorString = job->errorString();
+        }
+        job->deleteLater();
+
+        ++processedCalendars;
+        q->emitProgress(processedCalendars, syncTokens.size());
+        Q_EMIT q->calendarSynced(q, calendarId);
+
+        if (processedCalendars < syncTokens.size()) {
+            startNext();
+            return;
+        }
+
+        if (failedCalendars == syncTokens.size()) {
+            q->setError(lastError);
+            q->setErrorString(lastErrorString);
+        }
+        q->emitFinished();
+    }
+
+    QMap<QString, QString> syncTokens;
+    QMap<QString, SyncResult> results;
+    SyncStateStore *syncStateStore = nullptr;
+    QString syncStateKeyPrefix;
+    QQueue<QString> pendingCalendars;
+    int maxParallelJobs = 4;
+    int runningJobs = 0;
+    int processedCalendars = 0;
+    int failedCalendars = 0;
+    KGAPI2::Error lastError = KGAPI2::NoError;
+    QString lastErrorString;
+
+private:
+    CalendarSyncJob *const q;
+};
+
+CalendarSyncJob::CalendarSyncJob(const QMap<QString, QString> &syncTokens, const AccountPtr &account, QObject *parent)
+    : Job(account, parent)
+    , d(new Private(this))
+{
+    d->syncTokens = syncTokens;
+}
+
+CalendarSyncJob::~CalendarSyncJob() = default;
+
+void CalendarSyncJob::setMaxParallelJobs(int maxParallelJobs)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify maxParallelJobs property when job is running";
+        return;
+    }
+
+    d->maxParallelJobs = qMax(1, maxParallelJobs);
+}
+
+int CalendarSyncJob::maxParallelJobs() const
+{
+    return d->maxParallelJobs;
+}
+
+void CalendarSyncJob::setSyncStateStore(SyncStateStore *store, const QString &keyPrefix)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify syncStateStore property when job is running";
+        return;
+    }
+
+    d->syncStateStore = store;
+    d->syncStateKeyPrefix = keyPrefix;
+}
+
+SyncStateStore *CalendarSyncJob::syncStateStore() const
+{
+    return d->syncStateStore;
+}
+
+QStringList CalendarSyncJob::calendarIds() const
+{
+    return d->syncTokens.keys();
+}
+
+CalendarSyncJob::SyncResult CalendarSyncJob::result(const QString &calendarId) const
+{
+    return d->results.value(calendarId);
+}
+
+QMap<QString, CalendarSyncJob::SyncResult> CalendarSyncJob::results() const
+{
+    return d->results;
+}
+
+void CalendarSyncJob::start()
+{
+    d->results.clear();
+    d->pendingCalendars.clear();
+    d->runningJobs = 0;
+    d->processedCalendars = 0;
+    d->failedCalendars = 0;
+    d->lastError = KGAPI2::NoError;
+    d->lastErrorString.clear();
+
+    if (d->syncTokens.isEmpty()) {
+        emitFinished();
+        return;
+    }
+
+    for (auto it = d->syncTokens.cbegin(), end = d->syncTokens.cend(); it != end; ++it) {
+        d->pendingCalendars.enqueue(it.key());
+    }
+    d->startNext();
+}
+
+void CalendarSyncJob::dispatchRequest(QNetworkAccessManager * /*accessManager*/,
+                                      const QNetworkRequest & /*request*/,
+                                      const QByteArray & /*data*/,
+                                      const QString & /*contentType*/)
+{
+    // Should never be called.
+    Q_UNREACHABLE();
+}
+
+void CalendarSyncJob::handleReply(const QNetworkReply * /*reply*/, const QByteArray & /*rawData*/)
+{
+    // Should never be called.
+    Q_UNREACHABLE();
+}
@@ -0,0 +1,198 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "job.h"
+#include "kgapicalendar_export.h"
+#include "types.h"
+
+#include <QMap>
+#include <QScopedPointer>
+
+namespace KGAPI2
+{
+
+class SyncStateStore;
+
+/**
+ * @brief A job to incrementally synchronize events of multiple calendars
+ *
+ * The job runs one EventFetchJob per calendar, passing each calendar its
+ * own sync token, and keeps up to maxParallelJobs of them in flight at the
+ * same time, so synchronizing an account with many calendars takes roughly
+ * as long as its slowest calendar rather than the sum of all of them.
+ *
+ * Results are collected per calendar. A failure to synchronize one calendar
+ * does not abort synchronization of the others; the job itself only fails
+ * when none of the calendars could be synchronized.
+ *
+ * @since 6.4
+ */
+class KGAPICALENDAR_EXPORT CalendarSyncJob : public KGAPI2::Job
+{
+    Q_OBJECT
+
+    /**
+     * @brief Maximum number of calendars synchronized concurrently
+     *
+     * By default up to 4 calendars are synchronized at the same time.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @see setMaxParallelJobs, maxParallelJobs
+     */
+    Q_PROPERTY(int maxParallelJobs READ maxParallelJobs WRITE setMaxParallelJobs)
+
+public:
+    /**
+     * @brief Result of synchronization of a single calendar
+     */
+    struct SyncResult {
+        /**
+         * Events changed since the last synchronization, or all events when
+         * fullSync is @p true.
+         */
+        EventsList events;
+
+        /**
+         * Token to pass to the next synchronization of this calendar.
+         */
+        QString syncToken;
+
+        /**
+         * Whether the server rejected the sync token (or no token was given)
+         * and events contains the complete content of the calendar.
+         */
+        bool fullSync = false;
+
+        /**
+         * Error of the synchronization, KGAPI2::NoError on success.
+         */
+        KGAPI2::Error error = KGAPI2::NoError;
+
+        /**
+         * Human-readable error description.
+         */
+        QString errorString;
+    };
+
+    /**
+     * @brief Constructs a job that will synchronize events of given calendars
+     *
+     * @param syncTokens Maps ID of each calendar to synchronize to the sync
+     *        token obtained during its last synchronization. Use an empty
+     *        token to perform a full synchronization of the calendar.
+     * @param account Account to authenticate the requests
+     * @param parent
+     */
+    explicit CalendarSyncJob(const QMap<QString, QString> &syncTokens, const AccountPtr &account, QObject *parent = nullptr);
+
+    /**
+     * @brief Destructor
+     */
+    ~CalendarSyncJob() override;
+
+    /**
+     * @brief Sets maximum number of calendars synchronized concurrently
+     *
+     * @param maxParallelJobs Number of concurrent requests, at least 1.
+     */
+    void setMaxParallelJobs(int maxParallelJobs);
+
+    /**
+     * @brief Returns maximum number of calendars synchronized concurrently
+     */
+    [[nodiscard]] int maxParallelJobs() const;
+
+    /**
+     * @brief Sets a store to persist the sync tokens in
+     *
+     * Tokens of calendars that have an empty token in the map passed to the
+     * constructor are loaded from the store. The token of each calendar is
+     * stored under @p keyPrefix followed by the calendar ID and is committed
+     * only after the calendarSynced() signal for the calendar has been
+     * handled.
+     *
+     * The store is not owned by the job and must outlive it.
+     *
+     * @param store
+     * @param keyPrefix Prefix of the keys, typically identifying the account
+     *
+     * @see FetchJob::setSyncStateStore
+     */
+    void setSyncStateStore(SyncStateStore *store, const QString &keyPrefix);
+
+    /**
+     * @brief Returns the sync state store or a null pointer
+     */
+    [[nodiscard]] SyncStateStore *syncStateStore() const;
+
+    /**
+     * @brief Returns IDs of calendars synchronized by this job
+     */
+    [[nodiscard]] QStringList calendarIds() const;
+
+    /**
+     * @brief Returns synchronization result for given calendar
+     *
+     * The result is only valid after calendarSynced() has been emitted for
+     * the calendar.
+     *
+     * @param calendarId
+     */
+    [[nodiscard]] SyncResult result(const QString &calendarId) const;
+
+    /**
+     * @brief Returns synchronization results of all calendars
+     */
+    [[nodiscard]] QMap<QString, SyncResult> results() const;
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when synchronization of a single calendar has finished
+     *
+     * Use result() to retrieve the synchronized events, new sync token or
+     * the error.
+     *
+     * @param job The sync job
+     * @param calendarId ID of the calendar whose synchronization has finished
+     */
+    void calendarSynced(KGAPI2::CalendarSyncJob *job, const QString &calendarId);
+
+protected:
+    /**
+     * @brief KGAPI2::Job::start implementation
+     */
+    void start() override;
+
+    /**
+     * @brief KGAPI2::Job::dispatchRequest implementation
+     *
+     * @param accessManager
+     * @param request
+     * @param data
+     * @param contentType
+     */
+    void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType) override;
+
+    /**
+     * @brief KGAPI2::Job::handleReply implementation
+     *
+     * @param reply
+     * @param rawData
+     */
+    void handleReply(const QNetworkReply *reply, const QByteArray &rawData) override;
+
+private:
+    class Private;
+    QScopedPointer<Private> const d;
+    friend class Private;
+};
+
+} // namespace KGAPI2
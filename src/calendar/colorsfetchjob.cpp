@@ -0,0 +1,175 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "colorsfetchjob.h"
+#include "account.h"
+#include "calendarservice.h"
+#include "debug.h"
+#include "private/resourcecache_p.h"
+#include "utils.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+
+using namespace KGAPI2;
+
+namespace
+{
+static const auto colorsKind = QLatin1StringView("calendar#colors");
+
+struct Colors {
+    ColorsFetchJob::ColorDefinitions calendar;
+    ColorsFetchJob::ColorDefinitions event;
+    QDateTime updated;
+};
+
+ResourceCache<Colors> &colorsCache()
+{
+    static ResourceCache<Colors> cache;
+    return cache;
+}
+
+ColorsFetchJob::ColorDefinitions parseColorDefinitions(const QJsonObject &object)
+{
+    ColorsFetchJob::ColorDefinitions colors;
+    for (auto it = object.constBegin(), end = object.constEnd(); it != end; ++it) {
+        const auto definition = it.value().toObject();
+        colors.insert(it.key(),
+                      {QColor::fromString(definition.value(QLatin1StringView("background")).toString()),
+                       QColor::fromString(definition.value(QLatin1StringView("foreground")).toString())});
+    }
+    return colors;
+}
+} // namespace
+
+class Q_DECL_HIDDEN ColorsFetchJob::Private
+{
+public:
+    int maxCacheAge = 3600;
+    Colors colors;
+    std::optional<ResourceCache<Colors>::Entry> cached;
+    bool fromCache = false;
+};
+
+ColorsFetchJob::ColorsFetchJob(const AccountPtr &account, QObject *parent)
+    : FetchJob(account, parent)
+    , d(new Private)
+{
+}
+
+ColorsFetchJob::~ColorsFetchJob() = default;
+
+void ColorsFetchJob::setMaxCacheAge(int seconds)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify maxCacheAge property when job is running";
+        return;
+    }
+
+    d->maxCacheAge = seconds;
+}
+
+int ColorsFetchJob::maxCacheAge() const
+{
+    return d->maxCacheAge;
+}
+
+ColorsFetchJob::ColorDefinitions ColorsFetchJob::calendarColors() const
+{
+    return d->colors.calendar;
+}
+
+ColorsFetchJob::ColorDefinitions ColorsFetchJob::eventColors() const
+{
+    return d->colors.event;
+}
+
+QDateTime ColorsFetchJob::updated() const
+{
+    return d->colors.updated;
+}
+
+bool ColorsFetchJob::isFromCache() const
+{
+    return d->fromCache;
+}
+
+void ColorsFetchJob::clearCache()
+{
+    colorsCache().clear();
+}
+
+void ColorsFetchJob::start()
+{
+    d->fromCache = false;
+    d->colors = {};
+    d->cached.reset();
+
+    // The colors are cached by the name of the account
+    if (!account()) {
+        setError(KGAPI2::InvalidAccount);
+        setErrorString(tr("Invalid account"));
+        emitFinished();
+        return;
+    }
+
+    d->cached = colorsCache().find(account()->accountName());
+    if (d->cached && d->cached->validated.secsTo(QDateTime::currentDateTimeUtc()) < d->maxCacheAge) {
+        d->colors = d->cached->value;
+        d->fromCache = true;
+        emitFinished();
+        return;
+    }
+
+    QNetworkRequest request = CalendarService::prepareRequest(CalendarService::fetchColorsUrl());
+    if (d->cached && !d->cached->etag.isEmpty()) {
+        request.setRawHeader("If-None-Match", d->cached->etag);
+    }
+    enqueueRequest(request);
+}
+
+bool ColorsFetchJob::handleError(int statusCode, const QByteArray &rawData)
+{
+    if (statusCode == KGAPI2::NotModified && d->cached) {
+        colorsCache().revalidated(account()->accountName());
+        d->colors = d->cached->value;
+        d->fromCache = true;
+        return true;
+    }
+
+    return FetchJob::handleError(statusCode, rawData);
+}
+
+ObjectsList ColorsFetchJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
+{
+    const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+    ContentType ct = Utils::stringToContentType(contentType);
+    if (ct != KGAPI2::JSON) {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content type"));
+        emitFinished();
+        return {};
+    }
+
+    const auto object = QJsonDocument::fromJson(rawData).object();
+    if (object.value(QLatin1StringView("kind")).toString() != colorsKind) {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content"));
+        emitFinished();
+        return {};
+    }
+
+    d->colors.calendar = parseColorDefinitions(object.value(QLatin1StringView("calendar")).toObject());
+    d->colors.event = parseColorDefinitions(object.value(QLatin1StringView("event")).toObject());
+    d->colors.updated = Utils::rfc3339DateFromString(object.value(QLatin1StringView("updated")).toString());
+    colorsCache().insert(account()->accountName(), reply->rawHeader("ETag"), d->colors);
+
+    return {};
+}
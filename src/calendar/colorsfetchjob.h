@@ -0,0 +1,149 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "fetchjob.h"
+#include "kgapicalendar_export.h"
+
+#include <QColor>
+#include <QDateTime>
+#include <QMap>
+#include <QScopedPointer>
+
+namespace KGAPI2
+{
+
+/**
+ * @brief A job to fetch the color palettes of calendars and events
+ *
+ * Calendars and events refer to colors from the palettes by their ID.
+ *
+ * The palettes change very rarely, so the result is cached for the whole
+ * process, separately for each account. A cached result younger than
+ * maxCacheAge is returned without contacting the server, an older one is
+ * revalidated with its ETag, so that the palettes are only downloaded again
+ * when they have changed.
+ *
+ * @since 6.4
+ */
+class KGAPICALENDAR_EXPORT ColorsFetchJob : public KGAPI2::FetchJob
+{
+    Q_OBJECT
+
+    /**
+     * @brief Maximum age in seconds of a cached result used without revalidation
+     *
+     * By default a cached result is used without revalidation for an hour.
+     * Set to 0 to always revalidate the cached result with the server.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(int maxCacheAge READ maxCacheAge WRITE setMaxCacheAge)
+
+public:
+    struct ColorDefinition {
+        ColorDefinition() = default;
+        ColorDefinition(const QColor &background, const QColor &foreground)
+            : background(background)
+            , foreground(foreground)
+        {
+        }
+
+        bool operator==(const ColorDefinition &other) const
+        {
+            return background == other.background && foreground == other.foreground;
+        }
+
+        QColor background;
+        QColor foreground;
+    };
+    using ColorDefinitions = QMap<QString, ColorDefinition>;
+
+    /**
+     * @brief Constructs a job that will fetch the color palettes
+     *
+     * @param account Account to authenticate the request
+     * @param parent
+     */
+    explicit ColorsFetchJob(const AccountPtr &account, QObject *parent = nullptr);
+
+    /**
+     * @brief Destructor
+     */
+    ~ColorsFetchJob() override;
+
+    /**
+     * @brief Sets maximum age of a cached result used without revalidation
+     *
+     * @param seconds
+     */
+    void setMaxCacheAge(int seconds);
+
+    /**
+     * @brief Returns maximum age of a cached result used without revalidation
+     */
+    [[nodiscard]] int maxCacheAge() const;
+
+    /**
+     * @brief Returns palette of calendar colors, indexed by color ID
+     */
+    [[nodiscard]] ColorDefinitions calendarColors() const;
+
+    /**
+     * @brief Returns palette of event colors, indexed by color ID
+     */
+    [[nodiscard]] ColorDefinitions eventColors() const;
+
+    /**
+     * @brief Returns when the palettes were last modified
+     */
+    [[nodiscard]] QDateTime updated() const;
+
+    /**
+     * @brief Returns whether the result has been served from the cache
+     *
+     * This is the case both when the cache has been used without contacting
+     * the server and when the server confirmed the cached result is current.
+     */
+    [[nodiscard]] bool isFromCache() const;
+
+    /**
+     * @brief Drops the cached palettes of all accounts
+     */
+    static void clearCache();
+
+protected:
+    /**
+     * @brief KGAPI2::Job::start implementation
+     */
+    void start() override;
+
+    /**
+     * @brief KGAPI2::Job::handleError implementation
+     *
+     * @param statusCode
+     * @param rawData
+     */
+    bool handleError(int statusCode, const QByteArray &rawData) override;
+
+    /**
+     * @brief KGAPI2::FetchJob::handleReplyWithItems implementation
+     *
+     * @param reply
+     * @param rawData
+     */
+    ObjectsList handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData) override;
+
+private:
+    class Private;
+    QScopedPointer<Private> const d;
+    friend class Private;
+};
+
+} // namespace KGAPI2
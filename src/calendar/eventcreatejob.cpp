@@ -9,7 +9,9 @@
 #include "eventcreatejob.h"
 #include "account.h"
 #include "calendarservice.h"
+#include "debug.h"
 #include "event.h"
+#include "private/batchrequest_p.h"
 #include "private/queuehelper_p.h"
 #include "utils.h"
 
@@ -21,9 +23,24 @@ using namespace KGAPI2;
 class Q_DECL_HIDDEN EventCreateJob::Private
 {
 public:
+    QUrl createUrl(const EventPtr &event, const AccountPtr &account) const
+    {
+        // If the organizer is different from the account name, import a private copy of the event in the user's calendar,
+        // or normally create it otherwise.  This prevents that Google Calendar creates a copy event when accepting invitations
+        // to events created by others.
+        if (!event->attendees().isEmpty() && !event->organizer().isEmpty() && event->organizer().email() != account->accountName()) {
+            return CalendarService::importEventUrl(calendarId, updatesPolicy);
+        } else {
+            return CalendarService::createEventUrl(calendarId, updatesPolicy);
+        }
+    }
+
     QueueHelper<EventPtr> events;
     QString calendarId;
     SendUpdatesPolicy updatesPolicy = SendUpdatesPolicy::All;
+    int batchSize = 1;
+    int currentBatchSize = 0;
+    ItemResultsList itemResults;
 };
 
 EventCreateJob::EventCreateJob(const EventPtr &event, const QString &calendarId, const AccountPtr &account, QObject *parent)
@@ -57,6 +74,32 @@ SendUpdatesPolicy EventCreateJob::sendUpdates() const
     return d->updatesPolicy;
 }
 
+void EventCreateJob::setBatchSize(int batchSize)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify batchSize property when job is running";
+        return;
+    }
+
+    d->batchSize = qBound(1, batchSize, BatchRequest::MaxCalendarBatchSize);
+}
+
+int EventCreateJob::batchSize() const
+{
+    return d->batchSize;
+}
+
+ItemResultsList EventCreateJob::itemResults() const
+{
+    return d->itemResults;
+}
+
+void EventCreateJob::aboutToStart()
+{
+    d->itemResults.clear();
+    CreateJob::aboutToStart();
+}
+
 void EventCreateJob::start()
 {
     if (d->events.atEnd()) {
@@ -64,19 +107,22 @@ void EventCreateJob::start()
         return;
     }
 
-    const EventPtr event = d->events.current();
-    QUrl requestUrl;
-
-    // If the organizer is different from the account name, import a private copy of the event in the user's calendar,
-    // or normally create it otherwise.  This prevents that Google Calendar creates a copy event when accepting invitations
-    // to events created by others.
-    if (!event->attendees().isEmpty() && !event->organizer().isEmpty() && event->organizer().email() != this->account()->accountName()) {
-        requestUrl = CalendarService::importEventUrl(d->calendarId, d->updatesPolicy);
-    } else {
-        requestUrl = CalendarService::createEventUrl(d->calendarId, d->updatesPolicy);
+    if (d->batchSize > 1) {
+        BatchRequest batch(CalendarService::batchUrl());
+        const EventsList events = d->events.peek(d->batchSize);
+        for (const EventPtr &event : events) {
+            batch.addRequest("POST",
+                             d->createUrl(event, account()),
+                             CalendarService::eventToJSON(event, CalendarService::EventSerializeFlag::NoID),
+                             QStringLiteral("application/json"));
+        }
+        d->currentBatchSize = batch.count();
+        enqueueRequest(batch.request(), batch.data(), batch.contentType());
+        return;
     }
 
-    const auto request = CalendarService::prepareRequest(requestUrl);
+    const EventPtr event = d->events.current();
+    const auto request = CalendarService::prepareRequest(d->createUrl(event, account()));
     const QByteArray rawData = CalendarService::eventToJSON(event, CalendarService::EventSerializeFlag::NoID);
 
     enqueueRequest(request, rawData, QStringLiteral("application/json"));
@@ -85,8 +131,37 @@ void EventCreateJob::start()
 ObjectsList EventCreateJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
 {
     const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
-    ContentType ct = Utils::stringToContentType(contentType);
     ObjectsList items;
+
+    if (d->batchSize > 1) {
+        if (!BatchRequest::isBatchResponse(contentType)) {
+            setError(KGAPI2::InvalidResponse);
+            setErrorString(tr("Invalid response content type"));
+            emitFinished();
+            return items;
+        }
+
+        const ItemResult failure = BatchRequest::appendResults(
+            contentType,
+            rawData,
+            d->currentBatchSize,
+            d->itemResults,
+            [](const QByteArray &body) {
+                return CalendarService::JSONToEvent(body).dynamicCast<Object>();
+            },
+            &items);
+        if (failure.error != KGAPI2::NoError) {
+            setError(failure.error);
+            setErrorString(failure.errorString);
+        }
+        d->events.currentProcessed(d->currentBatchSize);
+        // Enqueue next batch or finish
+        start();
+
+        return items;
+    }
+
+    ContentType ct = Utils::stringToContentType(contentType);
     if (ct != KGAPI2::JSON) {
         setError(KGAPI2::InvalidResponse);
         setErrorString(tr("Invalid response content type"));
@@ -95,6 +170,7 @@ ObjectsList EventCreateJob::handleReplyWithItems(const QNetworkReply *reply, con
     }
 
     items << CalendarService::JSONToEvent(rawData).dynamicCast<Object>();
+    d->itemResults << ItemResult{items.constLast(), KGAPI2::NoError, QString()};
     d->events.currentProcessed();
     // Enqueue next item or finish
     start();
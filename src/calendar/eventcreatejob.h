@@ -28,6 +28,21 @@ class KGAPICALENDAR_EXPORT EventCreateJob : public KGAPI2::CreateJob
     Q_OBJECT
 
     Q_PROPERTY(KGAPI2::SendUpdatesPolicy sendUpdates READ sendUpdates WRITE setSendUpdates NOTIFY sendUpdatesChanged)
+
+    /**
+     * @brief Number of events sent to the server in a single request
+     *
+     * When larger than 1, events are sent through the Calendar batch endpoint
+     * in groups of up to batchSize events, instead of one request per event.
+     * Results of the individual events are available through itemResults().
+     *
+     * Defaults to 1, the maximum is 50. This property can be modified only
+     * when the job is not running.
+     *
+     * @see setBatchSize, batchSize
+     * @since 6.4
+     */
+    Q_PROPERTY(int batchSize READ batchSize WRITE setBatchSize)
 public:
     /**
      * @brief Constructs a job that will create given @p event in a calendar
@@ -59,6 +74,32 @@ public:
     [[nodiscard]] KGAPI2::SendUpdatesPolicy sendUpdates() const;
     void setSendUpdates(KGAPI2::SendUpdatesPolicy updatePolicy);
 
+    /**
+     * @brief Sets number of events to send in a single batch request
+     *
+     * @param batchSize Number of events per request, between 1 and 50.
+     * @since 6.4
+     */
+    void setBatchSize(int batchSize);
+
+    /**
+     * @brief Returns number of events sent in a single batch request
+     * @since 6.4
+     */
+    [[nodiscard]] int batchSize() const;
+
+    /**
+     * @brief Returns results of the individual events
+     *
+     * The results are in the same order as the events passed to the
+     * constructor. In batch mode a failure of a single event does not stop
+     * the job, error() then reports the first failure and the result of
+     * every event is available here.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] ItemResultsList itemResults() const;
+
 Q_SIGNALS:
     void sendUpdatesChanged(KGAPI2::SendUpdatesPolicy policy);
 
@@ -68,6 +109,11 @@ protected:
      */
     void start() override;
 
+    /**
+     * @brief KGAPI2::Job::aboutToStart implementation
+     */
+    void aboutToStart() override;
+
     /**
      * @brief KGAPI2::CreateJob::handleReplyWithItems implementation
      *
@@ -8,9 +8,13 @@
 
 #include "eventdeletejob.h"
 #include "calendarservice.h"
+#include "debug.h"
 #include "event.h"
+#include "private/batchrequest_p.h"
 #include "private/queuehelper_p.h"
 
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
 #include <QNetworkRequest>
 
 using namespace KGAPI2;
@@ -20,6 +24,9 @@ class Q_DECL_HIDDEN EventDeleteJob::Private
 public:
     QueueHelper<QString> eventsIds;
     QString calendarId;
+    int batchSize = 1;
+    int currentBatchSize = 0;
+    ItemResultsList itemResults;
 };
 
 EventDeleteJob::EventDeleteJob(const EventPtr &event, const QString &calendarId, const AccountPtr &account, QObject *parent)
@@ -58,6 +65,32 @@ EventDeleteJob::EventDeleteJob(const QStringList &eventIds, const QString &calen
 
 EventDeleteJob::~EventDeleteJob() = default;
 
+void EventDeleteJob::setBatchSize(int batchSize)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify batchSize property when job is running";
+        return;
+    }
+
+    d->batchSize = qBound(1, batchSize, BatchRequest::MaxCalendarBatchSize);
+}
+
+int EventDeleteJob::batchSize() const
+{
+    return d->batchSize;
+}
+
+ItemResultsList EventDeleteJob::itemResults() const
+{
+    return d->itemResults;
+}
+
+void EventDeleteJob::aboutToStart()
+{
+    d->itemResults.clear();
+    DeleteJob::aboutToStart();
+}
+
 void EventDeleteJob::start()
 {
     if (d->eventsIds.atEnd()) {
@@ -65,15 +98,56 @@ void EventDeleteJob::start()
         return;
     }
 
+    if (d->batchSize > 1) {
+        BatchRequest batch(CalendarService::batchUrl());
+        const QStringList eventIds = d->eventsIds.peek(d->batchSize);
+        for (const QString &eventId : eventIds) {
+            // Same as DeleteJob does for a single request
+            batch.addRequest("DELETE", CalendarService::removeEventUrl(d->calendarId, eventId), {}, {}, {{"If-Match", "*"}});
+        }
+        d->currentBatchSize = batch.count();
+        enqueueRequest(batch.request(), batch.data(), batch.contentType());
+        return;
+    }
+
     const QString eventId = d->eventsIds.current();
     const auto request = CalendarService::prepareRequest(CalendarService::removeEventUrl(d->calendarId, eventId));
 
     enqueueRequest(request);
 }
 
+void EventDeleteJob::dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType)
+{
+    if (d->batchSize > 1) {
+        // Batch requests are always POSTed to the batch endpoint
+        accessManager->post(request, data);
+        return;
+    }
+
+    DeleteJob::dispatchRequest(accessManager, request, data, contentType);
+}
+
 void EventDeleteJob::handleReply(const QNetworkReply *reply, const QByteArray &rawData)
 {
-    d->eventsIds.currentProcessed();
+    if (d->batchSize > 1) {
+        const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+        if (!BatchRequest::isBatchResponse(contentType)) {
+            setError(KGAPI2::InvalidResponse);
+            setErrorString(tr("Invalid response content type"));
+            emitFinished();
+            return;
+        }
+
+        const ItemResult failure = BatchRequest::appendResults(contentType, rawData, d->currentBatchSize, d->itemResults);
+        if (failure.error != KGAPI2::NoError) {
+            setError(failure.error);
+            setErrorString(failure.errorString);
+        }
+        d->eventsIds.currentProcessed(d->currentBatchSize);
+    } else {
+        d->itemResults << ItemResult();
+        d->eventsIds.currentProcessed();
+    }
 
     KGAPI2::DeleteJob::handleReply(reply, rawData);
 }
@@ -29,6 +29,22 @@ class KGAPICALENDAR_EXPORT EventDeleteJob : public KGAPI2::DeleteJob
 {
     Q_OBJECT
 
+    /**
+     * @brief Number of events deleted in a single request
+     *
+     * When larger than 1, events are deleted through the Calendar batch
+     * endpoint in groups of up to batchSize events, instead of one request
+     * per event. Results of the individual events are available through
+     * itemResults().
+     *
+     * Defaults to 1, the maximum is 50. This property can be modified only
+     * when the job is not running.
+     *
+     * @see setBatchSize, batchSize
+     * @since 6.4
+     */
+    Q_PROPERTY(int batchSize READ batchSize WRITE setBatchSize)
+
 public:
     /**
      * @brief Constructs a new job that will delete given @p event from a
@@ -79,12 +95,53 @@ public:
      */
     ~EventDeleteJob() override;
 
+    /**
+     * @brief Sets number of events to delete in a single batch request
+     *
+     * @param batchSize Number of events per request, between 1 and 50.
+     * @since 6.4
+     */
+    void setBatchSize(int batchSize);
+
+    /**
+     * @brief Returns number of events deleted in a single batch request
+     * @since 6.4
+     */
+    [[nodiscard]] int batchSize() const;
+
+    /**
+     * @brief Returns results of the individual events
+     *
+     * The results are in the same order as the events passed to the
+     * constructor. In batch mode a failure of a single event does not stop
+     * the job, error() then reports the first failure and the result of
+     * every event is available here.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] ItemResultsList itemResults() const;
+
 protected:
     /**
      * @brief KGAPI2::Job::start implementation
      */
     void start() override;
 
+    /**
+     * @brief KGAPI2::Job::aboutToStart implementation
+     */
+    void aboutToStart() override;
+
+    /**
+     * @brief KGAPI2::DeleteJob::dispatchRequest implementation
+     *
+     * @param accessManager
+     * @param request
+     * @param data
+     * @param contentType
+     */
+    void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType) override;
+
     /**
      * @brief KGAPI2::Job::handleReply implementation
      *
@@ -28,6 +28,8 @@ public:
     QString syncToken;
     QList<Event::EventType> eventTypes = { Event::EventType::Default, Event::EventType::FocusTime, Event::EventType::OutOfOffice };
     bool fetchDeleted = true;
+    bool syncTokenExpired = false;
+    bool expandRecurrences = false;
     quint64 updatedTimestamp = 0;
     quint64 timeMin = 0;
     quint64 timeMax = 0;
@@ -38,6 +40,7 @@ EventFetchJob::EventFetchJob(const QString &calendarId, const AccountPtr &accoun
     , d(new Private)
 {
     d->calendarId = calendarId;
+    setPageSizeParameter(QStringLiteral("maxResults"), 2500);
 }
 
 EventFetchJob::EventFetchJob(const QString &eventId, const QString &calendarId, const AccountPtr &account, QObject *parent)
@@ -105,6 +108,26 @@ QString EventFetchJob::syncToken() const
     return d->syncToken;
 }
 
+void EventFetchJob::setExpandRecurrences(bool expand)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify expandRecurrences property when job is running";
+        return;
+    }
+
+    d->expandRecurrences = expand;
+}
+
+bool EventFetchJob::expandRecurrences() const
+{
+    return d->expandRecurrences;
+}
+
+bool EventFetchJob::syncTokenExpired() const
+{
+    return d->syncTokenExpired;
+}
+
 void EventFetchJob::setTimeMin(quint64 timestamp)
 {
     if (isRunning()) {
@@ -135,8 +158,20 @@ QString EventFetchJob::filter() const
     return d->filter;
 }
 
+void EventFetchJob::aboutToStart()
+{
+    // start() is called again for the full sync, reset only here
+    d->syncTokenExpired = false;
+    FetchJob::aboutToStart();
+}
+
 void EventFetchJob::start()
 {
+    // Don't reuse the stored token when the server has just rejected it
+    if (d->eventId.isEmpty() && d->syncToken.isEmpty() && d->updatedTimestamp == 0 && !d->syncTokenExpired) {
+        d->syncToken = storedSyncState();
+    }
+
     QUrl url;
     if (d->eventId.isEmpty()) {
         url = CalendarService::fetchEventsUrl(d->calendarId);
@@ -158,6 +193,13 @@ void EventFetchJob::start()
         } else {
             query.addQueryItem(QStringLiteral("syncToken"), d->syncToken);
         }
+        if (d->expandRecurrences) {
+            query.addQueryItem(QStringLiteral("singleEvents"), Utils::bool2Str(true));
+            // The server refuses to order results of incremental updates
+            if (d->syncToken.isEmpty()) {
+                query.addQueryItem(QStringLiteral("orderBy"), QStringLiteral("startTime"));
+            }
+        }
         for (auto eventType : d->eventTypes) {
             query.addQueryItem(QStringLiteral("eventTypes"), CalendarService::eventTypeToString(eventType));
         }
@@ -173,6 +215,7 @@ bool EventFetchJob::handleError(int errorCode, const QByteArray &rawData)
 {
     if (errorCode == KGAPI2::Gone) {
         // Full sync required by server, redo request with no updatedMin and no syncToken
+        d->syncTokenExpired = true;
         d->updatedTimestamp = 0;
         d->syncToken.clear();
         start();
@@ -196,6 +239,9 @@ ObjectsList EventFetchJob::handleReplyWithItems(const QNetworkReply *reply, cons
             items << CalendarService::JSONToEvent(rawData).dynamicCast<Object>();
         }
         d->syncToken = feedData.syncToken;
+        if (!feedData.syncToken.isEmpty()) {
+            setReceivedSyncState(feedData.syncToken);
+        }
     } else {
         setError(KGAPI2::InvalidResponse);
         setErrorString(tr("Invalid response content type"));
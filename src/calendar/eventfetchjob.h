@@ -107,10 +107,34 @@ class KGAPICALENDAR_EXPORT EventFetchJob : public KGAPI2::FetchJob
      * By default the property is empty. Properties timeMin, timeMax,
      * updatedMin will be ignored if sync token is specified
      *
+     * When a sync state store is set and neither the sync token nor
+     * updatedMin are specified, the token is loaded from the store.
+     *
      * @see setSyncToken, syncToken
      */
     Q_PROPERTY(QString syncToken READ syncToken WRITE setSyncToken)
 
+    /**
+     * @brief Whether to expand recurring events into individual instances
+     *
+     * When enabled, the server expands recurring events into their
+     * individual instances (exceptions included) and returns them ordered by
+     * their start time, instead of returning the recurring series. Combined
+     * with timeMin and timeMax this allows to build e.g. an agenda view
+     * without expanding the recurrences locally. Ordering is not available
+     * for incremental updates, so instances are not ordered when a sync
+     * token is set.
+     *
+     * By default recurrences are not expanded.
+     *
+     * This property does not have any effect when fetching a specific event and
+     * can be modified only when the job is not running.
+     *
+     * @see setExpandRecurrences, expandRecurrences, FetchJob::setStreaming
+     * @since 6.4
+     */
+    Q_PROPERTY(bool expandRecurrences READ expandRecurrences WRITE setExpandRecurrences)
+
 public:
     /**
      * @brief Constructs a job that will fetch all events from a calendar with
@@ -231,7 +255,42 @@ public:
      */
     [[nodiscard]] QString syncToken() const;
 
+    /**
+     * @brief Sets whether to expand recurring events into individual instances
+     *
+     * @param expand
+     * @since 6.4
+     */
+    void setExpandRecurrences(bool expand);
+
+    /**
+     * @brief Returns whether recurring events are expanded into instances
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] bool expandRecurrences() const;
+
+    /**
+     * @brief Returns whether the server rejected the sync token
+     *
+     * When the sync token (or the fetchOnlyUpdated timestamp) is too old, the
+     * server responds with 410 Gone and the job automatically falls back to a
+     * full sync. In that case the fetched events are the complete content of
+     * the calendar rather than a delta and any locally stored events that are
+     * not part of the result should be discarded.
+     *
+     * The flag is reset when the job is started again.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] bool syncTokenExpired() const;
+
 protected:
+    /**
+     * @brief KGAPI2::Job::aboutToStart implementation
+     */
+    void aboutToStart() override;
+
     /**
      * @brief KGAPI2::Job::start implementation
      */
@@ -0,0 +1,431 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "eventindex.h"
+#include "event.h"
+
+#include <KCalendarCore/Recurrence>
+
+#include <QHash>
+#include <QSet>
+
+#include <algorithm>
+#include <limits>
+
+using namespace KGAPI2;
+
+namespace
+{
+
+bool isRemoved(const EventPtr &event)
+{
+    return event->deleted() || event->status() == KCalendarCore::Incidence::StatusCanceled;
+}
+
+QDateTime occurrenceEnd(const EventPtr &event, const QDateTime &start)
+{
+    if (!event->dtEnd().isValid()) {
+        return start;
+    }
+    if (event->allDay()) {
+        // End of all-day events is inclusive
+        return start.addDays(event->dtStart().date().daysTo(event->dtEnd().date()) + 1);
+    }
+    return start.addMSecs(event->dtStart().msecsTo(event->dtEnd()));
+}
+
+QDateTime occurrenceStart(const EventPtr &event)
+{
+    const auto dtStart = event->dtStart();
+    if (event->allDay()) {
+        return QDateTime(dtStart.date(), QTime(0, 0), dtStart.timeZone());
+    }
+    return dtStart;
+}
+
+} // namespace
+
+class Q_DECL_HIDDEN EventIndex::Private
+{
+public:
+    struct Series {
+        EventPtr master;
+        // Exceptions by their recurrence ID, cancelled ones are kept to hide
+        // the occurrence of the master event
+        QHash<qint64, EventPtr> exceptions;
+    };
+
+    struct Entry {
+        qint64 start;
+        // Zero-length occurrences are extended by one millisecond, so that
+        // they are found by queries covering their start
+        qint64 end;
+        // Largest end in the subtree rooted in this entry
+        qint64 maxEnd;
+        Occurrence occurrence;
+        // Key of the series the occurrence belongs to
+        QString series;
+    };
+
+    static bool startsBefore(const Entry &lhs, const Entry &rhs)
+    {
+        return lhs.start < rhs.start || (lhs.start == rhs.start && lhs.end < rhs.end);
+    }
+
+    QString seriesKey(const EventPtr &event) const
+    {
+        const auto known = seriesById.constFind(event->id());
+        if (known != seriesById.cend()) {
+            return *known;
+        }
+        const auto byUid = seriesByUid.constFind(event->uid());
+        if (!event->uid().isEmpty() && byUid != seriesByUid.cend()) {
+            return *byUid;
+        }
+        // Cancelled instances in sync results don't carry the iCalUID, but
+        // Google composes instance IDs from the ID of the recurring event
+        // and the original start time.
+        const int separator = event->id().lastIndexOf(QLatin1Char('_'));
+        return separator > 0 ? event->id().left(separator) : event->id();
+    }
+
+    void apply(const EventPtr &event)
+    {
+        if (!event->hasRecurrenceId()) {
+            if (isRemoved(event)) {
+                removeSeries(event->id());
+                return;
+            }
+
+            const QString key = event->id();
+            auto &s = series[key];
+            if (s.master && s.master->uid() != event->uid()) {
+                seriesByUid.remove(s.master->uid());
+            }
+            s.master = event;
+            seriesById.insert(key, key);
+            if (!event->uid().isEmpty()) {
+                seriesByUid.insert(event->uid(), key);
+            }
+            expandSeries(key);
+            return;
+        }
+
+        const QString key = seriesKey(event);
+        auto &s = series[key];
+        s.exceptions.insert(event->recurrenceId().toMSecsSinceEpoch(), event);
+        if (isRemoved(event)) {
+            seriesById.remove(event->id());
+        } else {
+            seriesById.insert(event->id(), key);
+        }
+        expandSeries(key);
+    }
+
+    void removeSeries(const QString &key)
+    {
+        const auto s = series.take(key);
+        if (s.master) {
+            seriesById.remove(s.master->id());
+            seriesByUid.remove(s.master->uid());
+        }
+        for (const auto &exception : s.exceptions) {
+            seriesById.remove(exception->id());
+        }
+        setEntries(key, {});
+    }
+
+    void removeException(const QString &key, const QString &id)
+    {
+        auto &s = series[key];
+        for (auto it = s.exceptions.begin(); it != s.exceptions.end(); ++it) {
+            if ((*it)->id() == id) {
+                s.exceptions.erase(it);
+                break;
+            }
+        }
+        seriesById.remove(id);
+        expandSeries(key);
+    }
+
+    void addEntry(QList<Entry> &entries, const QString &key, const EventPtr &event, const QDateTime &start, const QDateTime &end) const
+    {
+        const qint64 startMs = start.toMSecsSinceEpoch();
+        const qint64 endMs = std::max(end.toMSecsSinceEpoch(), startMs + 1);
+        if (startMs >= horizonEnd || endMs <= horizonStart) {
+            return;
+        }
+        entries.push_back({startMs, endMs, endMs, Occurrence(event, start, end), key});
+    }
+
+    void expandSeries(const QString &key)
+    {
+        const auto s = series.value(key);
+        QList<Entry> entries;
+        if (s.master) {
+            const auto start = occurrenceStart(s.master);
+            if (s.master->recurs()) {
+                const qint64 duration = start.msecsTo(occurrenceEnd(s.master, start));
+                // Occurrences starting before the horizon may still overlap it
+                const auto from = QDateTime::fromMSecsSinceEpoch(horizonStart - duration, QTimeZone::UTC);
+                const auto to = QDateTime::fromMSecsSinceEpoch(horizonEnd, QTimeZone::UTC);
+                const auto times = s.master->recurrence()->timesInInterval(from, to);
+                for (const auto &time : times) {
+                    if (!s.exceptions.contains(time.toMSecsSinceEpoch())) {
+                        addEntry(entries, key, s.master, time, occurrenceEnd(s.master, time));
+                    }
+                }
+            } else {
+                addEntry(entries, key, s.master, start, occurrenceEnd(s.master, start));
+            }
+        }
+        for (const auto &exception : s.exceptions) {
+            if (!isRemoved(exception)) {
+                const auto start = occurrenceStart(exception);
+                addEntry(entries, key, exception, start, occurrenceEnd(exception, start));
+            }
+        }
+        setEntries(key, entries);
+    }
+
+    void setEntries(const QString &key, const QList<Entry> &entries)
+    {
+        occurrencesCount -= entriesBySeries.value(key).size();
+        if (entries.isEmpty()) {
+            entriesBySeries.remove(key);
+        } else {
+            entriesBySeries.insert(key, entries);
+        }
+        occurrencesCount += entries.size();
+        changedSeries.insert(key);
+    }
+
+    void expandAll()
+    {
+        const auto keys = series.keys();
+        for (const auto &key : keys) {
+            expandSeries(key);
+        }
+    }
+
+    // The tree is stored implicitly in an array sorted by start, the root
+    // of every subrange is the entry in its middle.
+    qint64 buildTree(qsizetype lo, qsizetype hi) const
+    {
+        if (lo >= hi) {
+            return std::numeric_limits<qint64>::min();
+        }
+        const qsizetype mid = lo + (hi - lo) / 2;
+        auto &entry = tree[mid];
+        entry.maxEnd = std::max({entry.end, buildTree(lo, mid), buildTree(mid + 1, hi)});
+        return entry.maxEnd;
+    }
+
+    // Only the entries of the series changed since the last query are
+    // sorted and merged into the rest, which is sorted already. Updating a
+    // few events thus costs a linear pass instead of sorting all entries.
+    void ensureTree() const
+    {
+        if (changedSeries.isEmpty()) {
+            return;
+        }
+        tree.removeIf([this](const Entry &entry) {
+            return changedSeries.contains(entry.series);
+        });
+        const qsizetype unchanged = tree.size();
+        tree.reserve(occurrencesCount);
+        for (const auto &key : std::as_const(changedSeries)) {
+            tree.append(entriesBySeries.value(key));
+        }
+        std::sort(tree.begin() + unchanged, tree.end(), startsBefore);
+        std::inplace_merge(tree.begin(), tree.begin() + unchanged, tree.end(), startsBefore);
+        buildTree(0, tree.size());
+        changedSeries.clear();
+    }
+
+    // Calls visitor for every entry overlapping <from, to) in order of their
+    // start, stops when the visitor returns false.
+    template<typename Visitor>
+    bool visit(qsizetype lo, qsizetype hi, qint64 from, qint64 to, Visitor &visitor) const
+    {
+        if (lo >= hi) {
+            return true;
+        }
+        const qsizetype mid = lo + (hi - lo) / 2;
+        const auto &entry = tree[mid];
+        if (entry.maxEnd <= from) {
+            return true;
+        }
+        if (!visit(lo, mid, from, to, visitor)) {
+            return false;
+        }
+        if (entry.start >= to) {
+            return true;
+        }
+        if (entry.end > from && !visitor(entry)) {
+            return false;
+        }
+        return visit(mid + 1, hi, from, to, visitor);
+    }
+
+    template<typename Visitor>
+    void query(const QDateTime &from, const QDateTime &to, Visitor visitor) const
+    {
+        ensureTree();
+        visit(0, tree.size(), from.toMSecsSinceEpoch(), to.toMSecsSinceEpoch(), visitor);
+    }
+
+    qint64 horizonStart = 0;
+    qint64 horizonEnd = 0;
+
+    // By ID of the recurring or single event
+    QHash<QString, Series> series;
+    // Series key of every event in the index
+    QHash<QString, QString> seriesById;
+    QHash<QString, QString> seriesByUid;
+    QHash<QString, QList<Entry>> entriesBySeries;
+    int occurrencesCount = 0;
+
+    mutable QList<Entry> tree;
+    // Series whose entries are not in the tree yet
+    mutable QSet<QString> changedSeries;
+};
+
+EventIndex::EventIndex()
+    : d(new Private)
+{
+    const auto today = QDate::currentDate();
+    d->horizonStart = QDateTime(today.addMonths(-1), QTime(0, 0)).toMSecsSinceEpoch();
+    d->horizonEnd = QDateTime(today.addYears(1), QTime(0, 0)).toMSecsSinceEpoch();
+}
+
+EventIndex::~EventIndex() = default;
+
+void EventIndex::setHorizon(const QDateTime &start, const QDateTime &end)
+{
+    d->horizonStart = start.toMSecsSinceEpoch();
+    d->horizonEnd = end.toMSecsSinceEpoch();
+    d->expandAll();
+}
+
+QDateTime EventIndex::horizonStart() const
+{
+    return QDateTime::fromMSecsSinceEpoch(d->horizonStart);
+}
+
+QDateTime EventIndex::horizonEnd() const
+{
+    return QDateTime::fromMSecsSinceEpoch(d->horizonEnd);
+}
+
+void EventIndex::update(const EventsList &events)
+{
+    for (const auto &event : events) {
+        if (event) {
+            d->apply(event);
+        }
+    }
+}
+
+void EventIndex::update(const ObjectsList &items)
+{
+    for (const auto &item : items) {
+        if (const auto event = item.dynamicCast<Event>()) {
+            d->apply(event);
+        }
+    }
+}
+
+void EventIndex::remove(const QString &id)
+{
+    const auto key = d->seriesById.value(id);
+    if (key.isEmpty()) {
+        return;
+    }
+    if (key == id) {
+        d->removeSeries(key);
+    } else {
+        d->removeException(key, id);
+    }
+}
+
+void EventIndex::clear()
+{
+    d->series.clear();
+    d->seriesById.clear();
+    d->seriesByUid.clear();
+    d->entriesBySeries.clear();
+    d->occurrencesCount = 0;
+    d->tree.clear();
+    d->changedSeries.clear();
+}
+
+bool EventIndex::contains(const QString &id) const
+{
+    return d->seriesById.contains(id);
+}
+
+EventPtr EventIndex::event(const QString &id) const
+{
+    const auto key = d->seriesById.value(id);
+    if (key.isEmpty()) {
+        return {};
+    }
+    const auto s = d->series.value(key);
+    if (key == id) {
+        return s.master;
+    }
+    for (const auto &exception : s.exceptions) {
+        if (exception->id() == id) {
+            return exception;
+        }
+    }
+    return {};
+}
+
+int EventIndex::eventsCount() const
+{
+    return d->seriesById.size();
+}
+
+int EventIndex::occurrencesCount() const
+{
+    return d->occurrencesCount;
+}
+
+EventIndex::OccurrencesList EventIndex::occurrences(const QDateTime &from, const QDateTime &to) const
+{
+    OccurrencesList result;
+    d->query(from, to, [&result](const Private::Entry &entry) {
+        result.push_back(entry.occurrence);
+        return true;
+    });
+    return result;
+}
+
+EventIndex::OccurrencesList EventIndex::conflicts(const QDateTime &from, const QDateTime &to) const
+{
+    OccurrencesList result;
+    d->query(from, to, [&result](const Private::Entry &entry) {
+        if (entry.occurrence.event->transparency() != KCalendarCore::Event::Transparent) {
+            result.push_back(entry.occurrence);
+        }
+        return true;
+    });
+    return result;
+}
+
+bool EventIndex::isBusy(const QDateTime &from, const QDateTime &to) const
+{
+    bool busy = false;
+    d->query(from, to, [&busy](const Private::Entry &entry) {
+        busy = entry.occurrence.event->transparency() != KCalendarCore::Event::Transparent;
+        return !busy;
+    });
+    return busy;
+}
@@ -0,0 +1,177 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "kgapicalendar_export.h"
+#include "types.h"
+
+#include <QDateTime>
+#include <QScopedPointer>
+
+namespace KGAPI2
+{
+
+/**
+ * @brief An in-memory index of event occurrences for fast time range queries
+ *
+ * The index is fed with events fetched by EventFetchJob, either the full list
+ * or the incremental changes returned by a sync. Recurring events are expanded
+ * into concrete occurrences within the horizon of the index; exceptions of
+ * recurring events replace the occurrence they were made for and cancelled
+ * exceptions remove it. Deleted and cancelled events are removed from the
+ * index.
+ *
+ * The occurrences are kept in an interval tree, so range and conflict queries
+ * take O(log n + k) time. The tree is updated lazily on the first query after
+ * the index has changed, only the occurrences of the changed events are
+ * sorted and merged into it.
+ *
+ * The index is not thread-safe.
+ *
+ * @since 6.4
+ */
+class KGAPICALENDAR_EXPORT EventIndex
+{
+public:
+    struct Occurrence {
+        Occurrence() = default;
+        Occurrence(const EventPtr &event, const QDateTime &start, const QDateTime &end)
+            : event(event)
+            , start(start)
+            , end(end)
+        {
+        }
+
+        bool operator==(const Occurrence &other) const
+        {
+            return event == other.event && start == other.start && end == other.end;
+        }
+
+        EventPtr event;
+        QDateTime start;
+        QDateTime end;
+    };
+    using OccurrencesList = QList<Occurrence>;
+
+    /**
+     * @brief Constructs an empty index
+     *
+     * The horizon spans from one month before to one year after the current
+     * date.
+     */
+    EventIndex();
+
+    /**
+     * @brief Destructor
+     */
+    ~EventIndex();
+
+    /**
+     * @brief Sets the window in which recurring events are expanded
+     *
+     * Only occurrences overlapping the horizon are indexed. Changing the
+     * horizon re-expands all events in the index.
+     *
+     * @param start
+     * @param end
+     */
+    void setHorizon(const QDateTime &start, const QDateTime &end);
+
+    /**
+     * @brief Returns start of the horizon
+     */
+    [[nodiscard]] QDateTime horizonStart() const;
+
+    /**
+     * @brief Returns end of the horizon
+     */
+    [[nodiscard]] QDateTime horizonEnd() const;
+
+    /**
+     * @brief Adds, updates or removes given events
+     *
+     * Events already in the index are replaced by the new version, deleted
+     * and cancelled events are removed, so both the result of a full fetch
+     * and the changes returned by a sync can be passed here.
+     *
+     * @param events
+     */
+    void update(const EventsList &events);
+
+    /**
+     * @brief Overload of update() that accepts the items of a FetchJob
+     *
+     * Items that are not events are ignored.
+     *
+     * @param items
+     */
+    void update(const ObjectsList &items);
+
+    /**
+     * @brief Removes event with given @p id
+     *
+     * Removing a recurring event removes all its exceptions as well.
+     */
+    void remove(const QString &id);
+
+    /**
+     * @brief Removes all events from the index
+     */
+    void clear();
+
+    /**
+     * @brief Returns whether event with given @p id is in the index
+     */
+    [[nodiscard]] bool contains(const QString &id) const;
+
+    /**
+     * @brief Returns event with given @p id or a null pointer
+     */
+    [[nodiscard]] EventPtr event(const QString &id) const;
+
+    /**
+     * @brief Returns number of events in the index
+     */
+    [[nodiscard]] int eventsCount() const;
+
+    /**
+     * @brief Returns number of occurrences within the horizon
+     */
+    [[nodiscard]] int occurrencesCount() const;
+
+    /**
+     * @brief Returns all occurrences that overlap interval <@p from, @p to)
+     *
+     * Occurrences are sorted by their start. Zero-length events overlap
+     * the interval if they start within it.
+     */
+    [[nodiscard]] OccurrencesList occurrences(const QDateTime &from, const QDateTime &to) const;
+
+    /**
+     * @brief Returns occurrences that make the interval <@p from, @p to) busy
+     *
+     * Same as occurrences(), but transparent events, which do not block time,
+     * are skipped.
+     */
+    [[nodiscard]] OccurrencesList conflicts(const QDateTime &from, const QDateTime &to) const;
+
+    /**
+     * @brief Returns whether there is any conflict within interval <@p from, @p to)
+     */
+    [[nodiscard]] bool isBusy(const QDateTime &from, const QDateTime &to) const;
+
+private:
+    Q_DISABLE_COPY(EventIndex)
+
+    class Private;
+    QScopedPointer<Private> const d;
+    friend class Private;
+};
+
+} // namespace KGAPI2
@@ -0,0 +1,126 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "eventinstancesfetchjob.h"
+#include "calendarservice.h"
+#include "debug.h"
+#include "types.h"
+#include "utils.h"
+
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QUrlQuery>
+
+using namespace KGAPI2;
+
+class Q_DECL_HIDDEN EventInstancesFetchJob::Private
+{
+public:
+    QString calendarId;
+    QString eventId;
+    bool fetchDeleted = false;
+    quint64 timeMin = 0;
+    quint64 timeMax = 0;
+};
+
+EventInstancesFetchJob::EventInstancesFetchJob(const QString &eventId, const QString &calendarId, const AccountPtr &account, QObject *parent)
+    : FetchJob(account, parent)
+    , d(new Private)
+{
+    d->calendarId = calendarId;
+    d->eventId = eventId;
+    setPageSizeParameter(QStringLiteral("maxResults"), 2500);
+}
+
+EventInstancesFetchJob::~EventInstancesFetchJob() = default;
+
+void EventInstancesFetchJob::setFetchDeleted(bool fetchDeleted)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify fetchDeleted property when job is running";
+        return;
+    }
+
+    d->fetchDeleted = fetchDeleted;
+}
+
+bool EventInstancesFetchJob::fetchDeleted() const
+{
+    return d->fetchDeleted;
+}
+
+void EventInstancesFetchJob::setTimeMax(quint64 timestamp)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify timeMax property when job is running";
+        return;
+    }
+
+    d->timeMax = timestamp;
+}
+
+quint64 EventInstancesFetchJob::timeMax() const
+{
+    return d->timeMax;
+}
+
+void EventInstancesFetchJob::setTimeMin(quint64 timestamp)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify timeMin property when job is running";
+        return;
+    }
+
+    d->timeMin = timestamp;
+}
+
+quint64 EventInstancesFetchJob::timeMin() const
+{
+    return d->timeMin;
+}
+
+void EventInstancesFetchJob::start()
+{
+    QUrl url = CalendarService::fetchEventInstancesUrl(d->calendarId, d->eventId);
+    QUrlQuery query(url);
+    query.addQueryItem(QStringLiteral("showDeleted"), Utils::bool2Str(d->fetchDeleted));
+    if (d->timeMin > 0) {
+        query.addQueryItem(QStringLiteral("timeMin"), Utils::ts2Str(d->timeMin));
+    }
+    if (d->timeMax > 0) {
+        query.addQueryItem(QStringLiteral("timeMax"), Utils::ts2Str(d->timeMax));
+    }
+    url.setQuery(query);
+
+    const QNetworkRequest request = CalendarService::prepareRequest(url);
+    enqueueRequest(request);
+}
+
+ObjectsList EventInstancesFetchJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
+{
+    FeedData feedData;
+    feedData.requestUrl = reply->url();
+    ObjectsList items;
+    const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+    ContentType ct = Utils::stringToContentType(contentType);
+    if (ct == KGAPI2::JSON) {
+        items = CalendarService::parseEventJSONFeed(rawData, feedData);
+    } else {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content type"));
+        emitFinished();
+        return items;
+    }
+
+    if (feedData.nextPageUrl.isValid()) {
+        const auto request = CalendarService::prepareRequest(feedData.nextPageUrl);
+        enqueueRequest(request);
+    }
+
+    return items;
+}
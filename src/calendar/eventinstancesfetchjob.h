@@ -0,0 +1,140 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "fetchjob.h"
+#include "kgapicalendar_export.h"
+
+#include <QScopedPointer>
+
+namespace KGAPI2
+{
+
+/**
+ * @brief A job to fetch individual instances of a recurring event
+ *
+ * The server expands the recurrence of the event, so the instances do not
+ * have to be computed locally. Each returned Event has its recurrence ID set
+ * to the original start of the instance. Use timeMin and timeMax to fetch
+ * only instances in a given time window and FetchJob::setStreaming to
+ * process the instances page by page.
+ *
+ * @since 6.4
+ */
+class KGAPICALENDAR_EXPORT EventInstancesFetchJob : public KGAPI2::FetchJob
+{
+    Q_OBJECT
+
+    /**
+     * @brief Whether to fetch cancelled instances as well
+     *
+     * By default cancelled instances are not fetched.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(bool fetchDeleted READ fetchDeleted WRITE setFetchDeleted)
+
+    /**
+     * @brief Timestamp of the end of the time window
+     *
+     * Only instances starting before the time indicated by this property
+     * will be fetched.
+     *
+     * By default the timestamp is 0 and no limit is applied.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(quint64 timeMax READ timeMax WRITE setTimeMax)
+
+    /**
+     * @brief Timestamp of the start of the time window
+     *
+     * Only instances ending after the time indicated by this property will
+     * be fetched.
+     *
+     * By default the timestamp is 0 and no limit is applied.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(quint64 timeMin READ timeMin WRITE setTimeMin)
+
+public:
+    /**
+     * @brief Constructs a job that will fetch instances of a recurring event
+     *        with given @p eventId from a calendar with given @p calendarId
+     *
+     * @param eventId ID of the recurring event
+     * @param calendarId ID of calendar in which the event is
+     * @param account Account to authenticate the request
+     * @param parent
+     */
+    explicit EventInstancesFetchJob(const QString &eventId, const QString &calendarId, const AccountPtr &account, QObject *parent = nullptr);
+
+    /**
+     * @brief Destructor
+     */
+    ~EventInstancesFetchJob() override;
+
+    /**
+     * @brief Sets whether to fetch cancelled instances
+     *
+     * @param fetchDeleted
+     */
+    void setFetchDeleted(bool fetchDeleted = true);
+
+    /**
+     * @brief Returns whether cancelled instances are fetched.
+     */
+    [[nodiscard]] bool fetchDeleted() const;
+
+    /**
+     * @brief Sets timestamp of the end of the time window.
+     *
+     * @param timestamp
+     */
+    void setTimeMax(quint64 timestamp);
+
+    /**
+     * @brief Returns the end of the time window
+     */
+    [[nodiscard]] quint64 timeMax() const;
+
+    /**
+     * @brief Sets timestamp of the start of the time window.
+     *
+     * @param timestamp
+     */
+    void setTimeMin(quint64 timestamp);
+
+    /**
+     * @brief Returns the start of the time window
+     */
+    [[nodiscard]] quint64 timeMin() const;
+
+protected:
+    /**
+     * @brief KGAPI2::Job::start implementation
+     */
+    void start() override;
+
+    /**
+     * @brief KGAPI2::FetchJob::handleReplyWithItems implementation
+     *
+     * @param reply
+     * @param rawData
+     */
+    ObjectsList handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData) override;
+
+private:
+    class Private;
+    QScopedPointer<Private> const d;
+    friend class Private;
+};
+
+} // namespace KGAPI2
@@ -8,10 +8,14 @@
 
 #include "eventmodifyjob.h"
 #include "calendarservice.h"
+#include "debug.h"
 #include "event.h"
+#include "private/batchrequest_p.h"
 #include "private/queuehelper_p.h"
 #include "utils.h"
 
+#include <QHash>
+#include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QNetworkRequest>
 
@@ -20,9 +24,18 @@ using namespace KGAPI2;
 class Q_DECL_HIDDEN EventModifyJob::Private
 {
 public:
+    EventPtr originalEvent(const EventPtr &event) const
+    {
+        return event->id().isEmpty() ? EventPtr() : originalEvents.value(event->id());
+    }
+
     QueueHelper<EventPtr> events;
+    QHash<QString, EventPtr> originalEvents;
     QString calendarId;
     SendUpdatesPolicy updatesPolicy = SendUpdatesPolicy::All;
+    int batchSize = 1;
+    int currentBatchSize = 0;
+    ItemResultsList itemResults;
 };
 
 EventModifyJob::EventModifyJob(const EventPtr &event, const QString &calendarId, const AccountPtr &account, QObject *parent)
@@ -56,6 +69,51 @@ SendUpdatesPolicy EventModifyJob::sendUpdates() const
     return d->updatesPolicy;
 }
 
+void EventModifyJob::setBatchSize(int batchSize)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify batchSize property when job is running";
+        return;
+    }
+
+    d->batchSize = qBound(1, batchSize, BatchRequest::MaxCalendarBatchSize);
+}
+
+int EventModifyJob::batchSize() const
+{
+    return d->batchSize;
+}
+
+void EventModifyJob::setOriginalEvents(const EventsList &events)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify originalEvents property when job is running";
+        return;
+    }
+
+    d->originalEvents.clear();
+    d->originalEvents.reserve(events.size());
+    for (const EventPtr &event : events) {
+        d->originalEvents.insert(event->id(), event);
+    }
+}
+
+EventsList EventModifyJob::originalEvents() const
+{
+    return d->originalEvents.values();
+}
+
+ItemResultsList EventModifyJob::itemResults() const
+{
+    return d->itemResults;
+}
+
+void EventModifyJob::aboutToStart()
+{
+    d->itemResults.clear();
+    ModifyJob::aboutToStart();
+}
+
 void EventModifyJob::start()
 {
     if (d->events.atEnd()) {
@@ -63,18 +121,90 @@ void EventModifyJob::start()
         return;
     }
 
+    if (d->batchSize > 1) {
+        BatchRequest batch(CalendarService::batchUrl());
+        const EventsList events = d->events.peek(d->batchSize);
+        for (const EventPtr &event : events) {
+            const QUrl url = CalendarService::updateEventUrl(d->calendarId, event->id(), d->updatesPolicy);
+            if (const auto original = d->originalEvent(event)) {
+                BatchRequest::RawHeaders headers;
+                if (!original->etag().isEmpty()) {
+                    headers.push_back({"If-Match", original->etag().toUtf8()});
+                }
+                batch.addRequest("PATCH", url, CalendarService::eventToJSONPatch(event, original), QStringLiteral("application/json"), headers);
+            } else {
+                // Same as ModifyJob does for a single request
+                batch.addRequest("PUT", url, CalendarService::eventToJSON(event), QStringLiteral("application/json"), {{"If-Match", "*"}});
+            }
+        }
+        d->currentBatchSize = batch.count();
+        enqueueRequest(batch.request(), batch.data(), batch.contentType());
+        return;
+    }
+
     const EventPtr event = d->events.current();
-    const auto request = CalendarService::prepareRequest(CalendarService::updateEventUrl(d->calendarId, event->id(), d->updatesPolicy));
+    auto request = CalendarService::prepareRequest(CalendarService::updateEventUrl(d->calendarId, event->id(), d->updatesPolicy));
+    if (const auto original = d->originalEvent(event)) {
+        // Send only the changed properties and let the server reject the
+        // change if the event has been modified since it was fetched.
+        request.setAttribute(QNetworkRequest::CustomVerbAttribute, QByteArrayLiteral("PATCH"));
+        if (!original->etag().isEmpty()) {
+            request.setRawHeader("If-Match", original->etag().toUtf8());
+        }
+        enqueueRequest(request, CalendarService::eventToJSONPatch(event, original), QStringLiteral("application/json"));
+        return;
+    }
+
     const QByteArray rawData = CalendarService::eventToJSON(event);
 
     enqueueRequest(request, rawData, QStringLiteral("application/json"));
 }
 
+void EventModifyJob::dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType)
+{
+    if (d->batchSize > 1) {
+        // Batch requests are always POSTed to the batch endpoint
+        accessManager->post(request, data);
+        return;
+    }
+
+    ModifyJob::dispatchRequest(accessManager, request, data, contentType);
+}
+
 ObjectsList EventModifyJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
 {
     const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
-    ContentType ct = Utils::stringToContentType(contentType);
     ObjectsList items;
+
+    if (d->batchSize > 1) {
+        if (!BatchRequest::isBatchResponse(contentType)) {
+            setError(KGAPI2::InvalidResponse);
+            setErrorString(tr("Invalid response content type"));
+            emitFinished();
+            return items;
+        }
+
+        const ItemResult failure = BatchRequest::appendResults(
+            contentType,
+            rawData,
+            d->currentBatchSize,
+            d->itemResults,
+            [](const QByteArray &body) {
+                return CalendarService::JSONToEvent(body).dynamicCast<Object>();
+            },
+            &items);
+        if (failure.error != KGAPI2::NoError) {
+            setError(failure.error);
+            setErrorString(failure.errorString);
+        }
+        d->events.currentProcessed(d->currentBatchSize);
+        // Enqueue next batch or finish
+        start();
+
+        return items;
+    }
+
+    ContentType ct = Utils::stringToContentType(contentType);
     if (ct != KGAPI2::JSON) {
         setError(KGAPI2::InvalidResponse);
         setErrorString(tr("Invalid response content type"));
@@ -83,6 +213,7 @@ ObjectsList EventModifyJob::handleReplyWithItems(const QNetworkReply *reply, con
     }
 
     items << CalendarService::JSONToEvent(rawData).dynamicCast<Event>();
+    d->itemResults << ItemResult{items.constLast(), KGAPI2::NoError, QString()};
     d->events.currentProcessed();
     // Enqueue next item or finish
     start();
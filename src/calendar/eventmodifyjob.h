@@ -30,6 +30,21 @@ class KGAPICALENDAR_EXPORT EventModifyJob : public KGAPI2::ModifyJob
                READ sendUpdates
                WRITE setSendUpdates
                NOTIFY sendUpdatesChanged)
+
+    /**
+     * @brief Number of events sent to the server in a single request
+     *
+     * When larger than 1, events are sent through the Calendar batch endpoint
+     * in groups of up to batchSize events, instead of one request per event.
+     * Results of the individual events are available through itemResults().
+     *
+     * Defaults to 1, the maximum is 50. This property can be modified only
+     * when the job is not running.
+     *
+     * @see setBatchSize, batchSize
+     * @since 6.4
+     */
+    Q_PROPERTY(int batchSize READ batchSize WRITE setBatchSize)
   public:
 
     /**
@@ -64,6 +79,55 @@ class KGAPICALENDAR_EXPORT EventModifyJob : public KGAPI2::ModifyJob
     [[nodiscard]] KGAPI2::SendUpdatesPolicy sendUpdates() const;
     void setSendUpdates(KGAPI2::SendUpdatesPolicy updatesPolicy);
 
+    /**
+     * @brief Sets number of events to send in a single batch request
+     *
+     * @param batchSize Number of events per request, between 1 and 50.
+     * @since 6.4
+     */
+    void setBatchSize(int batchSize);
+
+    /**
+     * @brief Returns number of events sent in a single batch request
+     * @since 6.4
+     */
+    [[nodiscard]] int batchSize() const;
+
+    /**
+     * @brief Sets the events as they were last fetched from the server
+     *
+     * When an original is available for a modified event (matched by the
+     * event ID), the job sends only the properties that have changed using
+     * a PATCH request, with the ETag of the original in the If-Match header.
+     * If the event has been modified on the server in the meantime, the
+     * request fails with KGAPI2::Conflict instead of overwriting the remote
+     * changes.
+     *
+     * Events without an original are sent whole, as before.
+     *
+     * @param events Original, unmodified events
+     * @since 6.4
+     */
+    void setOriginalEvents(const EventsList &events);
+
+    /**
+     * @brief Returns the original events set by setOriginalEvents()
+     * @since 6.4
+     */
+    [[nodiscard]] EventsList originalEvents() const;
+
+    /**
+     * @brief Returns results of the individual events
+     *
+     * The results are in the same order as the events passed to the
+     * constructor. In batch mode a failure of a single event does not stop
+     * the job, error() then reports the first failure and the result of
+     * every event is available here.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] ItemResultsList itemResults() const;
+
   Q_SIGNALS:
     void sendUpdatesChanged(KGAPI2::SendUpdatesPolicy policy);
 
@@ -74,6 +138,22 @@ class KGAPICALENDAR_EXPORT EventModifyJob : public KGAPI2::ModifyJob
      */
     void start() override;
 
+    /**
+     * @brief KGAPI2::Job::aboutToStart implementation
+     */
+    void aboutToStart() override;
+
+    /**
+     * @brief KGAPI2::ModifyJob::dispatchRequest implementation
+     *
+     * @param accessManager
+     * @param request
+     * @param data
+     * @param contentType
+     */
+    void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request,
+                         const QByteArray &data, const QString &contentType) override;
+
     /**
      * @brief KGAPI2::ModifyJob::handleReplyWithItems implementation
      *
@@ -0,0 +1,77 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "eventwatchjob.h"
+#include "calendarservice.h"
+#include "push/channel.h"
+#include "utils.h"
+
+#include <QNetworkReply>
+#include <QNetworkRequest>
+
+using namespace KGAPI2;
+
+class Q_DECL_HIDDEN EventWatchJob::Private
+{
+public:
+    ChannelPtr requestedChannel;
+    ChannelPtr channel;
+    QString calendarId;
+};
+
+EventWatchJob::EventWatchJob(const ChannelPtr &channel, const QString &calendarId, const AccountPtr &account, QObject *parent)
+    : CreateJob(account, parent)
+    , d(new Private)
+{
+    d->requestedChannel = channel;
+    d->calendarId = calendarId;
+}
+
+EventWatchJob::~EventWatchJob() = default;
+
+ChannelPtr EventWatchJob::channel() const
+{
+    return d->channel;
+}
+
+void EventWatchJob::start()
+{
+    d->channel.reset();
+
+    const QNetworkRequest request = CalendarService::prepareRequest(CalendarService::watchEventsUrl(d->calendarId));
+    enqueueRequest(request, Channel::toJSON(d->requestedChannel), QStringLiteral("application/json"));
+}
+
+ObjectsList EventWatchJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
+{
+    const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+    ContentType ct = Utils::stringToContentType(contentType);
+    if (ct != KGAPI2::JSON) {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content type"));
+        emitFinished();
+        return {};
+    }
+
+    d->channel = Channel::fromJSON(rawData);
+    if (!d->channel) {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content"));
+        emitFinished();
+        return {};
+    }
+    // The response does not necessarily repeat the address and the token
+    if (d->channel->address().isEmpty()) {
+        d->channel->setAddress(d->requestedChannel->address());
+    }
+    if (d->channel->token().isEmpty()) {
+        d->channel->setToken(d->requestedChannel->token());
+    }
+
+    return {d->channel};
+}
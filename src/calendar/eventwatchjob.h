@@ -0,0 +1,84 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "createjob.h"
+#include "kgapicalendar_export.h"
+
+#include <QScopedPointer>
+
+namespace KGAPI2
+{
+
+/**
+ * @brief A job to subscribe to push notifications about changes of events
+ *
+ * Once the job finishes, Google sends a notification to the address of the
+ * channel whenever an event in the calendar is created, modified or removed.
+ * Notifications do not contain the changes themselves, use EventFetchJob
+ * with a sync token to fetch them.
+ *
+ * The channel expires after some time (by default one week) and has to be
+ * renewed by creating a new one before that. Use ChannelStopJob with
+ * CalendarService::stopChannelUrl() to stop receiving notifications.
+ *
+ * @see WebhookReceiver
+ * @since 6.4
+ */
+class KGAPICALENDAR_EXPORT EventWatchJob : public KGAPI2::CreateJob
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructs a job that will watch events in a calendar
+     *        with given @p calendarId
+     *
+     * @param channel Channel to deliver the notifications to. The ID and
+     *        address of the channel must be set.
+     * @param calendarId ID of calendar to watch
+     * @param account Account to authenticate the request
+     * @param parent
+     */
+    explicit EventWatchJob(const ChannelPtr &channel, const QString &calendarId, const AccountPtr &account, QObject *parent = nullptr);
+
+    /**
+     * @brief Destructor
+     */
+    ~EventWatchJob() override;
+
+    /**
+     * @brief Returns the established channel
+     *
+     * In addition to the properties of the requested channel, the returned
+     * channel has the resource ID and the actual expiration set.
+     */
+    [[nodiscard]] ChannelPtr channel() const;
+
+protected:
+    /**
+     * @brief KGAPI2::Job::start implementation
+     */
+    void start() override;
+
+    /**
+     * @brief KGAPI2::CreateJob::handleReplyWithItems implementation
+     *
+     * @param reply
+     * @param rawData
+     */
+    ObjectsList handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData) override;
+
+private:
+    class Private;
+    QScopedPointer<Private> const d;
+    friend class Private;
+};
+
+} // namespace KGAPI2
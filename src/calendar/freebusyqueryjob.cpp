@@ -8,33 +8,46 @@
 #include "calendarservice.h"
 #include "utils.h"
 
+#include <QHash>
 #include <QJsonDocument>
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QNetworkRequest>
 #include <QVariantMap>
 
+#include <algorithm>
+
 using namespace KGAPI2;
 
 class Q_DECL_HIDDEN FreeBusyQueryJob::Private
 {
 public:
-    Private(const QString &id, const QDateTime &timeMin, const QDateTime &timeMax)
-        : id(id)
+    Private(const QStringList &ids, const QDateTime &timeMin, const QDateTime &timeMax)
+        : ids(ids)
         , timeMin(timeMin)
         , timeMax(timeMax)
     {
     }
 
-    const QString id;
+    const QStringList ids;
     const QDateTime timeMin;
     const QDateTime timeMax;
-    FreeBusyQueryJob::BusyRangeList busy;
+    QHash<QString, FreeBusyQueryJob::BusyRangeList> busy;
+    QStringList failedIds;
+    // Chunks without a valid reply, the job has failed when it finishes
+    // before all of them have been answered
+    int pendingChunks = 0;
 };
 
 FreeBusyQueryJob::FreeBusyQueryJob(const QString &id, const QDateTime &timeMin, const QDateTime &timeMax, const AccountPtr &account, QObject *parent)
     : FetchJob(account, parent)
-    , d(new FreeBusyQueryJob::Private(id, timeMin, timeMax))
+    , d(new FreeBusyQueryJob::Private({id}, timeMin, timeMax))
+{
+}
+
+FreeBusyQueryJob::FreeBusyQueryJob(const QStringList &ids, const QDateTime &timeMin, const QDateTime &timeMax, const AccountPtr &account, QObject *parent)
+    : FetchJob(account, parent)
+    , d(new FreeBusyQueryJob::Private(ids, timeMin, timeMax))
 {
 }
 
@@ -42,12 +55,48 @@ FreeBusyQueryJob::~FreeBusyQueryJob() = default;
 
 FreeBusyQueryJob::BusyRangeList FreeBusyQueryJob::busy() const
 {
-    return d->busy;
+    return d->busy.value(id());
+}
+
+FreeBusyQueryJob::BusyRangeList FreeBusyQueryJob::busy(const QString &id) const
+{
+    return d->busy.value(id);
+}
+
+FreeBusyQueryJob::BusyRangeList FreeBusyQueryJob::mergedBusy() const
+{
+    BusyRangeList all;
+    for (const auto &ranges : std::as_const(d->busy)) {
+        all += ranges;
+    }
+    std::sort(all.begin(), all.end(), [](const BusyRange &lhs, const BusyRange &rhs) {
+        return lhs.busyStart < rhs.busyStart;
+    });
+
+    BusyRangeList merged;
+    for (const auto &range : std::as_const(all)) {
+        if (!merged.isEmpty() && range.busyStart <= merged.last().busyEnd) {
+            merged.last().busyEnd = std::max(merged.last().busyEnd, range.busyEnd);
+        } else {
+            merged.push_back(range);
+        }
+    }
+    return merged;
+}
+
+QStringList FreeBusyQueryJob::failedIds() const
+{
+    return d->failedIds;
 }
 
 QString FreeBusyQueryJob::id() const
 {
-    return d->id;
+    return d->ids.value(0);
+}
+
+QStringList FreeBusyQueryJob::ids() const
+{
+    return d->ids;
 }
 
 QDateTime FreeBusyQueryJob::timeMin() const
@@ -60,16 +109,51 @@ QDateTime FreeBusyQueryJob::timeMax() const
     return d->timeMax;
 }
 
+void FreeBusyQueryJob::aboutToStart()
+{
+    d->busy.clear();
+    d->failedIds.clear();
+    d->pendingChunks = 0;
+    FetchJob::aboutToStart();
+}
+
+void FreeBusyQueryJob::aboutToFinish()
+{
+    // error() can't be used while the job is still running
+    if (d->pendingChunks == 0 && !d->ids.isEmpty() && d->failedIds.size() == d->ids.size()) {
+        setError(KGAPI2::NotFound);
+        setErrorString(tr("FreeBusy information is not available"));
+    }
+    FetchJob::aboutToFinish();
+}
+
 void FreeBusyQueryJob::start()
 {
-    QVariantMap requestData({{QStringLiteral("timeMin"), Utils::rfc3339DateToString(d->timeMin)},
-                             {QStringLiteral("timeMax"), Utils::rfc3339DateToString(d->timeMax)},
-                             {QStringLiteral("items"), QVariantList({QVariantMap({{QStringLiteral("id"), d->id}})})}});
-    QJsonDocument document = QJsonDocument::fromVariant(requestData);
-    const QByteArray json = document.toJson(QJsonDocument::Compact);
+    if (d->ids.isEmpty()) {
+        emitFinished();
+        return;
+    }
 
     const auto request = CalendarService::prepareRequest(CalendarService::freeBusyQueryUrl());
-    enqueueRequest(request, json, QStringLiteral("application/json"));
+    // All chunks are enqueued at once and dispatched concurrently, the job
+    // finishes once all of them have been answered.
+    for (int offset = 0; offset < d->ids.size(); offset += MaxCalendarsPerQuery) {
+        QVariantList items;
+        const QStringList chunk = d->ids.mid(offset, MaxCalendarsPerQuery);
+        items.reserve(chunk.size());
+        for (const QString &id : chunk) {
+            items.push_back(QVariantMap({{QStringLiteral("id"), id}}));
+        }
+
+        QVariantMap requestData({{QStringLiteral("timeMin"), Utils::rfc3339DateToString(d->timeMin)},
+                                 {QStringLiteral("timeMax"), Utils::rfc3339DateToString(d->timeMax)},
+                                 {QStringLiteral("items"), items}});
+        QJsonDocument document = QJsonDocument::fromVariant(requestData);
+        const QByteArray json = document.toJson(QJsonDocument::Compact);
+
+        enqueueRequest(request, json, QStringLiteral("application/json"));
+        ++d->pendingChunks;
+    }
 }
 
 void FreeBusyQueryJob::dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType)
@@ -86,26 +170,32 @@ void FreeBusyQueryJob::handleReply(const QNetworkReply *reply, const QByteArray
 {
     const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
     ContentType ct = Utils::stringToContentType(contentType);
-    if (ct == KGAPI2::JSON) {
-        const QJsonDocument document = QJsonDocument::fromJson(rawData);
-        const QVariantMap data = document.toVariant().toMap();
-        const QVariantMap cals = data[QStringLiteral("calendars")].toMap();
-        const QVariantMap cal = cals[d->id].toMap();
-        if (cal.contains(QStringLiteral("errors"))) {
-            setError(KGAPI2::NotFound);
-            setErrorString(tr("FreeBusy information is not available"));
-        } else {
-            const QVariantList busyList = cal[QStringLiteral("busy")].toList();
-            for (const QVariant &busyV : busyList) {
-                const QVariantMap busy = busyV.toMap();
-                d->busy << BusyRange{Utils::rfc3339DateFromString(busy[QStringLiteral("start")].toString()),
-                                     Utils::rfc3339DateFromString(busy[QStringLiteral("end")].toString())};
-            }
-        }
-    } else {
+    if (ct != KGAPI2::JSON) {
         setError(KGAPI2::InvalidResponse);
         setErrorString(tr("Invalid response content type"));
+        emitFinished();
+        return;
     }
 
-    emitFinished();
+    --d->pendingChunks;
+
+    const QJsonDocument document = QJsonDocument::fromJson(rawData);
+    const QVariantMap data = document.toVariant().toMap();
+    const QVariantMap cals = data[QStringLiteral("calendars")].toMap();
+    for (auto it = cals.cbegin(), end = cals.cend(); it != end; ++it) {
+        const QVariantMap cal = it.value().toMap();
+        if (cal.contains(QStringLiteral("errors"))) {
+            d->failedIds.push_back(it.key());
+            continue;
+        }
+
+        auto &ranges = d->busy[it.key()];
+        const QVariantList busyList = cal[QStringLiteral("busy")].toList();
+        ranges.reserve(ranges.size() + busyList.size());
+        for (const QVariant &busyV : busyList) {
+            const QVariantMap busy = busyV.toMap();
+            ranges << BusyRange{Utils::rfc3339DateFromString(busy[QStringLiteral("start")].toString()),
+                                Utils::rfc3339DateFromString(busy[QStringLiteral("end")].toString())};
+        }
+    }
 }
@@ -12,6 +12,7 @@
 #include <QDateTime>
 #include <QList>
 #include <QScopedPointer>
+#include <QStringList>
 
 namespace KGAPI2
 {
@@ -38,19 +39,87 @@ public:
     };
     using BusyRangeList = QList<BusyRange>;
 
+    /**
+     * @brief Maximum number of calendars the server accepts in a single query
+     *
+     * Larger sets of calendars are split into multiple queries that are sent
+     * concurrently.
+     *
+     * @since 6.4
+     */
+    static constexpr int MaxCalendarsPerQuery = 50;
+
     explicit FreeBusyQueryJob(const QString &id, const QDateTime &timeMin, const QDateTime &timeMax, const AccountPtr &account, QObject *parent = nullptr);
+
+    /**
+     * @brief Constructs a job that will query free/busy information of
+     *        multiple calendars at once
+     *
+     * @param ids IDs of calendars, users or resources to query
+     * @param timeMin Start of the queried interval
+     * @param timeMax End of the queried interval
+     * @param account Account to authenticate the requests
+     * @param parent
+     *
+     * @since 6.4
+     */
+    explicit FreeBusyQueryJob(const QStringList &ids, const QDateTime &timeMin, const QDateTime &timeMax, const AccountPtr &account, QObject *parent = nullptr);
     ~FreeBusyQueryJob() override;
 
+    /**
+     * @brief Returns ID of the queried calendar, or of the first one when
+     *        querying multiple calendars
+     */
     [[nodiscard]] QString id() const;
+
+    /**
+     * @brief Returns IDs of all queried calendars
+     * @since 6.4
+     */
+    [[nodiscard]] QStringList ids() const;
     [[nodiscard]] QDateTime timeMin() const;
     [[nodiscard]] QDateTime timeMax() const;
 
+    /**
+     * @brief Returns busy ranges of the queried calendar, or of the first one
+     *        when querying multiple calendars
+     */
     [[nodiscard]] BusyRangeList busy() const;
 
+    /**
+     * @brief Returns busy ranges of calendar with given @p id
+     * @since 6.4
+     */
+    [[nodiscard]] BusyRangeList busy(const QString &id) const;
+
+    /**
+     * @brief Returns union of busy ranges of all queried calendars
+     *
+     * Overlapping and adjacent ranges are merged, the result is sorted by
+     * start time, so any gap between two ranges is a slot in which all the
+     * successfully queried calendars are free.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] BusyRangeList mergedBusy() const;
+
+    /**
+     * @brief Returns IDs of calendars for which free/busy information is not
+     *        available
+     *
+     * The job only fails with KGAPI2::NotFound when the information is not
+     * available for any of the queried calendars.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] QStringList failedIds() const;
+
 protected:
     void start() override;
     void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType) override;
     void handleReply(const QNetworkReply *reply, const QByteArray &rawData) override;
+    void aboutToStart() override;
+    void aboutToFinish() override;
 
 private:
     class Private;
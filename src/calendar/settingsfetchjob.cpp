@@ -0,0 +1,178 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "settingsfetchjob.h"
+#include "account.h"
+#include "calendarservice.h"
+#include "debug.h"
+#include "private/resourcecache_p.h"
+#include "utils.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QUrlQuery>
+
+using namespace KGAPI2;
+
+namespace
+{
+static const auto settingsKind = QLatin1StringView("calendar#settings");
+
+using Settings = QMap<QString, QString>;
+
+ResourceCache<Settings> &settingsCache()
+{
+    static ResourceCache<Settings> cache;
+    return cache;
+}
+} // namespace
+
+class Q_DECL_HIDDEN SettingsFetchJob::Private
+{
+public:
+    int maxCacheAge = 3600;
+    Settings settings;
+    std::optional<ResourceCache<Settings>::Entry> cached;
+    // ETag of the first page identifies the whole collection
+    QByteArray etag;
+    bool fromCache = false;
+};
+
+SettingsFetchJob::SettingsFetchJob(const AccountPtr &account, QObject *parent)
+    : FetchJob(account, parent)
+    , d(new Private)
+{
+}
+
+SettingsFetchJob::~SettingsFetchJob() = default;
+
+void SettingsFetchJob::setMaxCacheAge(int seconds)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify maxCacheAge property when job is running";
+        return;
+    }
+
+    d->maxCacheAge = seconds;
+}
+
+int SettingsFetchJob::maxCacheAge() const
+{
+    return d->maxCacheAge;
+}
+
+QMap<QString, QString> SettingsFetchJob::settings() const
+{
+    return d->settings;
+}
+
+QString SettingsFetchJob::setting(const QString &id, const QString &defaultValue) const
+{
+    return d->settings.value(id, defaultValue);
+}
+
+bool SettingsFetchJob::isFromCache() const
+{
+    return d->fromCache;
+}
+
+void SettingsFetchJob::clearCache()
+{
+    settingsCache().clear();
+}
+
+void SettingsFetchJob::start()
+{
+    d->settings.clear();
+    d->etag.clear();
+    d->fromCache = false;
+    d->cached.reset();
+
+    // The settings are cached by the name of the account
+    if (!account()) {
+        setError(KGAPI2::InvalidAccount);
+        setErrorString(tr("Invalid account"));
+        emitFinished();
+        return;
+    }
+
+    d->cached = settingsCache().find(account()->accountName());
+    if (d->cached && d->cached->validated.secsTo(QDateTime::currentDateTimeUtc()) < d->maxCacheAge) {
+        d->settings = d->cached->value;
+        d->fromCache = true;
+        emitFinished();
+        return;
+    }
+
+    QNetworkRequest request = CalendarService::prepareRequest(CalendarService::fetchSettingsUrl());
+    if (d->cached && !d->cached->etag.isEmpty()) {
+        request.setRawHeader("If-None-Match", d->cached->etag);
+    }
+    enqueueRequest(request);
+}
+
+bool SettingsFetchJob::handleError(int statusCode, const QByteArray &rawData)
+{
+    if (statusCode == KGAPI2::NotModified && d->cached) {
+        settingsCache().revalidated(account()->accountName());
+        d->settings = d->cached->value;
+        d->fromCache = true;
+        return true;
+    }
+
+    return FetchJob::handleError(statusCode, rawData);
+}
+
+ObjectsList SettingsFetchJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
+{
+    const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+    ContentType ct = Utils::stringToContentType(contentType);
+    if (ct != KGAPI2::JSON) {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content type"));
+        emitFinished();
+        return {};
+    }
+
+    const auto object = QJsonDocument::fromJson(rawData).object();
+    if (object.value(QLatin1StringView("kind")).toString() != settingsKind) {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content"));
+        emitFinished();
+        return {};
+    }
+
+    if (d->etag.isEmpty()) {
+        d->etag = reply->rawHeader("ETag");
+        if (d->etag.isEmpty()) {
+            d->etag = object.value(QLatin1StringView("etag")).toString().toUtf8();
+        }
+    }
+
+    const auto items = object.value(QLatin1StringView("items")).toArray();
+    for (const auto &item : items) {
+        const auto setting = item.toObject();
+        d->settings.insert(setting.value(QLatin1StringView("id")).toString(), setting.value(QLatin1StringView("value")).toString());
+    }
+
+    const auto nextPageToken = object.value(QLatin1StringView("nextPageToken")).toString();
+    if (!nextPageToken.isEmpty()) {
+        QUrl url = CalendarService::fetchSettingsUrl();
+        QUrlQuery query(url);
+        query.addQueryItem(QStringLiteral("pageToken"), nextPageToken);
+        url.setQuery(query);
+        enqueueRequest(CalendarService::prepareRequest(url));
+    } else {
+        settingsCache().insert(account()->accountName(), d->etag, d->settings);
+    }
+
+    return {};
+}
@@ -0,0 +1,128 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "fetchjob.h"
+#include "kgapicalendar_export.h"
+
+#include <QMap>
+#include <QScopedPointer>
+
+namespace KGAPI2
+{
+
+/**
+ * @brief A job to fetch settings of the user's calendar
+ *
+ * The settings include the time zone of the user, the format of time, the
+ * first day of week and other preferences relevant for displaying calendars.
+ *
+ * The settings change very rarely, so the result is cached for the whole
+ * process, separately for each account. A cached result younger than
+ * maxCacheAge is returned without contacting the server, an older one is
+ * revalidated with its ETag, so that the settings are only downloaded again
+ * when they have changed.
+ *
+ * @since 6.4
+ */
+class KGAPICALENDAR_EXPORT SettingsFetchJob : public KGAPI2::FetchJob
+{
+    Q_OBJECT
+
+    /**
+     * @brief Maximum age in seconds of a cached result used without revalidation
+     *
+     * By default a cached result is used without revalidation for an hour.
+     * Set to 0 to always revalidate the cached result with the server.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(int maxCacheAge READ maxCacheAge WRITE setMaxCacheAge)
+
+public:
+    /**
+     * @brief Constructs a job that will fetch the calendar settings
+     *
+     * @param account Account to authenticate the request
+     * @param parent
+     */
+    explicit SettingsFetchJob(const AccountPtr &account, QObject *parent = nullptr);
+
+    /**
+     * @brief Destructor
+     */
+    ~SettingsFetchJob() override;
+
+    /**
+     * @brief Sets maximum age of a cached result used without revalidation
+     *
+     * @param seconds
+     */
+    void setMaxCacheAge(int seconds);
+
+    /**
+     * @brief Returns maximum age of a cached result used without revalidation
+     */
+    [[nodiscard]] int maxCacheAge() const;
+
+    /**
+     * @brief Returns all settings, indexed by setting ID
+     */
+    [[nodiscard]] QMap<QString, QString> settings() const;
+
+    /**
+     * @brief Returns value of setting with given @p id
+     *
+     * @param id ID of the setting, for example "timezone" or "weekStart"
+     * @param defaultValue Value returned when the setting is not present
+     */
+    [[nodiscard]] QString setting(const QString &id, const QString &defaultValue = QString()) const;
+
+    /**
+     * @brief Returns whether the result has been served from the cache
+     *
+     * This is the case both when the cache has been used without contacting
+     * the server and when the server confirmed the cached result is current.
+     */
+    [[nodiscard]] bool isFromCache() const;
+
+    /**
+     * @brief Drops the cached settings of all accounts
+     */
+    static void clearCache();
+
+protected:
+    /**
+     * @brief KGAPI2::Job::start implementation
+     */
+    void start() override;
+
+    /**
+     * @brief KGAPI2::Job::handleError implementation
+     *
+     * @param statusCode
+     * @param rawData
+     */
+    bool handleError(int statusCode, const QByteArray &rawData) override;
+
+    /**
+     * @brief KGAPI2::FetchJob::handleReplyWithItems implementation
+     *
+     * @param reply
+     * @param rawData
+     */
+    ObjectsList handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData) override;
+
+private:
+    class Private;
+    QScopedPointer<Private> const d;
+    friend class Private;
+};
+
+} // namespace KGAPI2
@@ -9,16 +9,99 @@
 #include "fetchjob.h"
 #include "debug.h"
 #include "object.h"
+#include "syncstatestore.h"
 
+#include <QElapsedTimer>
 #include <QNetworkAccessManager>
+#include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QPointer>
+#include <QTimer>
+#include <QUrlQuery>
+
+#include <algorithm>
 
 using namespace KGAPI2;
 
+namespace
+{
+static constexpr int DefaultAdaptivePageSize = 100;
+static constexpr int MinimumAdaptivePageSize = 10;
+static constexpr int GatewayTimeout = 504;
+
+// Job appends the fields parameter again when dispatching the request
+QNetworkRequest retryRequest(QNetworkRequest request)
+{
+    QUrl url = request.url();
+    QUrlQuery query(url);
+    query.removeAllQueryItems(Job::StandardParams::Fields);
+    url.setQuery(query);
+    request.setUrl(url);
+    return request;
+}
+} // namespace
+
 class Q_DECL_HIDDEN FetchJob::Private
 {
 public:
     ObjectsList items;
+    bool streaming = false;
+
+    SyncStateStore *syncStateStore = nullptr;
+    QString syncStateKey;
+    QString receivedSyncState;
+
+    int clampPageSize(int size) const
+    {
+        if (maximumPageSize > 0) {
+            size = qMin(size, maximumPageSize);
+        }
+        return qMax(size, 1);
+    }
+
+    QString pageSizeParameter;
+    int maximumPageSize = 0;
+    int pageSize = 0;
+    bool adaptivePageSize = false;
+    int targetPageLatency = 1000;
+    qint64 targetPageBytes = 1024 * 1024;
+
+    bool canShrinkPage() const
+    {
+        return adaptivePageSize && !pageSizeParameter.isEmpty() && currentPageSize > MinimumAdaptivePageSize;
+    }
+
+    // Pages in flight, several can be requested at the same time
+    struct Page {
+        QPointer<QNetworkReply> reply;
+        qint64 dispatched = 0;
+    };
+
+    Page takePage(const QNetworkReply *reply)
+    {
+        for (auto it = pages.begin(); it != pages.end(); ++it) {
+            if (it->reply == reply) {
+                return pages.takeAt(std::distance(pages.begin(), it));
+            }
+        }
+        return {};
+    }
+
+    // handleError() doesn't get the reply, any finished page with the status
+    // is as good as the one being handled, each is taken only once
+    Page takeFailedPage(int statusCode)
+    {
+        for (auto it = pages.begin(); it != pages.end(); ++it) {
+            if (it->reply && it->reply->isFinished() && it->reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == statusCode) {
+                return pages.takeAt(std::distance(pages.begin(), it));
+            }
+        }
+        return {};
+    }
+
+    int currentPageSize = 0;
+    QElapsedTimer clock;
+    QList<Page> pages;
 };
 
 FetchJob::FetchJob(QObject *parent)
@@ -48,26 +131,263 @@ ObjectsList FetchJob::items() const
     return d->items;
 }
 
+void FetchJob::setStreaming(bool streaming)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify streaming property when job is running";
+        return;
+    }
+
+    d->streaming = streaming;
+}
+
+bool FetchJob::isStreaming() const
+{
+    return d->streaming;
+}
+
+void FetchJob::setSyncStateStore(SyncStateStore *store, const QString &key)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify syncStateStore property when job is running";
+        return;
+    }
+
+    d->syncStateStore = store;
+    d->syncStateKey = key;
+}
+
+SyncStateStore *FetchJob::syncStateStore() const
+{
+    return d->syncStateStore;
+}
+
+QString FetchJob::syncStateKey() const
+{
+    return d->syncStateKey;
+}
+
+void FetchJob::discardSyncState()
+{
+    d->receivedSyncState.clear();
+}
+
+QString FetchJob::storedSyncState() const
+{
+    if (!d->syncStateStore) {
+        return QString();
+    }
+
+    return d->syncStateStore->load(d->syncStateKey);
+}
+
+void FetchJob::setReceivedSyncState(const QString &state)
+{
+    d->receivedSyncState = state;
+}
+
+void FetchJob::setPageSize(int pageSize)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify pageSize property when job is running";
+        return;
+    }
+
+    d->pageSize = qMax(pageSize, 0);
+}
+
+int FetchJob::pageSize() const
+{
+    return d->pageSize;
+}
+
+void FetchJob::setAdaptivePageSize(bool adaptive)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify adaptivePageSize property when job is running";
+        return;
+    }
+
+    d->adaptivePageSize = adaptive;
+}
+
+bool FetchJob::adaptivePageSize() const
+{
+    return d->adaptivePageSize;
+}
+
+void FetchJob::setTargetPageLatency(int msecs)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify targetPageLatency property when job is running";
+        return;
+    }
+
+    d->targetPageLatency = msecs;
+}
+
+int FetchJob::targetPageLatency() const
+{
+    return d->targetPageLatency;
+}
+
+void FetchJob::setTargetPageBytes(qint64 bytes)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify targetPageBytes property when job is running";
+        return;
+    }
+
+    d->targetPageBytes = bytes;
+}
+
+qint64 FetchJob::targetPageBytes() const
+{
+    return d->targetPageBytes;
+}
+
+void FetchJob::setPageSizeParameter(const QString &parameter, int maximum)
+{
+    d->pageSizeParameter = parameter;
+    d->maximumPageSize = maximum;
+}
+
+void FetchJob::enqueueRequest(const QNetworkRequest &request, const QByteArray &data, const QString &contentType)
+{
+    if (d->pageSizeParameter.isEmpty() || d->currentPageSize <= 0) {
+        Job::enqueueRequest(request, data, contentType);
+        return;
+    }
+
+    QNetworkRequest pageRequest(request);
+    QUrl url = request.url();
+    QUrlQuery query(url);
+    const auto value = QString::number(d->currentPageSize);
+    auto items = query.queryItems(QUrl::FullyEncoded);
+    bool found = false;
+    for (auto &item : items) {
+        if (item.first == d->pageSizeParameter) {
+            item.second = value;
+            found = true;
+        }
+    }
+    if (!found) {
+        // Keep prettyPrint last, Job only appends it when it's missing
+        auto it = std::find_if(items.begin(), items.end(), [](const auto &item) {
+            return item.first == QLatin1StringView("prettyPrint");
+        });
+        items.insert(it, {d->pageSizeParameter, value});
+    }
+    query.setQueryItems(items);
+    url.setQuery(query);
+    pageRequest.setUrl(url);
+
+    // Only pages that can still shrink time out, the smallest one is waited
+    // for however long it takes
+    if (d->canShrinkPage() && d->targetPageLatency > 0) {
+        pageRequest.setTransferTimeout(5 * d->targetPageLatency);
+    }
+
+    Job::enqueueRequest(pageRequest, data, contentType);
+}
+
 void FetchJob::dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType)
 {
     Q_UNUSED(data)
     Q_UNUSED(contentType)
 
-    accessManager->get(request);
+    QNetworkReply *reply = accessManager->get(request);
+    if (d->adaptivePageSize && !d->pageSizeParameter.isEmpty()) {
+        d->pages.push_back({reply, d->clock.elapsed()});
+    }
 }
 
 void FetchJob::handleReply(const QNetworkReply *reply, const QByteArray &rawData)
 {
-    d->items << handleReplyWithItems(reply, rawData);
+    const Private::Page page = d->takePage(reply);
+
+    // A transfer timeout has no HTTP status, Job passes it on as a reply
+    const bool timedOut = (reply->error() == QNetworkReply::TimeoutError || reply->error() == QNetworkReply::OperationCanceledError)
+        && reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 0;
+    if (timedOut && d->canShrinkPage()) {
+        d->currentPageSize = qMax(d->currentPageSize / 2, MinimumAdaptivePageSize);
+        qCDebug(KGAPIDebug) << "Request for a page timed out, retrying with page size" << d->currentPageSize;
+        enqueueRequest(retryRequest(reply->request()));
+        return;
+    }
+
+    if (page.reply && d->currentPageSize > 0) {
+        const qint64 elapsed = d->clock.elapsed() - page.dispatched;
+        const qint64 bytes = rawData.size();
+        if (elapsed > d->targetPageLatency || bytes > d->targetPageBytes) {
+            d->currentPageSize = qMax(d->currentPageSize / 2, MinimumAdaptivePageSize);
+            qCDebug(KGAPIDebug) << "Page took" << elapsed << "ms and" << bytes << "bytes, decreasing page size to" << d->currentPageSize;
+        } else if (2 * elapsed < d->targetPageLatency && 2 * bytes < d->targetPageBytes) {
+            d->currentPageSize = d->clampPageSize(2 * d->currentPageSize);
+        }
+    }
+
+    const ObjectsList items = handleReplyWithItems(reply, rawData);
+    if (items.isEmpty()) {
+        return;
+    }
+
+    if (!d->streaming) {
+        d->items << items;
+    }
+    Q_EMIT itemsReceived(this, items);
+}
+
+bool FetchJob::handleError(int statusCode, const QByteArray &rawData)
+{
+    if (statusCode == GatewayTimeout && d->canShrinkPage()) {
+        const Private::Page page = d->takeFailedPage(statusCode);
+        if (page.reply) {
+            d->currentPageSize = qMax(d->currentPageSize / 2, MinimumAdaptivePageSize);
+            qCDebug(KGAPIDebug) << "Request for a page timed out, retrying with page size" << d->currentPageSize;
+            enqueueRequest(retryRequest(page.reply->request()));
+            return true;
+        }
+    }
+
+    return Job::handleError(statusCode, rawData);
 }
 
 void FetchJob::aboutToStart()
 {
     d->items.clear();
+    d->receivedSyncState.clear();
+    d->pages.clear();
+    d->clock.start();
+    d->currentPageSize = 0;
+    if (d->pageSize > 0) {
+        d->currentPageSize = d->clampPageSize(d->pageSize);
+    } else if (d->adaptivePageSize) {
+        d->currentPageSize = d->clampPageSize(DefaultAdaptivePageSize);
+    }
 
     Job::aboutToStart();
 }
 
+void FetchJob::emitFinished()
+{
+    Job::emitFinished();
+
+    if (!d->syncStateStore) {
+        return;
+    }
+
+    // Job::emitFinished() has already queued emission of the finished() signal,
+    // so this runs only once all its handlers have processed the items.
+    QTimer::singleShot(0, this, [this]() {
+        if (error() != KGAPI2::NoError || d->receivedSyncState.isEmpty()) {
+            return;
+        }
+        d->syncStateStore->commit(d->syncStateKey, d->receivedSyncState);
+        d->receivedSyncState.clear();
+    });
+}
+
 ObjectsList FetchJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
 {
     Q_UNUSED(reply)
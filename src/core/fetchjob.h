@@ -14,6 +14,8 @@
 namespace KGAPI2
 {
 
+class SyncStateStore;
+
 /**
  * @headerfile fetchjob.h
  * @brief Abstract superclass for all jobs that fetch resources from Google
@@ -57,6 +59,176 @@ public:
      */
     virtual ObjectsList items() const;
 
+    /**
+     * @brief Sets whether the fetched items are delivered incrementally only
+     *
+     * By default all fetched items are accumulated in the job and are
+     * available through items() once the job finishes. In streaming mode the
+     * items are only delivered through the itemsReceived() signal as soon as
+     * each page of results is parsed and the job does not keep them, so even
+     * large result sets do not have to be held in memory at once.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @since 6.4
+     */
+    void setStreaming(bool streaming);
+
+    /**
+     * @brief Returns whether the job is in streaming mode
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] bool isStreaming() const;
+
+    /**
+     * @brief Sets a store to persist state of incremental synchronization in
+     *
+     * Jobs that support incremental synchronization load the state stored
+     * under @p key when they start, unless the state has been set on the job
+     * explicitly. The new state received from the server is committed to the
+     * store only when the job has finished without an error and all handlers
+     * of the Job::finished signal have returned, so that a crash while the
+     * received items are being applied does not lose any changes. Call
+     * discardSyncState() from the handler if the items could not be applied.
+     *
+     * The store is not owned by the job and must outlive it.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @param store
+     * @param key Key identifying the synchronized collection in the store
+     *
+     * @since 6.4
+     */
+    void setSyncStateStore(SyncStateStore *store, const QString &key);
+
+    /**
+     * @brief Returns the sync state store or a null pointer
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] SyncStateStore *syncStateStore() const;
+
+    /**
+     * @brief Returns key under which the sync state is stored
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] QString syncStateKey() const;
+
+    /**
+     * @brief Prevents committing the received sync state to the store
+     *
+     * Can be called from a handler of the Job::finished signal. The next
+     * synchronization will then fetch the same changes again.
+     *
+     * @since 6.4
+     */
+    void discardSyncState();
+
+    /**
+     * @brief Sets number of items to request per page of results
+     *
+     * By default the job does not specify the page size and the server uses
+     * its own default, which is usually rather small for bulk synchronization.
+     * The value is clamped to the maximum supported by the respective API.
+     * Has no effect on jobs that do not fetch paged lists.
+     *
+     * When adaptive page size is enabled, this is the size of the first page.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @param pageSize Number of items per page, 0 to use the server default
+     *
+     * @since 6.4
+     */
+    void setPageSize(int pageSize);
+
+    /**
+     * @brief Returns number of items requested per page of results
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] int pageSize() const;
+
+    /**
+     * @brief Sets whether the page size is tuned while the job is running
+     *
+     * In adaptive mode the job doubles the page size as long as pages are
+     * received well within targetPageLatency() and targetPageBytes(), and
+     * halves it when a page exceeds either of them. When a request for a page
+     * times out, it is retried with half the page size instead of failing the
+     * job.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @since 6.4
+     */
+    void setAdaptivePageSize(bool adaptive);
+
+    /**
+     * @brief Returns whether the page size is tuned while the job is running
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] bool adaptivePageSize() const;
+
+    /**
+     * @brief Sets the time in which a page should be received in adaptive mode
+     *
+     * Requests taking more than five times as long are considered timed out
+     * and are retried with a smaller page. Requests for the smallest page
+     * don't time out. Defaults to one second.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @param msecs
+     *
+     * @since 6.4
+     */
+    void setTargetPageLatency(int msecs);
+
+    /**
+     * @brief Returns the time in which a page should be received in adaptive mode
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] int targetPageLatency() const;
+
+    /**
+     * @brief Sets the maximum size of a page response in adaptive mode
+     *
+     * Defaults to 1 MiB.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @param bytes
+     *
+     * @since 6.4
+     */
+    void setTargetPageBytes(qint64 bytes);
+
+    /**
+     * @brief Returns the maximum size of a page response in adaptive mode
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] qint64 targetPageBytes() const;
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted whenever a page of results has been parsed
+     *
+     * The signal is emitted regardless of the streaming mode.
+     *
+     * @param job The job that emitted the signal
+     * @param items Items parsed from the last received page
+     *
+     * @since 6.4
+     */
+    void itemsReceived(KGAPI2::FetchJob *job, const KGAPI2::ObjectsList &items);
+
 protected:
     /**
      * @brief KGAPI::Job::dispatchRequest implementation
@@ -76,11 +248,76 @@ protected:
      */
     void handleReply(const QNetworkReply *reply, const QByteArray &rawData) override;
 
+    /**
+     * @brief KGAPI::Job::handleError implementation
+     *
+     * Retries a request for a page that timed out on the gateway with a
+     * smaller page size when adaptive page size is enabled. Transfer
+     * timeouts have no status and are retried by handleReply().
+     *
+     * @param statusCode
+     * @param rawData
+     */
+    bool handleError(int statusCode, const QByteArray &rawData) override;
+
+    /**
+     * @brief KGAPI::Job::enqueueRequest implementation
+     *
+     * Sets the page size query parameter of the @p request.
+     *
+     * @param request
+     * @param data
+     * @param contentType
+     */
+    void enqueueRequest(const QNetworkRequest &request, const QByteArray &data = QByteArray(), const QString &contentType = QString()) override;
+
     /**
      * @brief KGAPI::Job::aboutToStart implementation
      */
     void aboutToStart() override;
 
+    /**
+     * @brief KGAPI::Job::emitFinished implementation
+     *
+     * Schedules commit of the received sync state.
+     */
+    void emitFinished() override;
+
+    /**
+     * @brief Returns the state loaded from the sync state store
+     *
+     * Returns an empty string when no store is set or nothing has been stored
+     * under the key yet.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] QString storedSyncState() const;
+
+    /**
+     * @brief Sets the state to commit to the sync state store
+     *
+     * Subclasses call this with the state received from the server. The state
+     * is committed once the job finishes successfully.
+     *
+     * @since 6.4
+     */
+    void setReceivedSyncState(const QString &state);
+
+    /**
+     * @brief Sets the query parameter that specifies the page size
+     *
+     * Subclasses that fetch paged lists call this from their constructor to
+     * enable support for setPageSize() and adaptive page size. The parameter
+     * is set on every request enqueued by the job, including requests for the
+     * following pages.
+     *
+     * @param parameter Name of the query parameter, e.g. "maxResults"
+     * @param maximum Maximum page size accepted by the API, 0 when unlimited
+     *
+     * @since 6.4
+     */
+    void setPageSizeParameter(const QString &parameter, int maximum = 0);
+
     /**
      * @brief A reply handler that returns items parsed from \@ rawData
      *
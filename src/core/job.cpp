@@ -147,6 +147,17 @@ void Job::Private::_k_doEmitFinished()
 
 void Job::Private::_k_replyReceived(QNetworkReply *reply)
 {
+    if (pendingReplies > 0) {
+        --pendingReplies;
+    }
+
+    // A reply to a request dispatched before the job has finished (e.g. due to an
+    // error in another request), there is nobody to deliver it to anymore.
+    if (!isRunning) {
+        qCDebug(KGAPIDebug) << "Ignoring reply from" << reply->url() << "received after the job has finished";
+        return;
+    }
+
     int replyCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
     if (replyCode == 0) {
         /* Workaround for a bug (??), when QNetworkReply does not report HTTP/1.1 401 Unauthorized
@@ -170,6 +181,7 @@ void Job::Private::_k_replyReceived(QNetworkReply *reply)
     case KGAPI2::OK: /** << OK status (fetched, updated, removed) */
     case KGAPI2::Created: /** << OK status (created) */
     case KGAPI2::NoContent: /** << OK status (removed task using Tasks API) */
+    case KGAPI2::PartialContent: /** << OK status (fetched a range of file content) */
     case KGAPI2::ResumeIncomplete: /** << OK status (partially uploaded a file via resumable upload) */
         q->handleReply(reply, rawData);
         break;
@@ -178,9 +190,12 @@ void Job::Private::_k_replyReceived(QNetworkReply *reply)
                                                 method */
     case KGAPI2::TemporarilyMoved: { /** << Temporarily moved - Google provides a new URL where to send the request */
         qCDebug(KGAPIDebug) << "Google says: Temporarily moved to " << reply->header(QNetworkRequest::LocationHeader).toUrl();
-        QNetworkRequest request = currentRequest.request;
+        // Not necessarily the last dispatched request when more requests are in flight
+        QNetworkRequest request = reply->request();
         request.setUrl(reply->header(QNetworkRequest::LocationHeader).toUrl());
-        q->enqueueRequest(request, currentRequest.rawData, currentRequest.contentType);
+        q->enqueueRequest(request,
+                          request.attribute(RequestRawDataAttribute).toByteArray(),
+                          request.attribute(RequestContentTypeAttribute).toString());
         break;
     }
 
@@ -227,6 +242,7 @@ void Job::Private::_k_replyReceived(QNetworkReply *reply)
         break;
 
     case KGAPI2::Conflict:
+    case KGAPI2::PreconditionFailed: /** << Precondition Failed - the If-Match ETag does not match the remote resource */
         if (!q->handleError(replyCode, rawData)) {
             qCWarning(KGAPIDebug) << "Conflict. Remote resource is newer then local.";
             const QString msg = parseErrorMessage(rawData);
@@ -308,9 +324,11 @@ void Job::Private::_k_replyReceived(QNetworkReply *reply)
         return;
     }
 
-    qCDebug(KGAPIDebug) << requestQueue.length() << "requests in requestQueue.";
+    qCDebug(KGAPIDebug) << requestQueue.length() << "requests in requestQueue," << pendingReplies << "replies pending.";
     if (requestQueue.isEmpty()) {
-        q->emitFinished();
+        if (pendingReplies == 0) {
+            q->emitFinished();
+        }
         return;
     }
 
@@ -327,9 +345,10 @@ void Job::Private::_k_dispatchTimeout()
     }
 
     const Request r = requestQueue.dequeue();
-    currentRequest = r;
 
     QNetworkRequest authorizedRequest = r.request;
+    authorizedRequest.setAttribute(RequestRawDataAttribute, r.rawData);
+    authorizedRequest.setAttribute(RequestContentTypeAttribute, r.contentType);
     if (account) {
         authorizedRequest.setRawHeader("Authorization", "Bearer " + account->accessToken().toLatin1());
     }
@@ -351,6 +370,7 @@ void Job::Private::_k_dispatchTimeout()
     FileLogger::self()->logRequest(authorizedRequest, r.rawData);
 
     q->dispatchRequest(accessManager, authorizedRequest, r.rawData, r.contentType);
+    ++pendingReplies;
 
     if (requestQueue.isEmpty()) {
         dispatchTimer->stop();
@@ -540,9 +560,7 @@ void Job::aboutToStart()
 {
     d->error = KGAPI2::NoError;
     d->errorString.clear();
-    d->currentRequest.contentType.clear();
-    d->currentRequest.rawData.clear();
-    d->currentRequest.request = QNetworkRequest();
+    d->pendingReplies = 0;
     d->dispatchTimer->setInterval(0);
 }
 
@@ -26,6 +26,12 @@ struct Request {
     QString contentType;
 };
 
+/* Attributes of the dispatched requests carrying the rest of the Request, so
+ * that it can be sent again from the reply. QNetworkRequest::User is left to
+ * the jobs. */
+static constexpr auto RequestRawDataAttribute = static_cast<QNetworkRequest::Attribute>(QNetworkRequest::UserMax);
+static constexpr auto RequestContentTypeAttribute = static_cast<QNetworkRequest::Attribute>(QNetworkRequest::UserMax - 1);
+
 class Q_DECL_HIDDEN FileLogger
 {
 public:
@@ -68,8 +74,10 @@ public:
     int maxTimeout;
     bool prettyPrint;
     QStringList fields;
-
-    Request currentRequest;
+    /* Number of dispatched requests that have not received a reply yet. The
+     * job only finishes once all of them have been answered, so that jobs
+     * can have multiple requests in flight at the same time. */
+    int pendingReplies = 0;
 
 private:
     Job *const q;
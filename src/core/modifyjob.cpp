@@ -56,6 +56,10 @@ void ModifyJob::dispatchRequest(QNetworkAccessManager *accessManager, const QNet
         r.setRawHeader("If-Match", "*");
     }
 
+    // Subclasses can request a different verb (e.g. PATCH) through the
+    // CustomVerbAttribute of the request, PUT is used by default.
+    const QByteArray verb = r.attribute(QNetworkRequest::CustomVerbAttribute, QByteArrayLiteral("PUT")).toByteArray();
+
     // Note: there is a problem with PUT when using QNAM - it
     // doesn't transfer the body correctly.
     // Using sendCustomRequest() works just fine.
@@ -66,9 +70,9 @@ void ModifyJob::dispatchRequest(QNetworkAccessManager *accessManager, const QNet
         d->buffer.close();
         d->buffer.setData(data);
         d->buffer.open(QIODevice::ReadOnly);
-        accessManager->sendCustomRequest(r, "PUT", &d->buffer);
+        accessManager->sendCustomRequest(r, verb, &d->buffer);
     } else {
-        accessManager->sendCustomRequest(r, "PUT");
+        accessManager->sendCustomRequest(r, verb);
     }
 }
 
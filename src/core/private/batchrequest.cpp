@@ -0,0 +1,294 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "batchrequest_p.h"
+#include "debug.h"
+
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <algorithm>
+
+using namespace KGAPI2;
+
+namespace
+{
+static const QByteArray CRLF = QByteArrayLiteral("\r\n");
+static const QByteArray ItemIdPrefix = QByteArrayLiteral("item-");
+static const QByteArray ResponseIdPrefix = QByteArrayLiteral("response-");
+
+int headerBoundary(const QByteArray &data, int from, int *separatorLength)
+{
+    int idx = data.indexOf("\r\n\r\n", from);
+    *separatorLength = 4;
+    if (idx == -1) {
+        idx = data.indexOf("\n\n", from);
+        *separatorLength = 2;
+    }
+    return idx;
+}
+
+QByteArray headerValue(const QByteArray &headers, const QByteArray &name)
+{
+    const auto lines = headers.split('\n');
+    for (const QByteArray &line : lines) {
+        const int colon = line.indexOf(':');
+        if (colon > 0 && line.left(colon).trimmed().compare(name, Qt::CaseInsensitive) == 0) {
+            return line.mid(colon + 1).trimmed();
+        }
+    }
+    return {};
+}
+
+int contentIdToIndex(QByteArray contentId)
+{
+    if (contentId.startsWith('<') && contentId.endsWith('>')) {
+        contentId = contentId.mid(1, contentId.size() - 2);
+    }
+    if (contentId.startsWith(ResponseIdPrefix)) {
+        contentId = contentId.mid(ResponseIdPrefix.size());
+    }
+    if (!contentId.startsWith(ItemIdPrefix)) {
+        return -1;
+    }
+
+    bool ok = false;
+    const int index = contentId.mid(ItemIdPrefix.size()).toInt(&ok);
+    return ok ? index : -1;
+}
+}
+
+BatchRequest::BatchRequest(const QUrl &batchUrl)
+    : mBatchUrl(batchUrl)
+{
+}
+
+void BatchRequest::addRequest(const QByteArray &verb, const QUrl &url, const QByteArray &data, const QString &contentType, const RawHeaders &headers)
+{
+    mParts.push_back({verb, url, data, contentType, headers});
+}
+
+int BatchRequest::count() const
+{
+    return mParts.size();
+}
+
+bool BatchRequest::isEmpty() const
+{
+    return mParts.isEmpty();
+}
+
+QNetworkRequest BatchRequest::request() const
+{
+    QNetworkRequest request(mBatchUrl);
+    request.setHeader(QNetworkRequest::ContentTypeHeader, contentType());
+    return request;
+}
+
+QByteArray BatchRequest::boundary() const
+{
+    // The boundary is derived from the content so that it never appears in
+    // any of the parts, while keeping the output deterministic.
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    for (const Part &part : mParts) {
+        hash.addData(part.verb);
+        hash.addData(part.url.toEncoded());
+        hash.addData(part.data);
+    }
+    return "batch_" + hash.result().toHex();
+}
+
+QByteArray BatchRequest::data() const
+{
+    const QByteArray boundary = "--" + this->boundary();
+
+    QByteArray data;
+    for (int i = 0; i < mParts.size(); ++i) {
+        const Part &part = mParts.at(i);
+        data += boundary + CRLF;
+        data += "Content-Type: application/http" + CRLF;
+        data += "Content-ID: <" + ItemIdPrefix + QByteArray::number(i) + '>' + CRLF;
+        data += CRLF;
+
+        QByteArray path = part.url.path(QUrl::FullyEncoded).toLatin1();
+        if (part.url.hasQuery()) {
+            path += '?' + part.url.query(QUrl::FullyEncoded).toLatin1();
+        }
+        data += part.verb + ' ' + path + " HTTP/1.1" + CRLF;
+        for (const auto &header : part.headers) {
+            data += header.first + ": " + header.second + CRLF;
+        }
+        if (!part.data.isEmpty()) {
+            data += "Content-Type: " + part.contentType.toLatin1() + CRLF;
+            data += "Content-Length: " + QByteArray::number(part.data.size()) + CRLF;
+        }
+        data += CRLF;
+        if (!part.data.isEmpty()) {
+            data += part.data + CRLF;
+        }
+    }
+    data += boundary + "--" + CRLF;
+
+    return data;
+}
+
+QString BatchRequest::contentType() const
+{
+    return QStringLiteral("multipart/mixed; boundary=%1").arg(QString::fromLatin1(boundary()));
+}
+
+bool BatchRequest::isBatchResponse(const QString &contentType)
+{
+    return contentType.startsWith(QLatin1StringView("multipart/mixed"), Qt::CaseInsensitive);
+}
+
+QList<BatchRequest::Response> BatchRequest::parseResponse(const QString &contentType, const QByteArray &rawData, int count)
+{
+    QList<Response> responses(count);
+    for (int i = 0; i < count; ++i) {
+        responses[i].index = i;
+    }
+
+    const int boundaryIdx = contentType.indexOf(QLatin1StringView("boundary="), 0, Qt::CaseInsensitive);
+    if (boundaryIdx == -1) {
+        qCWarning(KGAPIDebug) << "Batch response without boundary:" << contentType;
+        return responses;
+    }
+    QByteArray boundary = contentType.mid(boundaryIdx + 9).section(QLatin1Char(';'), 0, 0).trimmed().toLatin1();
+    if (boundary.startsWith('"') && boundary.endsWith('"')) {
+        boundary = boundary.mid(1, boundary.size() - 2);
+    }
+    const QByteArray delimiter = "--" + boundary;
+
+    int pos = rawData.indexOf(delimiter);
+    while (pos != -1) {
+        pos += delimiter.size();
+        if (rawData.mid(pos, 2) == "--") {
+            break; // closing delimiter
+        }
+        const int next = rawData.indexOf(delimiter, pos);
+        const QByteArray part = rawData.mid(pos, next == -1 ? -1 : next - pos);
+        pos = next;
+
+        int separatorLength = 0;
+        const int partHeadersEnd = headerBoundary(part, 0, &separatorLength);
+        if (partHeadersEnd == -1) {
+            continue;
+        }
+
+        const int index = contentIdToIndex(headerValue(part.left(partHeadersEnd), "Content-ID"));
+        if (index < 0 || index >= count) {
+            qCWarning(KGAPIDebug) << "Batch response part without valid Content-ID, ignoring";
+            continue;
+        }
+        Response &response = responses[index];
+
+        // The body of the part is a complete HTTP response
+        const QByteArray http = part.mid(partHeadersEnd + separatorLength);
+        const int statusLineEnd = http.indexOf('\n');
+        const QList<QByteArray> statusLine = http.left(statusLineEnd).trimmed().split(' ');
+        response.statusCode = statusLine.size() > 1 ? statusLine.at(1).toInt() : 0;
+
+        const int httpHeadersEnd = headerBoundary(http, 0, &separatorLength);
+        if (httpHeadersEnd != -1) {
+            if (httpHeadersEnd > statusLineEnd) {
+                const QByteArray httpHeaders = http.mid(statusLineEnd + 1, httpHeadersEnd - statusLineEnd - 1);
+                response.contentType = headerValue(httpHeaders, "Content-Type");
+            }
+            response.body = http.mid(httpHeadersEnd + separatorLength).trimmed();
+        }
+    }
+
+    return responses;
+}
+
+ItemResult BatchRequest::appendResults(const QString &contentType,
+                                       const QByteArray &rawData,
+                                       int count,
+                                       ItemResultsList &results,
+                                       const ObjectParser &parse,
+                                       ObjectsList *objects)
+{
+    // Only the first failure is reported by the job, the rest is available
+    // through the results
+    const bool failedBefore = std::any_of(results.cbegin(), results.cend(), [](const ItemResult &result) {
+        return result.error != KGAPI2::NoError;
+    });
+
+    ItemResult failure;
+    const auto responses = parseResponse(contentType, rawData, count);
+    for (const auto &response : responses) {
+        ItemResult result;
+        result.error = response.error();
+        if (result.error == KGAPI2::NoError) {
+            if (parse) {
+                result.object = parse(response.body);
+                if (objects) {
+                    *objects << result.object;
+                }
+            }
+        } else {
+            result.errorString = response.errorString();
+            if (!failedBefore && failure.error == KGAPI2::NoError) {
+                failure = result;
+            }
+        }
+        results << result;
+    }
+
+    return failure;
+}
+
+KGAPI2::Error BatchRequest::Response::error() const
+{
+    if (statusCode >= 200 && statusCode < 300) {
+        return KGAPI2::NoError;
+    }
+
+    switch (statusCode) {
+    case KGAPI2::NotModified:
+    case KGAPI2::BadRequest:
+    case KGAPI2::Unauthorized:
+    case KGAPI2::Forbidden:
+    case KGAPI2::NotFound:
+    case KGAPI2::Conflict:
+    case KGAPI2::Gone:
+    case KGAPI2::InternalError:
+    case KGAPI2::QuotaExceeded:
+        return static_cast<KGAPI2::Error>(statusCode);
+    case KGAPI2::PreconditionFailed:
+        return KGAPI2::Conflict;
+    case 429: // Too Many Requests
+        return KGAPI2::QuotaExceeded;
+    default:
+        return KGAPI2::UnknownError;
+    }
+}
+
+QString BatchRequest::Response::errorString() const
+{
+    if (error() == KGAPI2::NoError) {
+        return {};
+    }
+    if (statusCode == 0) {
+        return QCoreApplication::translate("BatchRequest", "Server did not respond to the request in the batch.");
+    }
+
+    const QJsonDocument document = QJsonDocument::fromJson(body);
+    if (document.isObject()) {
+        const QJsonObject error = document.object().value(QStringLiteral("error")).toObject();
+        const QString message = error.value(QStringLiteral("message")).toString();
+        if (!message.isEmpty()) {
+            return message;
+        }
+    }
+
+    return QString::fromUtf8(body);
+}
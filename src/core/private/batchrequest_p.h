@@ -0,0 +1,114 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "kgapicore_export.h"
+#include "types.h"
+
+#include <QByteArray>
+#include <QList>
+#include <QNetworkRequest>
+#include <QPair>
+#include <QUrl>
+
+#include <functional>
+
+namespace KGAPI2
+{
+
+/**
+ * @internal
+ *
+ * Helper to pack multiple API calls into a single multipart/mixed request
+ * for Google's batch endpoints and to split the batch response back into
+ * responses of the individual calls.
+ *
+ * Each call is assigned a Content-ID equal to its index within the batch,
+ * so responses can be mapped back to their calls regardless of the order
+ * in which the server returns them.
+ */
+class KGAPICORE_EXPORT BatchRequest
+{
+public:
+    /**
+     * Maximum number of calls Google accepts in a single batch request
+     * for the Calendar API. Other APIs allow up to 100 calls.
+     */
+    static constexpr int MaxCalendarBatchSize = 50;
+    static constexpr int MaxBatchSize = 100;
+
+    struct Response {
+        int index = -1;
+        int statusCode = 0;
+        QByteArray contentType;
+        QByteArray body;
+
+        /** Returns the status code converted to KGAPI2::Error */
+        [[nodiscard]] KGAPI2::Error error() const;
+        /** Returns the error message reported by the server, if any */
+        [[nodiscard]] QString errorString() const;
+    };
+
+    explicit BatchRequest(const QUrl &batchUrl);
+
+    using RawHeaders = QList<QPair<QByteArray, QByteArray>>;
+
+    void addRequest(const QByteArray &verb, const QUrl &url, const QByteArray &data = {}, const QString &contentType = {}, const RawHeaders &headers = {});
+    [[nodiscard]] int count() const;
+    [[nodiscard]] bool isEmpty() const;
+
+    /** The outer request to be enqueued, with the multipart Content-Type set */
+    [[nodiscard]] QNetworkRequest request() const;
+    /** Serialized multipart body of the batch */
+    [[nodiscard]] QByteArray data() const;
+    [[nodiscard]] QString contentType() const;
+
+    [[nodiscard]] static bool isBatchResponse(const QString &contentType);
+
+    /**
+     * Parses a multipart/mixed response to a batch of @p count calls.
+     *
+     * The returned list always has @p count entries, the response to the
+     * call at index i is at position i. Calls the server did not respond
+     * to are reported with statusCode 0.
+     */
+    [[nodiscard]] static QList<Response> parseResponse(const QString &contentType, const QByteArray &rawData, int count);
+
+    using ObjectParser = std::function<ObjectPtr(const QByteArray &)>;
+
+    /**
+     * Parses a multipart/mixed response to a batch of @p count calls and
+     * appends a result of each call to @p results. Objects of the successful
+     * calls are created from their bodies by @p parse, if given, and appended
+     * to @p objects as well.
+     *
+     * Returns the failure the job should report, i.e. the first failed call
+     * of the batch, or a result with KGAPI2::NoError when all calls have
+     * succeeded or when a call of a previous batch, already in @p results,
+     * has failed.
+     */
+    [[nodiscard]] static ItemResult
+    appendResults(const QString &contentType, const QByteArray &rawData, int count, ItemResultsList &results, const ObjectParser &parse = {}, ObjectsList *objects = nullptr);
+
+private:
+    struct Part {
+        QByteArray verb;
+        QUrl url;
+        QByteArray data;
+        QString contentType;
+        RawHeaders headers;
+    };
+
+    [[nodiscard]] QByteArray boundary() const;
+
+    QUrl mBatchUrl;
+    QList<Part> mParts;
+};
+
+} // namespace KGAPI2
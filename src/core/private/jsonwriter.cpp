@@ -0,0 +1,245 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "jsonwriter_p.h"
+
+#include <QLocale>
+
+#include <cmath>
+
+using namespace KGAPI2;
+
+namespace
+{
+void appendAscii(QByteArray &out, char c)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    switch (c) {
+    case '"':
+        out += "\\\"";
+        break;
+    case '\\':
+        out += "\\\\";
+        break;
+    case '\b':
+        out += "\\b";
+        break;
+    case '\f':
+        out += "\\f";
+        break;
+    case '\n':
+        out += "\\n";
+        break;
+    case '\r':
+        out += "\\r";
+        break;
+    case '\t':
+        out += "\\t";
+        break;
+    default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+            out += "\\u00";
+            out += hex[(c >> 4) & 0xf];
+            out += hex[c & 0xf];
+        } else {
+            out += c;
+        }
+    }
+}
+
+void appendCodePoint(QByteArray &out, char32_t u)
+{
+    if (u < 0x80) {
+        appendAscii(out, static_cast<char>(u));
+    } else if (u < 0x800) {
+        out += static_cast<char>(0xc0 | (u >> 6));
+        out += static_cast<char>(0x80 | (u & 0x3f));
+    } else if (u < 0x10000) {
+        out += static_cast<char>(0xe0 | (u >> 12));
+        out += static_cast<char>(0x80 | ((u >> 6) & 0x3f));
+        out += static_cast<char>(0x80 | (u & 0x3f));
+    } else {
+        out += static_cast<char>(0xf0 | (u >> 18));
+        out += static_cast<char>(0x80 | ((u >> 12) & 0x3f));
+        out += static_cast<char>(0x80 | ((u >> 6) & 0x3f));
+        out += static_cast<char>(0x80 | (u & 0x3f));
+    }
+}
+
+void appendEscaped(QByteArray &out, QStringView str)
+{
+    for (qsizetype i = 0, size = str.size(); i < size; ++i) {
+        char32_t u = str.at(i).unicode();
+        if (QChar::isHighSurrogate(u) && i + 1 < size && str.at(i + 1).isLowSurrogate()) {
+            u = QChar::surrogateToUcs4(static_cast<char16_t>(u), str.at(++i).unicode());
+        } else if (QChar::isSurrogate(u)) {
+            u = QChar::ReplacementCharacter;
+        }
+        appendCodePoint(out, u);
+    }
+}
+
+void appendEscaped(QByteArray &out, QLatin1StringView str)
+{
+    for (const char c : str) {
+        appendCodePoint(out, static_cast<unsigned char>(c));
+    }
+}
+
+void appendEscaped(QByteArray &out, QUtf8StringView str)
+{
+    // Multi-byte sequences are copied verbatim, only ASCII needs escaping
+    for (const char c : str) {
+        if (static_cast<unsigned char>(c) < 0x80) {
+            appendAscii(out, c);
+        } else {
+            out += c;
+        }
+    }
+}
+}
+
+JsonWriter::JsonWriter(qsizetype reserve)
+{
+    mData.reserve(reserve);
+}
+
+void JsonWriter::writeSeparator()
+{
+    if (mAfterKey) {
+        mAfterKey = false;
+        return;
+    }
+    if (!mHasElements.isEmpty()) {
+        if (mHasElements.last()) {
+            mData += ',';
+        }
+        mHasElements.last() = true;
+    }
+}
+
+void JsonWriter::writeString(QAnyStringView str)
+{
+    mData += '"';
+    str.visit([this](auto view) {
+        appendEscaped(mData, view);
+    });
+    mData += '"';
+}
+
+void JsonWriter::writeKey(QAnyStringView key)
+{
+    writeSeparator();
+    writeString(key);
+    mData += ':';
+    mAfterKey = true;
+}
+
+JsonWriter &JsonWriter::beginObject()
+{
+    writeSeparator();
+    mData += '{';
+    mHasElements.push_back(false);
+    return *this;
+}
+
+JsonWriter &JsonWriter::beginObject(QAnyStringView key)
+{
+    writeKey(key);
+    return beginObject();
+}
+
+JsonWriter &JsonWriter::endObject()
+{
+    mHasElements.removeLast();
+    mData += '}';
+    return *this;
+}
+
+JsonWriter &JsonWriter::beginArray()
+{
+    writeSeparator();
+    mData += '[';
+    mHasElements.push_back(false);
+    return *this;
+}
+
+JsonWriter &JsonWriter::beginArray(QAnyStringView key)
+{
+    writeKey(key);
+    return beginArray();
+}
+
+JsonWriter &JsonWriter::endArray()
+{
+    mHasElements.removeLast();
+    mData += ']';
+    return *this;
+}
+
+JsonWriter &JsonWriter::value(QAnyStringView value)
+{
+    writeSeparator();
+    writeString(value);
+    return *this;
+}
+
+JsonWriter &JsonWriter::value(const char *value)
+{
+    return this->value(QAnyStringView(QUtf8StringView(value)));
+}
+
+JsonWriter &JsonWriter::value(bool value)
+{
+    writeSeparator();
+    mData += value ? "true" : "false";
+    return *this;
+}
+
+JsonWriter &JsonWriter::value(int value)
+{
+    return this->value(static_cast<qint64>(value));
+}
+
+JsonWriter &JsonWriter::value(qint64 value)
+{
+    writeSeparator();
+    mData += QByteArray::number(value);
+    return *this;
+}
+
+JsonWriter &JsonWriter::value(double value)
+{
+    writeSeparator();
+    // JSON has no representation for NaN and infinity, QJsonDocument writes null as well
+    if (std::isfinite(value)) {
+        mData += QByteArray::number(value, 'g', QLocale::FloatingPointShortest);
+    } else {
+        mData += "null";
+    }
+    return *this;
+}
+
+JsonWriter &JsonWriter::nullValue()
+{
+    writeSeparator();
+    mData += "null";
+    return *this;
+}
+
+JsonWriter &JsonWriter::insertNull(QAnyStringView key)
+{
+    writeKey(key);
+    return nullValue();
+}
+
+QByteArray JsonWriter::data() const
+{
+    return mData;
+}
@@ -0,0 +1,77 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "kgapicore_export.h"
+
+#include <QAnyStringView>
+#include <QByteArray>
+#include <QVarLengthArray>
+
+namespace KGAPI2
+{
+
+/**
+ * @internal
+ *
+ * Streaming writer producing compact JSON directly into a QByteArray.
+ *
+ * Serializers use it instead of building a QVariantMap tree and converting
+ * it through QJsonDocument, which saves an allocation for every key, value
+ * and nested container of the serialized object.
+ *
+ * The writer does not validate the structure, it is up to the caller to
+ * balance begin/end calls and to write a key before each value inside an
+ * object. Keys are written in the order in which they are inserted and are
+ * expected to be unique within an object.
+ */
+class KGAPICORE_EXPORT JsonWriter
+{
+public:
+    explicit JsonWriter(qsizetype reserve = 1024);
+
+    JsonWriter &beginObject();
+    JsonWriter &beginObject(QAnyStringView key);
+    JsonWriter &endObject();
+
+    JsonWriter &beginArray();
+    JsonWriter &beginArray(QAnyStringView key);
+    JsonWriter &endArray();
+
+    JsonWriter &value(QAnyStringView value);
+    JsonWriter &value(const char *value);
+    JsonWriter &value(bool value);
+    JsonWriter &value(int value);
+    JsonWriter &value(qint64 value);
+    JsonWriter &value(double value);
+    JsonWriter &nullValue();
+
+    template<typename T>
+    JsonWriter &insert(QAnyStringView key, const T &v)
+    {
+        writeKey(key);
+        return value(v);
+    }
+    JsonWriter &insertNull(QAnyStringView key);
+
+    /** Returns the JSON written so far */
+    [[nodiscard]] QByteArray data() const;
+
+private:
+    void writeSeparator();
+    void writeKey(QAnyStringView key);
+    void writeString(QAnyStringView str);
+
+    QByteArray mData;
+    // For each open container whether it already has an element
+    QVarLengthArray<bool, 8> mHasElements;
+    bool mAfterKey = false;
+};
+
+} // namespace KGAPI2
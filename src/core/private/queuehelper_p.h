@@ -31,11 +31,28 @@ public:
         ++m_iter;
     }
 
+    void currentProcessed(int count)
+    {
+        for (int i = 0; i < count && !atEnd(); ++i) {
+            ++m_iter;
+        }
+    }
+
     T current()
     {
         return *m_iter;
     }
 
+    QList<T> peek(int count) const
+    {
+        QList<T> items;
+        items.reserve(count);
+        for (auto it = m_iter; it != m_items.constEnd() && items.count() < count; ++it) {
+            items << *it;
+        }
+        return items;
+    }
+
     QueueHelper &operator<<(const T &item)
     {
         m_items << item;
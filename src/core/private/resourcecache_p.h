@@ -0,0 +1,73 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+
+#include <optional>
+
+namespace KGAPI2
+{
+
+/**
+ * Thread-safe process-wide cache of rarely changing resources, revalidated
+ * with the ETag the server returned for them.
+ */
+template<typename T>
+class ResourceCache
+{
+public:
+    struct Entry {
+        QByteArray etag;
+        T value;
+        // When the server last confirmed the value is current
+        QDateTime validated;
+    };
+
+    std::optional<Entry> find(const QString &key) const
+    {
+        QMutexLocker locker(&m_lock);
+        const auto it = m_entries.constFind(key);
+        if (it == m_entries.cend()) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    void insert(const QString &key, const QByteArray &etag, const T &value)
+    {
+        QMutexLocker locker(&m_lock);
+        m_entries.insert(key, Entry{etag, value, QDateTime::currentDateTimeUtc()});
+    }
+
+    void revalidated(const QString &key)
+    {
+        QMutexLocker locker(&m_lock);
+        const auto it = m_entries.find(key);
+        if (it != m_entries.end()) {
+            it->validated = QDateTime::currentDateTimeUtc();
+        }
+    }
+
+    void clear()
+    {
+        QMutexLocker locker(&m_lock);
+        m_entries.clear();
+    }
+
+private:
+    mutable QMutex m_lock;
+    QHash<QString, Entry> m_entries;
+};
+
+} // namespace KGAPI2
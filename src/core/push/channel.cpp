@@ -0,0 +1,193 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "channel.h"
+#include "private/jsonwriter_p.h"
+#include "utils_p.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTimeZone>
+
+using namespace KGAPI2;
+
+namespace
+{
+static const auto KindAttr = QStringLiteral("kind");
+static const auto IdAttr = QStringLiteral("id");
+static const auto TypeAttr = QStringLiteral("type");
+static const auto AddressAttr = QStringLiteral("address");
+static const auto TokenAttr = QStringLiteral("token");
+static const auto ExpirationAttr = QStringLiteral("expiration");
+static const auto ResourceIdAttr = QStringLiteral("resourceId");
+static const auto ResourceUriAttr = QStringLiteral("resourceUri");
+
+static const auto ChannelKind = QLatin1StringView("api#channel");
+static const auto WebHookType = QLatin1StringView("web_hook");
+}
+
+class Q_DECL_HIDDEN Channel::Private
+{
+public:
+    QString id;
+    QUrl address;
+    QString token;
+    QDateTime expiration;
+    QString resourceId;
+    QUrl resourceUri;
+};
+
+Channel::Channel()
+    : Object()
+    , d(new Private)
+{
+}
+
+Channel::Channel(const QString &id, const QUrl &address, const QString &token)
+    : Object()
+    , d(new Private)
+{
+    d->id = id;
+    d->address = address;
+    d->token = token;
+}
+
+Channel::Channel(const Channel &other)
+    : Object(other)
+    , d(new Private(*(other.d)))
+{
+}
+
+Channel::~Channel()
+{
+    delete d;
+}
+
+bool Channel::operator==(const Channel &other) const
+{
+    if (!Object::operator==(other)) {
+        return false;
+    }
+    GAPI_COMPARE(id)
+    GAPI_COMPARE(address)
+    GAPI_COMPARE(token)
+    GAPI_COMPARE(expiration)
+    GAPI_COMPARE(resourceId)
+    GAPI_COMPARE(resourceUri)
+    return true;
+}
+
+void Channel::setId(const QString &id)
+{
+    d->id = id;
+}
+
+QString Channel::id() const
+{
+    return d->id;
+}
+
+void Channel::setAddress(const QUrl &address)
+{
+    d->address = address;
+}
+
+QUrl Channel::address() const
+{
+    return d->address;
+}
+
+void Channel::setToken(const QString &token)
+{
+    d->token = token;
+}
+
+QString Channel::token() const
+{
+    return d->token;
+}
+
+void Channel::setExpiration(const QDateTime &expiration)
+{
+    d->expiration = expiration;
+}
+
+QDateTime Channel::expiration() const
+{
+    return d->expiration;
+}
+
+QString Channel::type() const
+{
+    return WebHookType;
+}
+
+void Channel::setResourceId(const QString &resourceId)
+{
+    d->resourceId = resourceId;
+}
+
+QString Channel::resourceId() const
+{
+    return d->resourceId;
+}
+
+void Channel::setResourceUri(const QUrl &resourceUri)
+{
+    d->resourceUri = resourceUri;
+}
+
+QUrl Channel::resourceUri() const
+{
+    return d->resourceUri;
+}
+
+ChannelPtr Channel::fromJSON(const QByteArray &jsonData)
+{
+    const QJsonDocument document = QJsonDocument::fromJson(jsonData);
+    if (!document.isObject()) {
+        return ChannelPtr();
+    }
+
+    const QJsonObject data = document.object();
+    if (data.value(KindAttr).toString() != ChannelKind) {
+        return ChannelPtr();
+    }
+
+    auto channel = ChannelPtr::create();
+    channel->setId(data.value(IdAttr).toString());
+    channel->setAddress(QUrl(data.value(AddressAttr).toString()));
+    channel->setToken(data.value(TokenAttr).toString());
+    channel->setResourceId(data.value(ResourceIdAttr).toString());
+    channel->setResourceUri(QUrl(data.value(ResourceUriAttr).toString()));
+    // Expiration is a number of milliseconds since epoch sent as a string
+    const qint64 expiration = data.value(ExpirationAttr).toString().toLongLong();
+    if (expiration > 0) {
+        channel->setExpiration(QDateTime::fromMSecsSinceEpoch(expiration, QTimeZone::UTC));
+    }
+
+    return channel;
+}
+
+QByteArray Channel::toJSON(const ChannelPtr &channel)
+{
+    JsonWriter writer(256);
+    writer.beginObject();
+    writer.insert(IdAttr, channel->id());
+    writer.insert(TypeAttr, WebHookType);
+    writer.insert(AddressAttr, channel->address().toString(QUrl::FullyEncoded));
+    if (!channel->token().isEmpty()) {
+        writer.insert(TokenAttr, channel->token());
+    }
+    if (channel->expiration().isValid()) {
+        writer.insert(ExpirationAttr, QString::number(channel->expiration().toMSecsSinceEpoch()));
+    }
+    writer.endObject();
+
+    return writer.data();
+}
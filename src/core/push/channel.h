@@ -0,0 +1,184 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "kgapicore_export.h"
+#include "object.h"
+#include "types.h"
+
+#include <QDateTime>
+#include <QUrl>
+
+namespace KGAPI2
+{
+
+/**
+ * @brief Channel represents a push notification channel
+ *
+ * A channel is created by a watch job (e.g. EventWatchJob or
+ * Drive::ChangeWatchJob). Once it is established, Google sends an HTTP POST
+ * request to the channel's address every time the watched resource changes.
+ * Such notifications can be received with WebhookReceiver.
+ *
+ * The channel ID and token are chosen by the client. The resource ID is
+ * assigned by the server and together with the channel ID it is needed to
+ * stop the channel with ChannelStopJob.
+ *
+ * @see https://developers.google.com/calendar/api/guides/push
+ * @since 6.4
+ */
+class KGAPICORE_EXPORT Channel : public KGAPI2::Object
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    Channel();
+
+    /**
+     * @brief Constructs a channel with given @p id that will deliver
+     *        notifications to given @p address.
+     *
+     * @param id Client-chosen, unique ID of the channel
+     * @param address HTTPS URL to deliver the notifications to
+     * @param token Arbitrary string sent back with every notification
+     */
+    explicit Channel(const QString &id, const QUrl &address, const QString &token = QString());
+
+    /**
+     * @brief Copy constructor
+     */
+    Channel(const Channel &other);
+
+    /**
+     * @brief Destructor
+     */
+    ~Channel() override;
+
+    bool operator==(const Channel &other) const;
+    bool operator!=(const Channel &other) const
+    {
+        return !operator==(other);
+    }
+
+    /**
+     * @brief Sets the ID of the channel.
+     *
+     * The ID must be unique for each new channel created for the project,
+     * for example a UUID.
+     *
+     * @param id
+     */
+    void setId(const QString &id);
+
+    /**
+     * @brief Returns the ID of the channel.
+     */
+    [[nodiscard]] QString id() const;
+
+    /**
+     * @brief Sets the address to which notifications are delivered.
+     *
+     * Google only delivers notifications to HTTPS addresses with a valid
+     * certificate.
+     *
+     * @param address
+     */
+    void setAddress(const QUrl &address);
+
+    /**
+     * @brief Returns the address to which notifications are delivered.
+     */
+    [[nodiscard]] QUrl address() const;
+
+    /**
+     * @brief Sets the verification token of the channel.
+     *
+     * The token is sent back in the X-Goog-Channel-Token header of every
+     * notification and is used by WebhookReceiver to verify that the
+     * notification comes from Google.
+     *
+     * @param token
+     */
+    void setToken(const QString &token);
+
+    /**
+     * @brief Returns the verification token of the channel.
+     */
+    [[nodiscard]] QString token() const;
+
+    /**
+     * @brief Sets the requested expiration time of the channel.
+     *
+     * When not set, the default expiration of the API is used. The server
+     * may choose a shorter expiration, the actual value is available in the
+     * channel returned by the watch job.
+     *
+     * @param expiration
+     */
+    void setExpiration(const QDateTime &expiration);
+
+    /**
+     * @brief Returns the expiration time of the channel.
+     */
+    [[nodiscard]] QDateTime expiration() const;
+
+    /**
+     * @brief Returns the type of the channel.
+     *
+     * Only "web_hook" channels are supported.
+     */
+    [[nodiscard]] QString type() const;
+
+    /**
+     * @brief Sets the opaque ID of the watched resource.
+     *
+     * @param resourceId
+     */
+    void setResourceId(const QString &resourceId);
+
+    /**
+     * @brief Returns the opaque ID of the watched resource, as assigned by
+     *        the server.
+     */
+    [[nodiscard]] QString resourceId() const;
+
+    /**
+     * @brief Sets the API-specific URI of the watched resource.
+     *
+     * @param resourceUri
+     */
+    void setResourceUri(const QUrl &resourceUri);
+
+    /**
+     * @brief Returns the API-specific URI of the watched resource.
+     */
+    [[nodiscard]] QUrl resourceUri() const;
+
+    /**
+     * @brief Parses raw JSON data into a Channel object.
+     *
+     * @param jsonData JSON data to parse
+     */
+    static ChannelPtr fromJSON(const QByteArray &jsonData);
+
+    /**
+     * @brief Serializes the channel into JSON suitable for a watch request.
+     *
+     * @param channel Channel to serialize
+     */
+    static QByteArray toJSON(const ChannelPtr &channel);
+
+private:
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace KGAPI2
@@ -0,0 +1,66 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "channelstopjob.h"
+#include "channel.h"
+#include "private/jsonwriter_p.h"
+
+#include <QNetworkAccessManager>
+#include <QNetworkRequest>
+#include <QUrl>
+
+using namespace KGAPI2;
+
+class Q_DECL_HIDDEN ChannelStopJob::Private
+{
+public:
+    ChannelPtr channel;
+    QUrl stopUrl;
+};
+
+ChannelStopJob::ChannelStopJob(const ChannelPtr &channel, const QUrl &stopUrl, const AccountPtr &account, QObject *parent)
+    : Job(account, parent)
+    , d(new Private)
+{
+    d->channel = channel;
+    d->stopUrl = stopUrl;
+}
+
+ChannelStopJob::~ChannelStopJob()
+{
+    delete d;
+}
+
+void ChannelStopJob::start()
+{
+    JsonWriter writer(128);
+    writer.beginObject();
+    writer.insert("id", d->channel->id());
+    writer.insert("resourceId", d->channel->resourceId());
+    writer.endObject();
+
+    enqueueRequest(QNetworkRequest(d->stopUrl), writer.data(), QStringLiteral("application/json"));
+}
+
+void ChannelStopJob::dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType)
+{
+    QNetworkRequest r = request;
+    r.setHeader(QNetworkRequest::ContentTypeHeader, contentType);
+    accessManager->post(r, data);
+}
+
+void ChannelStopJob::handleReply(const QNetworkReply *reply, const QByteArray &rawData)
+{
+    Q_UNUSED(reply)
+    Q_UNUSED(rawData)
+
+    // The server replies with 204 No Content, the job finishes once the
+    // request queue is empty.
+}
+
+#include "moc_channelstopjob.cpp"
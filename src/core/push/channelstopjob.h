@@ -0,0 +1,79 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "job.h"
+#include "kgapicore_export.h"
+
+namespace KGAPI2
+{
+
+/**
+ * @brief A job to stop a push notification channel
+ *
+ * Each API has its own endpoint to stop channels, use for example
+ * CalendarService::stopChannelUrl() or DriveService::stopChannelUrl() to
+ * obtain the @p stopUrl.
+ *
+ * @since 6.4
+ */
+class KGAPICORE_EXPORT ChannelStopJob : public KGAPI2::Job
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructs a job that will stop given @p channel
+     *
+     * The channel must have its ID and resource ID set.
+     *
+     * @param channel Channel to stop
+     * @param stopUrl URL of the channels/stop endpoint of the API the
+     *        channel was created by
+     * @param account Account to authenticate the request
+     * @param parent
+     */
+    explicit ChannelStopJob(const ChannelPtr &channel, const QUrl &stopUrl, const AccountPtr &account, QObject *parent = nullptr);
+
+    /**
+     * @brief Destructor
+     */
+    ~ChannelStopJob() override;
+
+protected:
+    /**
+     * @brief KGAPI2::Job::start implementation
+     */
+    void start() override;
+
+    /**
+     * @brief KGAPI2::Job::dispatchRequest implementation
+     *
+     * @param accessManager
+     * @param request
+     * @param data
+     * @param contentType
+     */
+    void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType) override;
+
+    /**
+     * @brief KGAPI2::Job::handleReply implementation
+     *
+     * @param reply
+     * @param rawData
+     */
+    void handleReply(const QNetworkReply *reply, const QByteArray &rawData) override;
+
+private:
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace KGAPI2
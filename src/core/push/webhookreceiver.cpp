@@ -0,0 +1,303 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "webhookreceiver.h"
+#include "channel.h"
+#include "debug.h"
+
+#include <QHash>
+#include <QHostAddress>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTimer>
+
+using namespace KGAPI2;
+
+namespace
+{
+// Notifications carry all the information in headers, Drive adds a small
+// JSON body. Anything larger is not a notification.
+constexpr int MaxHeadersSize = 16 * 1024;
+constexpr qint64 MaxBodySize = 64 * 1024;
+// Headers, the empty line and the body
+constexpr qint64 MaxRequestSize = MaxHeadersSize + 4 + MaxBodySize;
+
+constexpr int DefaultRequestTimeout = 30 * 1000;
+constexpr int DefaultMaxConnections = 64;
+
+using Headers = QHash<QByteArray, QByteArray>;
+
+// Takes the same time wherever the tokens differ, so that the token can't be
+// guessed byte by byte from the response times
+bool tokensEqual(const QByteArray &received, const QByteArray &expected)
+{
+    if (received.size() != expected.size()) {
+        return false;
+    }
+
+    char difference = 0;
+    for (qsizetype i = 0; i < expected.size(); ++i) {
+        difference |= received.at(i) ^ expected.at(i);
+    }
+    return difference == 0;
+}
+}
+
+class Q_DECL_HIDDEN WebhookReceiver::Private
+{
+public:
+    Private(WebhookReceiver *parent);
+
+    void acceptConnections();
+    void readRequest(QTcpSocket *socket);
+    void handleNotification(QTcpSocket *socket, const Headers &headers);
+    void sendResponse(QTcpSocket *socket, int code, const QByteArray &reason);
+
+    QTcpServer server;
+    QHash<QString, ChannelPtr> channels;
+    QHash<QTcpSocket *, QByteArray> buffers;
+    int connections = 0;
+    int requestTimeout = DefaultRequestTimeout;
+    int maxConnections = DefaultMaxConnections;
+
+private:
+    WebhookReceiver *const q;
+};
+
+WebhookReceiver::Private::Private(WebhookReceiver *parent)
+    : q(parent)
+{
+}
+
+void WebhookReceiver::Private::acceptConnections()
+{
+    while (connections < maxConnections) {
+        QTcpSocket *socket = server.nextPendingConnection();
+        if (!socket) {
+            break;
+        }
+        ++connections;
+        buffers.insert(socket, QByteArray());
+        socket->setReadBufferSize(MaxRequestSize);
+
+        // Drop clients that don't send a whole request in time, sending the
+        // request slowly must not keep the connection open either
+        auto timer = new QTimer(socket);
+        timer->setSingleShot(true);
+        QObject::connect(timer, &QTimer::timeout, q, [this, socket]() {
+            qCDebug(KGAPIDebug) << "Dropping idle connection from" << socket->peerAddress();
+            buffers.remove(socket);
+            socket->abort();
+        });
+        timer->start(requestTimeout);
+
+        QObject::connect(socket, &QTcpSocket::readyRead, q, [this, socket]() {
+            readRequest(socket);
+        });
+        QObject::connect(socket, &QTcpSocket::disconnected, q, [this, socket]() {
+            buffers.remove(socket);
+            socket->deleteLater();
+            --connections;
+            // Connections left waiting in the server can be accepted now
+            if (server.isListening()) {
+                server.resumeAccepting();
+                acceptConnections();
+            }
+        });
+    }
+
+    // Further connections wait in the backlog of the system
+    if (connections >= maxConnections) {
+        qCDebug(KGAPIDebug) << "Reached the limit of" << maxConnections << "connections";
+        server.pauseAccepting();
+    }
+}
+
+void WebhookReceiver::Private::readRequest(QTcpSocket *socket)
+{
+    auto it = buffers.find(socket);
+    if (it == buffers.end()) {
+        // Response has already been sent
+        socket->readAll();
+        return;
+    }
+    QByteArray &buffer = *it;
+    // Never buffer more than the largest acceptable request
+    buffer += socket->read(MaxRequestSize + 1 - buffer.size());
+    if (buffer.size() > MaxRequestSize) {
+        sendResponse(socket, 413, "Content Too Large");
+        return;
+    }
+
+    const int headersEnd = buffer.indexOf("\r\n\r\n");
+    if (headersEnd == -1) {
+        if (buffer.size() > MaxHeadersSize) {
+            sendResponse(socket, 431, "Request Header Fields Too Large");
+        }
+        return;
+    }
+
+    const QList<QByteArray> lines = buffer.left(headersEnd).split('\n');
+    const QList<QByteArray> requestLine = lines.constFirst().trimmed().split(' ');
+    if (requestLine.size() != 3) {
+        sendResponse(socket, 400, "Bad Request");
+        return;
+    }
+
+    Headers headers;
+    for (int i = 1; i < lines.size(); ++i) {
+        const QByteArray &line = lines.at(i);
+        const int colon = line.indexOf(':');
+        if (colon > 0) {
+            headers.insert(line.left(colon).trimmed().toLower(), line.mid(colon + 1).trimmed());
+        }
+    }
+
+    const qint64 contentLength = headers.value("content-length").toLongLong();
+    if (contentLength < 0 || contentLength > MaxBodySize) {
+        sendResponse(socket, 413, "Content Too Large");
+        return;
+    }
+    if (buffer.size() < headersEnd + 4 + contentLength) {
+        // Wait for the rest of the body, it's not used but must be consumed
+        return;
+    }
+
+    if (requestLine.at(0) != "POST") {
+        sendResponse(socket, 405, "Method Not Allowed");
+        return;
+    }
+
+    handleNotification(socket, headers);
+}
+
+void WebhookReceiver::Private::handleNotification(QTcpSocket *socket, const Headers &headers)
+{
+    const QString channelId = QString::fromUtf8(headers.value("x-goog-channel-id"));
+    const ChannelPtr channel = channels.value(channelId);
+    if (!channel) {
+        qCWarning(KGAPIDebug) << "Received notification for unknown channel" << channelId;
+        sendResponse(socket, 404, "Not Found");
+        return;
+    }
+    if (!tokensEqual(headers.value("x-goog-channel-token"), channel->token().toUtf8())) {
+        qCWarning(KGAPIDebug) << "Received notification with invalid token for channel" << channelId;
+        sendResponse(socket, 403, "Forbidden");
+        return;
+    }
+    if (!channel->resourceId().isEmpty() && QString::fromUtf8(headers.value("x-goog-resource-id")) != channel->resourceId()) {
+        qCWarning(KGAPIDebug) << "Received notification for unexpected resource on channel" << channelId;
+        sendResponse(socket, 403, "Forbidden");
+        return;
+    }
+
+    const QString resourceState = QString::fromUtf8(headers.value("x-goog-resource-state"));
+    const qint64 messageNumber = headers.value("x-goog-message-number").toLongLong();
+
+    // Acknowledge first, Google retries notifications that are not acknowledged
+    // in time and the slots may take a while.
+    sendResponse(socket, 200, "OK");
+
+    Q_EMIT q->notificationReceived(channel, resourceState, messageNumber);
+    if (resourceState != QLatin1StringView("sync")) {
+        Q_EMIT q->resourceChanged(channel);
+    }
+}
+
+void WebhookReceiver::Private::sendResponse(QTcpSocket *socket, int code, const QByteArray &reason)
+{
+    buffers.remove(socket);
+    socket->write("HTTP/1.1 " + QByteArray::number(code) + ' ' + reason + "\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+    socket->disconnectFromHost();
+}
+
+WebhookReceiver::WebhookReceiver(QObject *parent)
+    : QObject(parent)
+    , d(new Private(this))
+{
+    connect(&d->server, &QTcpServer::newConnection, this, [this]() {
+        d->acceptConnections();
+    });
+}
+
+WebhookReceiver::~WebhookReceiver()
+{
+    // Sockets are owned by the server and may emit signals while being destroyed
+    const auto sockets = d->server.findChildren<QTcpSocket *>();
+    for (QTcpSocket *socket : sockets) {
+        socket->disconnect(this);
+    }
+    delete d;
+}
+
+bool WebhookReceiver::listen(quint16 port, const QString &address)
+{
+    return d->server.listen(QHostAddress(address), port);
+}
+
+void WebhookReceiver::close()
+{
+    d->server.close();
+    const auto sockets = d->buffers.keys();
+    d->buffers.clear();
+    for (QTcpSocket *socket : sockets) {
+        socket->abort();
+    }
+}
+
+bool WebhookReceiver::isListening() const
+{
+    return d->server.isListening();
+}
+
+quint16 WebhookReceiver::serverPort() const
+{
+    return d->server.serverPort();
+}
+
+QString WebhookReceiver::errorString() const
+{
+    return d->server.errorString();
+}
+
+int WebhookReceiver::requestTimeout() const
+{
+    return d->requestTimeout;
+}
+
+void WebhookReceiver::setRequestTimeout(int msecs)
+{
+    d->requestTimeout = qMax(msecs, 0);
+}
+
+int WebhookReceiver::maxConnections() const
+{
+    return d->maxConnections;
+}
+
+void WebhookReceiver::setMaxConnections(int maxConnections)
+{
+    d->maxConnections = qMax(maxConnections, 1);
+}
+
+void WebhookReceiver::addChannel(const ChannelPtr &channel)
+{
+    d->channels.insert(channel->id(), channel);
+}
+
+void WebhookReceiver::removeChannel(const QString &channelId)
+{
+    d->channels.remove(channelId);
+}
+
+ChannelsList WebhookReceiver::channels() const
+{
+    return d->channels.values();
+}
+
+#include "moc_webhookreceiver.cpp"
@@ -0,0 +1,164 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "kgapicore_export.h"
+#include "types.h"
+
+#include <QObject>
+
+namespace KGAPI2
+{
+
+/**
+ * @brief A minimal embeddable HTTP server receiving push notifications
+ *
+ * WebhookReceiver accepts the notifications Google sends to the address of
+ * a push notification Channel. Every notification is verified against the
+ * channels registered with addChannel(): notifications for unknown channels,
+ * with a wrong token or a different resource ID are rejected.
+ *
+ * Google delivers notifications to HTTPS addresses only, so the receiver is
+ * meant to run behind a TLS-terminating reverse proxy and by default it only
+ * listens on the loopback interface.
+ *
+ * Notifications are small, so the size of requests, the time to send them
+ * and the number of concurrent connections are limited, see
+ * requestTimeout() and maxConnections().
+ *
+ * A typical use is to trigger an incremental synchronization of a calendar
+ * or of Drive changes from the resourceChanged() signal instead of polling
+ * the server periodically.
+ *
+ * @since 6.4
+ */
+class KGAPICORE_EXPORT WebhookReceiver : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit WebhookReceiver(QObject *parent = nullptr);
+    ~WebhookReceiver() override;
+
+    /**
+     * @brief Starts listening for incoming notifications
+     *
+     * @param port Port to listen on, 0 chooses a port automatically
+     * @param address Address of the interface to listen on
+     *
+     * @return Returns whether the server is listening
+     * @see serverPort(), errorString()
+     */
+    bool listen(quint16 port = 0, const QString &address = QStringLiteral("127.0.0.1"));
+
+    /**
+     * @brief Stops listening and closes all pending connections
+     */
+    void close();
+
+    /**
+     * @brief Returns whether the server is listening
+     */
+    [[nodiscard]] bool isListening() const;
+
+    /**
+     * @brief Returns the port the server listens on
+     */
+    [[nodiscard]] quint16 serverPort() const;
+
+    /**
+     * @brief Returns a description of the last error
+     */
+    [[nodiscard]] QString errorString() const;
+
+    /**
+     * @brief Returns time in milliseconds a client has to send a request
+     *
+     * Connections that have not sent a whole request within this time after
+     * they were accepted are dropped. The default is 30 seconds.
+     */
+    [[nodiscard]] int requestTimeout() const;
+
+    /**
+     * @brief Sets time in milliseconds a client has to send a request
+     *
+     * Applies to connections accepted after the call.
+     *
+     * @param msecs
+     */
+    void setRequestTimeout(int msecs);
+
+    /**
+     * @brief Returns the maximum number of connections handled at a time
+     *
+     * Further connections wait until some of the current ones are closed.
+     * The default is 64.
+     */
+    [[nodiscard]] int maxConnections() const;
+
+    /**
+     * @brief Sets the maximum number of connections handled at a time
+     *
+     * @param maxConnections
+     */
+    void setMaxConnections(int maxConnections);
+
+    /**
+     * @brief Registers a channel to accept notifications for
+     *
+     * Use the channel returned by the watch job, so that the resource ID of
+     * notifications can be verified as well. Registering a channel with the
+     * same ID again replaces the previous one.
+     *
+     * @param channel
+     */
+    void addChannel(const ChannelPtr &channel);
+
+    /**
+     * @brief Stops accepting notifications for channel with given @p channelId
+     *
+     * @param channelId
+     */
+    void removeChannel(const QString &channelId);
+
+    /**
+     * @brief Returns the registered channels
+     */
+    [[nodiscard]] ChannelsList channels() const;
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted for every verified notification
+     *
+     * @param channel Channel the notification was sent for
+     * @param resourceState Value of the X-Goog-Resource-State header, for
+     *        example "sync" when the channel was created, "exists" or
+     *        "not_exists" for Calendar resources, or "change" for Drive
+     *        changes
+     * @param messageNumber Sequence number of the notification in the channel
+     */
+    void notificationReceived(const KGAPI2::ChannelPtr &channel, const QString &resourceState, qint64 messageNumber);
+
+    /**
+     * @brief Emitted when the resource watched by @p channel has changed
+     *
+     * Unlike notificationReceived(), this signal is not emitted for the
+     * initial "sync" notification.
+     *
+     * @param channel
+     */
+    void resourceChanged(const KGAPI2::ChannelPtr &channel);
+
+private:
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace KGAPI2
@@ -0,0 +1,203 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "syncstatestore.h"
+#include "debug.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QSaveFile>
+
+using namespace KGAPI2;
+
+SyncStateStore::SyncStateStore() = default;
+
+SyncStateStore::~SyncStateStore() = default;
+
+class Q_DECL_HIDDEN MemorySyncStateStore::Private
+{
+public:
+    mutable QMutex lock;
+    QHash<QString, QString> states;
+};
+
+MemorySyncStateStore::MemorySyncStateStore()
+    : d(new Private)
+{
+}
+
+MemorySyncStateStore::~MemorySyncStateStore()
+{
+    delete d;
+}
+
+QString MemorySyncStateStore::load(const QString &key) const
+{
+    QMutexLocker locker(&d->lock);
+    return d->states.value(key);
+}
+
+bool MemorySyncStateStore::commit(const QString &key, const QString &state)
+{
+    QMutexLocker locker(&d->lock);
+    d->states.insert(key, state);
+    return true;
+}
+
+bool MemorySyncStateStore::remove(const QString &key)
+{
+    QMutexLocker locker(&d->lock);
+    d->states.remove(key);
+    return true;
+}
+
+class Q_DECL_HIDDEN FileSyncStateStore::Private
+{
+    Q_DECLARE_TR_FUNCTIONS(KGAPI2::FileSyncStateStore)
+
+public:
+    // Returns false when the file exists but can't be read, it's retried on
+    // the next call
+    bool ensureLoaded()
+    {
+        if (loaded) {
+            return true;
+        }
+
+        QFile file(fileName);
+        if (!file.exists()) {
+            loaded = true;
+            return true;
+        }
+        if (!file.open(QIODevice::ReadOnly)) {
+            errorString = tr("Failed to open sync state file: %1").arg(file.errorString());
+            qCWarning(KGAPIDebug) << "Failed to open sync state file" << fileName << ":" << file.errorString();
+            return false;
+        }
+
+        QJsonParseError parseError;
+        const auto document = QJsonDocument::fromJson(file.readAll(), &parseError);
+        if (!document.isObject()) {
+            // QSaveFile never leaves a partially written file behind, so this
+            // is not a result of a crash. Don't overwrite states we can't read.
+            errorString = tr("Invalid sync state file: %1").arg(parseError.errorString());
+            qCWarning(KGAPIDebug) << "Invalid sync state file" << fileName << ":" << parseError.errorString();
+            return false;
+        }
+        states = document.object();
+        loaded = true;
+        return true;
+    }
+
+    bool save(const QJsonObject &newStates)
+    {
+        if (!loaded) {
+            qCWarning(KGAPIDebug) << "Refusing to overwrite sync state file" << fileName << "that could not be loaded";
+            return false;
+        }
+
+        const QFileInfo info(fileName);
+        if (!QDir().mkpath(info.absolutePath())) {
+            errorString = tr("Failed to create directory %1").arg(info.absolutePath());
+            return false;
+        }
+
+        QSaveFile file(fileName);
+        if (!file.open(QIODevice::WriteOnly)) {
+            errorString = file.errorString();
+            return false;
+        }
+        file.write(QJsonDocument(newStates).toJson(QJsonDocument::Compact));
+        if (!file.commit()) {
+            errorString = file.errorString();
+            return false;
+        }
+
+        states = newStates;
+        return true;
+    }
+
+    QString fileName;
+    QString errorString;
+    QJsonObject states;
+    bool loaded = false;
+    QMutex lock;
+};
+
+FileSyncStateStore::FileSyncStateStore(const QString &fileName)
+    : d(new Private)
+{
+    d->fileName = fileName;
+}
+
+FileSyncStateStore::~FileSyncStateStore()
+{
+    delete d;
+}
+
+QString FileSyncStateStore::fileName() const
+{
+    return d->fileName;
+}
+
+QString FileSyncStateStore::errorString() const
+{
+    QMutexLocker locker(&d->lock);
+    return d->errorString;
+}
+
+QString FileSyncStateStore::load(const QString &key) const
+{
+    QMutexLocker locker(&d->lock);
+    d->ensureLoaded();
+    return d->states.value(key).toString();
+}
+
+bool FileSyncStateStore::commit(const QString &key, const QString &state)
+{
+    QMutexLocker locker(&d->lock);
+    if (!d->ensureLoaded()) {
+        return false;
+    }
+    if (d->states.contains(key) && d->states.value(key).toString() == state) {
+        return true;
+    }
+
+    auto newStates = d->states;
+    newStates.insert(key, state);
+    if (!d->save(newStates)) {
+        qCWarning(KGAPIDebug) << "Failed to commit sync state to" << d->fileName << ":" << d->errorString;
+        return false;
+    }
+    return true;
+}
+
+bool FileSyncStateStore::remove(const QString &key)
+{
+    QMutexLocker locker(&d->lock);
+    if (!d->ensureLoaded()) {
+        return false;
+    }
+    if (!d->states.contains(key)) {
+        return true;
+    }
+
+    auto newStates = d->states;
+    newStates.remove(key);
+    if (!d->save(newStates)) {
+        qCWarning(KGAPIDebug) << "Failed to remove sync state from" << d->fileName << ":" << d->errorString;
+        return false;
+    }
+    return true;
+}
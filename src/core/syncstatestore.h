@@ -0,0 +1,144 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "kgapicore_export.h"
+
+#include <QString>
+
+namespace KGAPI2
+{
+
+/**
+ * @headerfile syncstatestore.h
+ * @brief Persists state of incremental synchronization between runs
+ *
+ * Jobs that support incremental synchronization (sync tokens, timestamps of
+ * the last update, change IDs) can be given a store and a key with
+ * FetchJob::setSyncStateStore(). Such job then loads the state from the store
+ * when it starts and commits the new state received from the server only after
+ * the job has finished successfully and the application has processed the
+ * received changes.
+ *
+ * The state is an opaque string, its content depends on the job that stores
+ * it. Keys are chosen by the application and should identify both the account
+ * and the synchronized collection, for example
+ * "john.doe@gmail.com/calendar/primary".
+ *
+ * All methods of the stores provided by LibKGAPI are thread-safe.
+ *
+ * @since 6.4
+ */
+class KGAPICORE_EXPORT SyncStateStore
+{
+public:
+    virtual ~SyncStateStore();
+
+    /**
+     * @brief Returns state stored under @p key or an empty string
+     */
+    [[nodiscard]] virtual QString load(const QString &key) const = 0;
+
+    /**
+     * @brief Stores @p state under @p key
+     *
+     * The state must be either fully stored or not at all.
+     *
+     * @return Returns whether the state has been stored
+     */
+    virtual bool commit(const QString &key, const QString &state) = 0;
+
+    /**
+     * @brief Removes state stored under @p key
+     *
+     * Next synchronization of the collection will be a full one.
+     *
+     * @return Returns whether the state has been removed
+     */
+    virtual bool remove(const QString &key) = 0;
+
+protected:
+    explicit SyncStateStore();
+
+private:
+    Q_DISABLE_COPY(SyncStateStore)
+};
+
+/**
+ * @headerfile syncstatestore.h
+ * @brief SyncStateStore that keeps the state in memory only
+ *
+ * Useful for tests and for applications that persist the state on their own
+ * together with the synchronized data.
+ *
+ * @since 6.4
+ */
+class KGAPICORE_EXPORT MemorySyncStateStore : public SyncStateStore
+{
+public:
+    explicit MemorySyncStateStore();
+    ~MemorySyncStateStore() override;
+
+    [[nodiscard]] QString load(const QString &key) const override;
+    bool commit(const QString &key, const QString &state) override;
+    bool remove(const QString &key) override;
+
+private:
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+/**
+ * @headerfile syncstatestore.h
+ * @brief SyncStateStore that keeps the state in a file
+ *
+ * All states are stored in a single JSON file. The file is replaced
+ * atomically on every commit, so a crash or a power loss while committing
+ * leaves either the old or the new state in the file, never a corrupted one.
+ *
+ * When the file exists but can't be read or parsed, load() returns no
+ * state, so the data is synchronized from scratch, but commit() and
+ * remove() fail without touching the file, see errorString(). Remove the
+ * file to start over.
+ *
+ * @since 6.4
+ */
+class KGAPICORE_EXPORT FileSyncStateStore : public SyncStateStore
+{
+public:
+    /**
+     * @brief Constructs a store backed by file @p fileName
+     *
+     * The file is read on first access and created on first commit.
+     */
+    explicit FileSyncStateStore(const QString &fileName);
+    ~FileSyncStateStore() override;
+
+    /**
+     * @brief Returns name of the backing file
+     */
+    [[nodiscard]] QString fileName() const;
+
+    /**
+     * @brief Returns description of the last error
+     */
+    [[nodiscard]] QString errorString() const;
+
+    [[nodiscard]] QString load(const QString &key) const override;
+    bool commit(const QString &key, const QString &state) override;
+    bool remove(const QString &key) override;
+
+private:
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace KGAPI2
@@ -55,6 +55,10 @@ class AccountInfo;
 using AccountInfoPtr = QSharedPointer<AccountInfo>;
 using AccountInfosList = QList<AccountInfoPtr>;
 
+class Channel;
+using ChannelPtr = QSharedPointer<Channel>;
+using ChannelsList = QList<ChannelPtr>;
+
 namespace People {
 
 class Person;
@@ -190,6 +194,7 @@ enum Error {
     OK = 200, ///< Request successfully executed.
     Created = 201, ///< Create request successfully executed.
     NoContent = 204, ///< Tasks API returns 204 when task is successfully removed.
+    PartialContent = 206, ///< Requested range of the content successfully fetched.
     ResumeIncomplete = 308, ///< Drive Api returns 308 when accepting a partial file upload
     TemporarilyMoved = 302, ///< The object is located on a different URL provided in reply.
     NotModified = 304, ///< Request was successful, but no data were updated.
@@ -200,6 +205,7 @@ enum Error {
     NotFound = 404, ///< Requested object was not found on the remote side.
     Conflict = 409, ///< Object on the remote site differs from the submitted one. @see KGAPI2::Object::setEtag.
     Gone = 410, ///< The requested data does not exist anymore on the remote site.
+    PreconditionFailed = 412, ///< The If-Match ETag does not match the object on the remote site. Jobs report it as KGAPI2::Conflict. @since 6.4
     InternalError = 500, ///< An unexpected error occurred on the Google service.
     QuotaExceeded = 503 ///< User quota has been exceeded, the request should be sent again later.
 };
@@ -209,4 +215,21 @@ enum Error {
  */
 enum ContentType { UnknownContentType = -1, JSON, XML };
 
+/**
+ * @brief Result of a single item processed by a job that works on multiple
+ *        items at once.
+ *
+ * Jobs processing their items in batches report results per item, in the
+ * same order in which the items were passed to the job, so that a failure
+ * of one item does not hide the outcome of the others.
+ *
+ * @since 6.4
+ */
+struct ItemResult {
+    ObjectPtr object; /**< Object returned by the server for this item, if any. */
+    Error error = NoError; /**< Error of this item, KGAPI2::NoError on success. */
+    QString errorString; /**< Human-readable description of the error. */
+};
+using ItemResultsList = QList<ItemResult>;
+
 } // namespace KGAPI2
@@ -0,0 +1,412 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "bandwidthlimiter.h"
+#include "bandwidthlimiter_p.h"
+#include "debug.h"
+
+#include <QBuffer>
+#include <QHash>
+
+using namespace KGAPI2;
+using namespace KGAPI2::Drive;
+
+namespace
+{
+// Smallest amount of data the bucket can hold, so that low rates don't
+// result in tiny reads and writes
+static constexpr qint64 MinimumBurst = 4096;
+// Longest time to wait before trying again, so that changes of the rate
+// and of the schedule are picked up in time
+static constexpr qint64 MaximumDelay = 1000;
+// Period over which the throughput is measured, in milliseconds
+static constexpr qint64 ThroughputWindow = 2000;
+
+qint64 burstSize(qint64 rate)
+{
+    // A quarter of a second worth of data
+    return qMax(rate / 4, MinimumBurst);
+}
+} // namespace
+
+class Q_DECL_HIDDEN BandwidthLimiter::Private
+{
+public:
+    struct Period {
+        QTime from;
+        QTime to;
+        Direction direction;
+        qint64 rate;
+    };
+
+    struct Bucket {
+        qint64 tokens = 0;
+        // Time of the last refill, -1 when the bucket has not been used yet
+        qint64 lastRefill = -1;
+    };
+
+    Private();
+
+    void refill(Bucket &bucket, qint64 rate);
+    [[nodiscard]] qint64 availableTokens(const Bucket &bucket, qint64 rate) const;
+
+    qint64 rates[2] = {0, 0};
+    QList<Period> schedule;
+    QPointer<BandwidthLimiter> parentLimiter;
+
+    Bucket buckets[2];
+    QElapsedTimer clock;
+
+    qint64 transferred[2] = {0, 0};
+    ThroughputMeter meters[2];
+
+    // Only used by the global limiter
+    QHash<QString, QPointer<BandwidthLimiter>> accountLimiters;
+
+    static BandwidthLimiter *sGlobal;
+};
+
+BandwidthLimiter *BandwidthLimiter::Private::sGlobal = nullptr;
+
+BandwidthLimiter::Private::Private()
+{
+    clock.start();
+}
+
+void BandwidthLimiter::Private::refill(Bucket &bucket, qint64 rate)
+{
+    const qint64 now = clock.elapsed();
+    if (bucket.lastRefill < 0) {
+        bucket.tokens = burstSize(rate);
+        bucket.lastRefill = now;
+        return;
+    }
+
+    const qint64 tokens = availableTokens(bucket, rate);
+    // Don't lose fractions of tokens when refilling often at low rates
+    if (tokens != bucket.tokens || tokens == burstSize(rate)) {
+        bucket.tokens = tokens;
+        bucket.lastRefill = now;
+    }
+}
+
+qint64 BandwidthLimiter::Private::availableTokens(const Bucket &bucket, qint64 rate) const
+{
+    if (bucket.lastRefill < 0) {
+        return burstSize(rate);
+    }
+
+    // The bucket is full long before this, avoid overflows
+    const qint64 elapsed = qMin<qint64>(clock.elapsed() - bucket.lastRefill, 60 * 1000);
+    return qMin(bucket.tokens + rate * elapsed / 1000, burstSize(rate));
+}
+
+BandwidthLimiter::BandwidthLimiter(QObject *parent)
+    : QObject(parent)
+    , d(new Private)
+{
+}
+
+BandwidthLimiter::~BandwidthLimiter()
+{
+    if (Private::sGlobal == this) {
+        Private::sGlobal = nullptr;
+    }
+    delete d;
+}
+
+BandwidthLimiter *BandwidthLimiter::global()
+{
+    if (!Private::sGlobal) {
+        Private::sGlobal = new BandwidthLimiter;
+    }
+    return Private::sGlobal;
+}
+
+BandwidthLimiter *BandwidthLimiter::forAccount(const AccountPtr &account)
+{
+    BandwidthLimiter *globalLimiter = global();
+    if (!account || account->accountName().isEmpty()) {
+        return globalLimiter;
+    }
+
+    auto &limiter = globalLimiter->d->accountLimiters[account->accountName()];
+    if (!limiter) {
+        limiter = new BandwidthLimiter(globalLimiter);
+        limiter->setParentLimiter(globalLimiter);
+    }
+    return limiter;
+}
+
+void BandwidthLimiter::setParentLimiter(BandwidthLimiter *parent)
+{
+    for (auto limiter = parent; limiter; limiter = limiter->parentLimiter()) {
+        if (limiter == this) {
+            qCWarning(KGAPIDebug) << "Can't make a limiter parent of itself";
+            return;
+        }
+    }
+
+    d->parentLimiter = parent;
+}
+
+BandwidthLimiter *BandwidthLimiter::parentLimiter() const
+{
+    return d->parentLimiter;
+}
+
+void BandwidthLimiter::setRate(Direction direction, qint64 bytesPerSecond)
+{
+    d->rates[direction] = qMax<qint64>(bytesPerSecond, 0);
+    Q_EMIT rateChanged(direction);
+}
+
+qint64 BandwidthLimiter::rate(Direction direction) const
+{
+    return d->rates[direction];
+}
+
+void BandwidthLimiter::addSchedule(const QTime &from, const QTime &to, Direction direction, qint64 bytesPerSecond)
+{
+    if (!from.isValid() || !to.isValid()) {
+        qCWarning(KGAPIDebug) << "Invalid period of the schedule" << from << to;
+        return;
+    }
+
+    d->schedule.append({from, to, direction, qMax<qint64>(bytesPerSecond, 0)});
+    Q_EMIT rateChanged(direction);
+}
+
+void BandwidthLimiter::clearSchedule()
+{
+    d->schedule.clear();
+    Q_EMIT rateChanged(Upload);
+    Q_EMIT rateChanged(Download);
+}
+
+qint64 BandwidthLimiter::effectiveRate(Direction direction, const QTime &time) const
+{
+    for (const auto &period : std::as_const(d->schedule)) {
+        if (period.direction != direction) {
+            continue;
+        }
+        const bool inPeriod = period.from <= period.to ? (time >= period.from && time < period.to) : (time >= period.from || time < period.to);
+        if (inPeriod) {
+            return period.rate;
+        }
+    }
+    return d->rates[direction];
+}
+
+bool BandwidthLimiter::isLimited(Direction direction) const
+{
+    return effectiveRate(direction) > 0 || (d->parentLimiter && d->parentLimiter->isLimited(direction));
+}
+
+qint64 BandwidthLimiter::take(Direction direction, qint64 bytes)
+{
+    if (bytes <= 0) {
+        return 0;
+    }
+
+    const qint64 rate = effectiveRate(direction);
+    auto &bucket = d->buckets[direction];
+    qint64 granted = bytes;
+    if (rate > 0) {
+        d->refill(bucket, rate);
+        granted = qMin(granted, bucket.tokens);
+    } else {
+        // Start with a full bucket once limited again
+        bucket.lastRefill = -1;
+    }
+
+    if (granted > 0 && d->parentLimiter) {
+        granted = d->parentLimiter->take(direction, granted);
+    }
+    if (rate > 0) {
+        bucket.tokens -= granted;
+    }
+
+    d->transferred[direction] += granted;
+    d->meters[direction].update(d->transferred[direction]);
+    return granted;
+}
+
+int BandwidthLimiter::delay(Direction direction, qint64 bytes) const
+{
+    qint64 delay = 0;
+    const qint64 rate = effectiveRate(direction);
+    if (rate > 0) {
+        const qint64 missing = qMin(bytes, burstSize(rate)) - d->availableTokens(d->buckets[direction], rate);
+        if (missing > 0) {
+            delay = (missing * 1000 + rate - 1) / rate;
+        }
+    }
+    if (d->parentLimiter) {
+        delay = qMax<qint64>(delay, d->parentLimiter->delay(direction, bytes));
+    }
+    return static_cast<int>(qBound<qint64>(1, delay, MaximumDelay));
+}
+
+qint64 BandwidthLimiter::throughput(Direction direction) const
+{
+    return d->meters[direction].rate();
+}
+
+ThrottledDevice::ThrottledDevice(BandwidthLimiter *limiter, BandwidthLimiter::Direction direction, QObject *parent)
+    : QIODevice(parent)
+    , mLimiter(limiter)
+    , mDirection(direction)
+{
+    mRetryTimer.setSingleShot(true);
+    connect(&mRetryTimer, &QTimer::timeout, this, &QIODevice::readyRead);
+}
+
+void ThrottledDevice::append(const QByteArray &data)
+{
+    auto buffer = new QBuffer(this);
+    buffer->setData(data);
+    buffer->open(QIODevice::ReadOnly);
+    mParts.append(buffer);
+}
+
+void ThrottledDevice::append(QIODevice *device)
+{
+    device->setParent(this);
+    mParts.append(device);
+}
+
+bool ThrottledDevice::open(OpenMode mode)
+{
+    if (mode & QIODevice::WriteOnly) {
+        qCWarning(KGAPIDebug) << "ThrottledDevice is read-only";
+        return false;
+    }
+
+    mOffset = 0;
+    // Keep pos() in sync with the parts
+    return QIODevice::open(mode | QIODevice::Unbuffered);
+}
+
+bool ThrottledDevice::isSequential() const
+{
+    return false;
+}
+
+qint64 ThrottledDevice::size() const
+{
+    qint64 size = 0;
+    for (const auto part : std::as_const(mParts)) {
+        size += part->size();
+    }
+    return size;
+}
+
+bool ThrottledDevice::seek(qint64 pos)
+{
+    if (!QIODevice::seek(pos)) {
+        return false;
+    }
+    mOffset = pos;
+    return true;
+}
+
+qint64 ThrottledDevice::readData(char *data, qint64 maxSize)
+{
+    maxSize = qMin(maxSize, size() - mOffset);
+    if (maxSize <= 0) {
+        return 0;
+    }
+
+    const qint64 granted = mLimiter ? mLimiter->take(mDirection, maxSize) : maxSize;
+    if (granted == 0) {
+        if (!mRetryTimer.isActive()) {
+            mRetryTimer.start(mLimiter->delay(mDirection, maxSize));
+        }
+        return 0;
+    }
+
+    qint64 read = 0;
+    qint64 partStart = 0;
+    for (const auto part : std::as_const(mParts)) {
+        const qint64 partSize = part->size();
+        if (read < granted && mOffset < partStart + partSize) {
+            const qint64 partOffset = mOffset - partStart;
+            if (part->pos() != partOffset && !part->seek(partOffset)) {
+                setErrorString(part->errorString());
+                return -1;
+            }
+
+            const qint64 wanted = qMin(granted - read, partSize - partOffset);
+            const qint64 partRead = part->read(data + read, wanted);
+            if (partRead < 0) {
+                setErrorString(part->errorString());
+                return -1;
+            }
+            read += partRead;
+            mOffset += partRead;
+            if (partRead < wanted) {
+                break;
+            }
+        }
+        partStart += partSize;
+    }
+    return read;
+}
+
+qint64 ThrottledDevice::writeData(const char *data, qint64 maxSize)
+{
+    Q_UNUSED(data)
+    Q_UNUSED(maxSize)
+
+    return -1;
+}
+
+void ThroughputMeter::begin()
+{
+    mBase += mCurrent;
+    mCurrent = 0;
+}
+
+void ThroughputMeter::update(qint64 transferred)
+{
+    if (!mTimer.isValid()) {
+        mTimer.start();
+    }
+    if (transferred < mCurrent) {
+        // The transfer has been restarted
+        begin();
+    }
+    mCurrent = transferred;
+
+    const qint64 now = mTimer.elapsed();
+    const qint64 total = mBase + mCurrent;
+    if (!mSamples.isEmpty() && mSamples.constLast().time == now) {
+        mSamples.last().total = total;
+    } else {
+        mSamples.append({now, total});
+    }
+    // Keep one sample from before the window to measure the whole window
+    while (mSamples.size() > 2 && mSamples.at(1).time <= now - ThroughputWindow) {
+        mSamples.removeFirst();
+    }
+}
+
+qint64 ThroughputMeter::rate() const
+{
+    if (mSamples.size() < 2 || mTimer.elapsed() - mSamples.constLast().time > ThroughputWindow) {
+        return 0;
+    }
+
+    const auto &first = mSamples.constFirst();
+    const auto &last = mSamples.constLast();
+    const qint64 elapsed = last.time - first.time;
+    return elapsed > 0 ? (last.total - first.total) * 1000 / elapsed : 0;
+}
+
+#include "moc_bandwidthlimiter.cpp"
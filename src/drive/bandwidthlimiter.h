@@ -0,0 +1,141 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "account.h"
+#include "kgapidrive_export.h"
+
+#include <QObject>
+#include <QTime>
+
+namespace KGAPI2
+{
+
+namespace Drive
+{
+
+/**
+ * @headerfile bandwidthlimiter.h
+ * @brief Limits bandwidth used to transfer content of files
+ *
+ * The limiter is a token bucket: data can be transferred in short bursts,
+ * but on average no faster than the configured rate. Uploads and downloads
+ * are limited separately.
+ *
+ * Limiters form a hierarchy. Data transferred through a limiter are also
+ * taken from its parentLimiter(), so the global() limiter caps all transfers
+ * while a limiter forAccount() caps transfers of a single account.
+ *
+ * Jobs transferring content of files use the limiter of their account
+ * unless another limiter is set on the job. Changes of the rates apply
+ * to running transfers immediately.
+ *
+ * @since 6.4
+ */
+class KGAPIDRIVE_EXPORT BandwidthLimiter : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Direction {
+        Upload,
+        Download,
+    };
+    Q_ENUM(Direction)
+
+    explicit BandwidthLimiter(QObject *parent = nullptr);
+    ~BandwidthLimiter() override;
+
+    /**
+     * @brief Returns the limiter shared by all transfers
+     */
+    static BandwidthLimiter *global();
+
+    /**
+     * @brief Returns the limiter shared by all transfers of @p account
+     *
+     * The limiter is created on first use, its parentLimiter() is global().
+     */
+    static BandwidthLimiter *forAccount(const AccountPtr &account);
+
+    /**
+     * @brief Sets limiter whose limits apply on top of limits of this limiter
+     *
+     * The limiter does not take ownership of @p parent.
+     */
+    void setParentLimiter(BandwidthLimiter *parent);
+    [[nodiscard]] BandwidthLimiter *parentLimiter() const;
+
+    /**
+     * @brief Sets maximum rate in bytes per second
+     *
+     * The rate applies outside of the scheduled periods. 0 means unlimited,
+     * which is the default.
+     */
+    void setRate(Direction direction, qint64 bytesPerSecond);
+    [[nodiscard]] qint64 rate(Direction direction) const;
+
+    /**
+     * @brief Sets rate in bytes per second for a period of every day
+     *
+     * The period starts at @p from and ends before @p to, it may wrap around
+     * midnight. When periods overlap, the one added first applies.
+     */
+    void addSchedule(const QTime &from, const QTime &to, Direction direction, qint64 bytesPerSecond);
+
+    /**
+     * @brief Removes all periods added with addSchedule()
+     */
+    void clearSchedule();
+
+    /**
+     * @brief Returns rate of this limiter effective at @p time
+     *
+     * Limits of parentLimiter() are not taken into account.
+     */
+    [[nodiscard]] qint64 effectiveRate(Direction direction, const QTime &time = QTime::currentTime()) const;
+
+    /**
+     * @brief Returns whether this limiter or any of its parents limits the bandwidth
+     */
+    [[nodiscard]] bool isLimited(Direction direction) const;
+
+    /**
+     * @brief Takes up to @p bytes from the bucket
+     *
+     * Returns the number of bytes that may be transferred now, which is
+     * 0 when the bucket of this limiter or any of its parents is empty.
+     */
+    qint64 take(Direction direction, qint64 bytes);
+
+    /**
+     * @brief Returns milliseconds after which take() of @p bytes will succeed
+     */
+    [[nodiscard]] int delay(Direction direction, qint64 bytes) const;
+
+    /**
+     * @brief Returns bytes per second transferred through the limiter recently
+     */
+    [[nodiscard]] qint64 throughput(Direction direction) const;
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when the rate or the schedule of @p direction changed
+     */
+    void rateChanged(KGAPI2::Drive::BandwidthLimiter::Direction direction);
+
+private:
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace Drive
+
+} // namespace KGAPI2
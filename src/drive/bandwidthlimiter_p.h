@@ -0,0 +1,90 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "bandwidthlimiter.h"
+
+#include <QElapsedTimer>
+#include <QIODevice>
+#include <QList>
+#include <QPointer>
+#include <QTimer>
+
+namespace KGAPI2
+{
+
+namespace Drive
+{
+
+/**
+ * @internal
+ *
+ * Read-only device that concatenates its parts and returns only as much
+ * data as the limiter allows. When the limiter has nothing to give, reading
+ * returns 0 bytes and readyRead() is emitted once more data may be read.
+ *
+ * QHttpMultiPart can't be used when limiting bandwidth, as it does not
+ * support parts that temporarily return no data.
+ */
+class KGAPIDRIVE_EXPORT ThrottledDevice : public QIODevice
+{
+public:
+    explicit ThrottledDevice(BandwidthLimiter *limiter, BandwidthLimiter::Direction direction, QObject *parent = nullptr);
+
+    // Parts must be appended before the device is opened
+    void append(const QByteArray &data);
+    // Takes ownership of the open @p device, which must not be sequential
+    void append(QIODevice *device);
+
+    bool open(OpenMode mode) override;
+    bool isSequential() const override;
+    qint64 size() const override;
+    bool seek(qint64 pos) override;
+
+protected:
+    qint64 readData(char *data, qint64 maxSize) override;
+    qint64 writeData(const char *data, qint64 maxSize) override;
+
+private:
+    QPointer<BandwidthLimiter> mLimiter;
+    BandwidthLimiter::Direction mDirection;
+    QList<QIODevice *> mParts;
+    qint64 mOffset = 0;
+    QTimer mRetryTimer;
+};
+
+/**
+ * Measures throughput of transfers from their progress.
+ */
+class Q_DECL_HIDDEN ThroughputMeter
+{
+public:
+    // Starts a new transfer whose progress starts from 0
+    void begin();
+    // Records progress of the current transfer
+    void update(qint64 transferred);
+    // Bytes per second transferred recently
+    [[nodiscard]] qint64 rate() const;
+
+private:
+    struct Sample {
+        qint64 time;
+        qint64 total;
+    };
+
+    QElapsedTimer mTimer;
+    QList<Sample> mSamples;
+    // Bytes transferred before the current transfer
+    qint64 mBase = 0;
+    qint64 mCurrent = 0;
+};
+
+} // namespace Drive
+
+} // namespace KGAPI2
@@ -9,6 +9,7 @@
 #include "utils_p.h"
 
 #include <QJsonDocument>
+#include <QUrlQuery>
 #include <QVariantMap>
 
 using namespace KGAPI2;
@@ -126,6 +127,12 @@ ChangePtr Change::fromJSON(const QByteArray &jsonData)
 }
 
 ChangesList Change::fromJSONFeed(const QByteArray &jsonData, FeedData &feedData)
+{
+    QString newStartPageToken;
+    return fromJSONFeed(jsonData, feedData, newStartPageToken);
+}
+
+ChangesList Change::fromJSONFeed(const QByteArray &jsonData, FeedData &feedData, QString &newStartPageToken)
 {
     QJsonDocument document = QJsonDocument::fromJson(jsonData);
     if (document.isNull()) {
@@ -134,16 +141,27 @@ ChangesList Change::fromJSONFeed(const QByteArray &jsonData, FeedData &feedData)
 
     const QVariant data = document.toVariant();
     const QVariantMap map = data.toMap();
-    if (!map.contains(QLatin1StringView("kind")) || map[QStringLiteral("kind")].toString() != QLatin1StringView("drive#changeList")) {
+    if (!map.contains(Fields::Kind) || map[Fields::Kind].toString() != QLatin1StringView("drive#changeList")) {
         return ChangesList();
     }
 
-    if (map.contains(QLatin1StringView("nextLink"))) {
-        feedData.nextPageUrl = map[QStringLiteral("nextLink")].toUrl();
+    if (map.contains(Fields::NextLink)) {
+        feedData.nextPageUrl = map[Fields::NextLink].toUrl();
+    } else if (map.contains(Fields::NextPageToken) && feedData.requestUrl.isValid()) {
+        // The next link is missing when the response fields are restricted
+        feedData.nextPageUrl = feedData.requestUrl;
+        QUrlQuery query(feedData.nextPageUrl);
+        query.removeAllQueryItems(Fields::PageToken);
+        query.addQueryItem(Fields::PageToken, map[Fields::NextPageToken].toString());
+        feedData.nextPageUrl.setQuery(query);
     }
+    if (map.contains(Fields::LargestChangeId)) {
+        feedData.syncToken = map[Fields::LargestChangeId].toString();
+    }
+    newStartPageToken = map.value(Fields::NewStartPageToken).toString();
 
     ChangesList list;
-    const QVariantList items = map[QStringLiteral("items")].toList();
+    const QVariantList items = map[Fields::Items].toList();
     for (const QVariant &item : items) {
         const ChangePtr change = Private::fromJSON(item.toMap());
 
@@ -154,3 +172,16 @@ ChangesList Change::fromJSONFeed(const QByteArray &jsonData, FeedData &feedData)
 
     return list;
 }
+
+const QString Change::Fields::Kind = QStringLiteral("kind");
+const QString Change::Fields::Id = QStringLiteral("id");
+const QString Change::Fields::FileId = QStringLiteral("fileId");
+const QString Change::Fields::SelfLink = QStringLiteral("selfLink");
+const QString Change::Fields::Deleted = QStringLiteral("deleted");
+const QString Change::Fields::File = QStringLiteral("file");
+const QString Change::Fields::Items = QStringLiteral("items");
+const QString Change::Fields::NextLink = QStringLiteral("nextLink");
+const QString Change::Fields::PageToken = QStringLiteral("pageToken");
+const QString Change::Fields::NextPageToken = QStringLiteral("nextPageToken");
+const QString Change::Fields::NewStartPageToken = QStringLiteral("newStartPageToken");
+const QString Change::Fields::LargestChangeId = QStringLiteral("largestChangeId");
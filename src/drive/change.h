@@ -32,6 +32,26 @@ namespace Drive
 class KGAPIDRIVE_EXPORT Change : public KGAPI2::Object
 {
 public:
+    /**
+     * @brief JSON names of the change and change list properties
+     *
+     * @since 6.4
+     */
+    struct Fields {
+        static const QString Kind;
+        static const QString Id;
+        static const QString FileId;
+        static const QString SelfLink;
+        static const QString Deleted;
+        static const QString File;
+        static const QString Items;
+        static const QString NextLink;
+        static const QString PageToken;
+        static const QString NextPageToken;
+        static const QString NewStartPageToken;
+        static const QString LargestChangeId;
+    };
+
     explicit Change();
     explicit Change(const Change &other);
     ~Change() override;
@@ -71,6 +91,17 @@ public:
     static ChangePtr fromJSON(const QByteArray &jsonData);
     static ChangesList fromJSONFeed(const QByteArray &jsonData, FeedData &feedData);
 
+    /**
+     * @brief Parses a page of changes
+     *
+     * In addition to fromJSONFeed(const QByteArray &, FeedData &), stores
+     * the page token for future changes to @p newStartPageToken. The token is
+     * only present on the last page of the changes.
+     *
+     * @since 6.4
+     */
+    static ChangesList fromJSONFeed(const QByteArray &jsonData, FeedData &feedData, QString &newStartPageToken);
+
 private:
     class Private;
     Private *const d;
@@ -19,6 +19,12 @@
 using namespace KGAPI2;
 using namespace KGAPI2::Drive;
 
+namespace
+{
+// Distinguishes stored page tokens from the stored change IDs
+static const QString PageTokenSyncStatePrefix = QStringLiteral("pageToken:");
+}
+
 class Q_DECL_HIDDEN ChangeFetchJob::Private
 {
 public:
@@ -30,6 +36,12 @@ public:
     bool includeSubscribed = true;
     int maxResults = 0;
     qlonglong startChangeId = 0;
+    QString pageToken;
+    QString newStartPageToken;
+    // Whether the changes are listed from a page token, either the one set
+    // on the job or the one from the stored sync state
+    bool fromPageToken = false;
+    QStringList fields;
     bool includeItemsFromAllDrives = true;
     bool supportsAllDrives = true;
 
@@ -119,6 +131,41 @@ qlonglong ChangeFetchJob::startChangeId() const
     return d->startChangeId;
 }
 
+void ChangeFetchJob::setPageToken(const QString &pageToken)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify pageToken property when job is running";
+        return;
+    }
+
+    d->pageToken = pageToken;
+}
+
+QString ChangeFetchJob::pageToken() const
+{
+    return d->pageToken;
+}
+
+QString ChangeFetchJob::newStartPageToken() const
+{
+    return d->newStartPageToken;
+}
+
+void ChangeFetchJob::setFields(const QStringList &fields)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Called setFields() on running job. Ignoring.";
+        return;
+    }
+
+    d->fields = fields;
+}
+
+QStringList ChangeFetchJob::fields() const
+{
+    return d->fields;
+}
+
 bool ChangeFetchJob::includeItemsFromAllDrives() const
 {
     return d->includeItemsFromAllDrives;
@@ -141,8 +188,37 @@ void ChangeFetchJob::setSupportsAllDrives(bool supportsAllDrives)
 
 void ChangeFetchJob::start()
 {
+    d->newStartPageToken.clear();
+    d->fromPageToken = false;
+
     QUrl url;
     if (d->changeId.isEmpty()) {
+        // The stored state is used only when the properties are unset, and
+        // it does not overwrite them
+        QString pageToken = d->pageToken;
+        qlonglong startChangeId = d->startChangeId;
+        if (startChangeId == 0 && pageToken.isEmpty()) {
+            const QString syncState = storedSyncState();
+            if (syncState.startsWith(PageTokenSyncStatePrefix)) {
+                pageToken = syncState.mid(PageTokenSyncStatePrefix.size());
+            } else {
+                startChangeId = syncState.toLongLong();
+            }
+        }
+        d->fromPageToken = !pageToken.isEmpty();
+        if (!d->fields.isEmpty()) {
+            QStringList fields = d->fields;
+            // Deserializing requires kind attribute, always force add it
+            if (!fields.contains(Change::Fields::Kind)) {
+                fields << Change::Fields::Kind;
+            }
+            Job::setFields({Change::Fields::Kind,
+                            Change::Fields::NextPageToken,
+                            Change::Fields::NewStartPageToken,
+                            Change::Fields::LargestChangeId,
+                            Job::buildSubfields(Change::Fields::Items, fields)});
+        }
+
         url = DriveService::fetchChangesUrl();
         QUrlQuery query(url);
         query.addQueryItem(QStringLiteral("includeDeleted"), Utils::bool2Str(d->includeDeleted));
@@ -150,12 +226,17 @@ void ChangeFetchJob::start()
         if (d->maxResults > 0) {
             query.addQueryItem(QStringLiteral("maxResults"), QString::number(d->maxResults));
         }
-        if (d->startChangeId > 0) {
-            query.addQueryItem(QStringLiteral("startChangeId"), QString::number(d->startChangeId));
+        if (!pageToken.isEmpty()) {
+            query.addQueryItem(Change::Fields::PageToken, pageToken);
+        } else if (startChangeId > 0) {
+            query.addQueryItem(QStringLiteral("startChangeId"), QString::number(startChangeId));
         }
         query.addQueryItem(QStringLiteral("includeItemsFromAllDrives"), Utils::bool2Str(d->includeItemsFromAllDrives));
         url.setQuery(query);
     } else {
+        if (!d->fields.isEmpty()) {
+            Job::setFields(d->fields);
+        }
         url = DriveService::fetchChangeUrl(d->changeId);
     }
 
@@ -178,7 +259,11 @@ ObjectsList ChangeFetchJob::handleReplyWithItems(const QNetworkReply *reply, con
     ContentType ct = Utils::stringToContentType(contentType);
     if (ct == KGAPI2::JSON) {
         if (d->changeId.isEmpty()) {
-            items << Change::fromJSONFeed(rawData, feedData);
+            QString newStartPageToken;
+            items << Change::fromJSONFeed(rawData, feedData, newStartPageToken);
+            if (!newStartPageToken.isEmpty()) {
+                d->newStartPageToken = newStartPageToken;
+            }
         } else {
             items << Change::fromJSON(rawData);
         }
@@ -190,8 +275,21 @@ ObjectsList ChangeFetchJob::handleReplyWithItems(const QNetworkReply *reply, con
     }
 
     if (feedData.nextPageUrl.isValid()) {
+        if (!d->fields.isEmpty()) {
+            // The fields are added to each request by the job
+            QUrlQuery query(feedData.nextPageUrl);
+            query.removeAllQueryItems(Job::StandardParams::Fields);
+            feedData.nextPageUrl.setQuery(query);
+        }
         QNetworkRequest request(feedData.nextPageUrl);
         enqueueRequest(request);
+    } else if (d->fromPageToken) {
+        if (!d->newStartPageToken.isEmpty()) {
+            setReceivedSyncState(PageTokenSyncStatePrefix + d->newStartPageToken);
+        }
+    } else if (!feedData.syncToken.isEmpty()) {
+        // Next synchronization starts right after the largest change seen
+        setReceivedSyncState(QString::number(feedData.syncToken.toLongLong() + 1));
     }
 
     return items;
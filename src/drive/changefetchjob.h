@@ -17,6 +17,21 @@ namespace KGAPI2
 namespace Drive
 {
 
+/**
+ * @headerfile changefetchjob.h
+ * @brief Fetches changes to the files in the user's Drive
+ *
+ * Changes are listed either since a change ID, see startChangeId, or since
+ * a page token, see pageToken. Page tokens are obtained from
+ * ChangeStartPageTokenFetchJob or from newStartPageToken() of a previous
+ * job, listing from a page token never requires walking the whole history
+ * of changes.
+ *
+ * Use FetchJob::setStreaming() to receive the changes page by page through
+ * FetchJob::itemsReceived() instead of keeping all of them in the job, and
+ * setFields() to fetch only the properties of the changes and files the
+ * application needs.
+ */
 class KGAPIDRIVE_EXPORT ChangeFetchJob : public KGAPI2::FetchJob
 {
     Q_OBJECT
@@ -56,13 +71,29 @@ class KGAPIDRIVE_EXPORT ChangeFetchJob : public KGAPI2::FetchJob
     /**
      * Change ID to start listing changes from.
      *
-     * Default value is 0, i.e. all changes.
+     * Default value is 0, i.e. all changes. When a sync state store is set,
+     * the change following the last fetched one is loaded from the store
+     * instead.
      *
      * This property does not have any effect when fetching a specific event and
      * can be modified only when the job is not running.
      */
     Q_PROPERTY(qlonglong startChangeId READ startChangeId WRITE setStartChangeId)
 
+    /**
+     * Page token to start listing changes from.
+     *
+     * When set, startChangeId is ignored. When a sync state store is set and
+     * the previous job has listed changes from a page token, the token for
+     * the changes made since then is loaded from the store instead.
+     *
+     * This property does not have any effect when fetching a specific change
+     * and can be modified only when the job is not running.
+     *
+     * @since 6.4
+     */
+    Q_PROPERTY(QString pageToken READ pageToken WRITE setPageToken)
+
 public:
     explicit ChangeFetchJob(const AccountPtr &account, QObject *parent = nullptr);
     explicit ChangeFetchJob(const QString &changeId, const AccountPtr &account, QObject *parent = nullptr);
@@ -80,6 +111,48 @@ public:
     [[nodiscard]] qlonglong startChangeId() const;
     void setStartChangeId(qlonglong startChangeId);
 
+    /**
+     * @since 6.4
+     */
+    [[nodiscard]] QString pageToken() const;
+
+    /**
+     * @since 6.4
+     */
+    void setPageToken(const QString &pageToken);
+
+    /**
+     * @brief Returns the page token for changes made after this job
+     *
+     * The token is returned with the last page of changes, pass it to
+     * setPageToken() of the next job. Returns an empty string when the job
+     * did not reach the last page.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] QString newStartPageToken() const;
+
+    /**
+     * @brief Sets properties of the changes to fetch
+     *
+     * The @p fields are properties of the changes, see Change::Fields, and
+     * can restrict the properties of the changed files as well, e.g.
+     * Job::buildSubfields(Change::Fields::File, {File::Fields::Kind, File::Fields::Id}).
+     * The kind of the files must be included for the files to be parsed.
+     * Properties required to page through the changes are always fetched.
+     *
+     * By default all properties are fetched. This property can be modified
+     * only when the job is not running.
+     *
+     * @since 6.4
+     */
+    void setFields(const QStringList &fields);
+
+    /**
+     * @since 6.4
+     */
+    [[nodiscard]] QStringList fields() const;
+
     /**
      * @brief Whether both My Drive and shared drive items should be included in results.
      *
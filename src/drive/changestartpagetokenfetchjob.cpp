@@ -0,0 +1,110 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "changestartpagetokenfetchjob.h"
+#include "debug.h"
+#include "driveservice.h"
+#include "utils.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QUrlQuery>
+
+using namespace KGAPI2;
+using namespace KGAPI2::Drive;
+
+class Q_DECL_HIDDEN ChangeStartPageTokenFetchJob::Private
+{
+public:
+    QString driveId;
+    QString startPageToken;
+};
+
+ChangeStartPageTokenFetchJob::ChangeStartPageTokenFetchJob(const AccountPtr &account, QObject *parent)
+    : Job(account, parent)
+    , d(new Private)
+{
+}
+
+ChangeStartPageTokenFetchJob::~ChangeStartPageTokenFetchJob()
+{
+    delete d;
+}
+
+QString ChangeStartPageTokenFetchJob::driveId() const
+{
+    return d->driveId;
+}
+
+void ChangeStartPageTokenFetchJob::setDriveId(const QString &driveId)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify driveId property when job is running";
+        return;
+    }
+
+    d->driveId = driveId;
+}
+
+QString ChangeStartPageTokenFetchJob::startPageToken() const
+{
+    return d->startPageToken;
+}
+
+void ChangeStartPageTokenFetchJob::start()
+{
+    d->startPageToken.clear();
+
+    QUrl url = DriveService::fetchChangesStartPageTokenUrl();
+    QUrlQuery query(url);
+    if (!d->driveId.isEmpty()) {
+        query.addQueryItem(QStringLiteral("driveId"), d->driveId);
+    }
+    query.addQueryItem(QStringLiteral("supportsAllDrives"), Utils::bool2Str(true));
+    url.setQuery(query);
+
+    enqueueRequest(QNetworkRequest(url));
+}
+
+void ChangeStartPageTokenFetchJob::dispatchRequest(QNetworkAccessManager *accessManager,
+                                                   const QNetworkRequest &request,
+                                                   const QByteArray &data,
+                                                   const QString &contentType)
+{
+    Q_UNUSED(data)
+    Q_UNUSED(contentType)
+
+    accessManager->get(request);
+}
+
+void ChangeStartPageTokenFetchJob::handleReply(const QNetworkReply *reply, const QByteArray &rawData)
+{
+    const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+    ContentType ct = Utils::stringToContentType(contentType);
+    if (ct != KGAPI2::JSON) {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content type"));
+        emitFinished();
+        return;
+    }
+
+    const QJsonObject json = QJsonDocument::fromJson(rawData).object();
+    if (json.value(QStringLiteral("kind")).toString() != QLatin1StringView("drive#startPageToken")) {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content"));
+        emitFinished();
+        return;
+    }
+
+    d->startPageToken = json.value(QStringLiteral("startPageToken")).toString();
+}
+
+#include "moc_changestartpagetokenfetchjob.cpp"
@@ -0,0 +1,71 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "job.h"
+#include "kgapidrive_export.h"
+
+namespace KGAPI2
+{
+
+namespace Drive
+{
+
+/**
+ * @headerfile changestartpagetokenfetchjob.h
+ * @brief Fetches the page token of the current change
+ *
+ * Pass the token to ChangeFetchJob::setPageToken() to later fetch all changes
+ * made since this job has finished. A client starting to track changes does
+ * not need to list the whole history of changes first.
+ *
+ * @see ChangeFetchJob
+ * @since 6.4
+ */
+class KGAPIDRIVE_EXPORT ChangeStartPageTokenFetchJob : public KGAPI2::Job
+{
+    Q_OBJECT
+
+    /**
+     * ID of the shared drive for which the token is returned.
+     *
+     * Default value is empty, i.e. the token for the user's changes.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(QString driveId READ driveId WRITE setDriveId)
+
+public:
+    explicit ChangeStartPageTokenFetchJob(const AccountPtr &account, QObject *parent = nullptr);
+    ~ChangeStartPageTokenFetchJob() override;
+
+    [[nodiscard]] QString driveId() const;
+    void setDriveId(const QString &driveId);
+
+    /**
+     * @brief Returns the fetched page token
+     *
+     * Returns an empty string while the job is running or when it failed.
+     */
+    [[nodiscard]] QString startPageToken() const;
+
+protected:
+    void start() override;
+    void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType) override;
+    void handleReply(const QNetworkReply *reply, const QByteArray &rawData) override;
+
+private:
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace Drive
+
+} // namespace KGAPI2
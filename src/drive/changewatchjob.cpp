@@ -0,0 +1,142 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "changewatchjob.h"
+#include "debug.h"
+#include "driveservice.h"
+#include "push/channel.h"
+#include "utils.h"
+
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QUrlQuery>
+
+using namespace KGAPI2;
+using namespace KGAPI2::Drive;
+
+class Q_DECL_HIDDEN ChangeWatchJob::Private
+{
+public:
+    ChannelPtr requestedChannel;
+    ChannelPtr channel;
+
+    bool includeDeleted = true;
+    bool includeSubscribed = true;
+    qlonglong startChangeId = 0;
+};
+
+ChangeWatchJob::ChangeWatchJob(const ChannelPtr &channel, const AccountPtr &account, QObject *parent)
+    : CreateJob(account, parent)
+    , d(new Private)
+{
+    d->requestedChannel = channel;
+}
+
+ChangeWatchJob::~ChangeWatchJob()
+{
+    delete d;
+}
+
+void ChangeWatchJob::setIncludeDeleted(bool includeDeleted)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify includeDeleted property when job is running";
+        return;
+    }
+
+    d->includeDeleted = includeDeleted;
+}
+
+bool ChangeWatchJob::includeDeleted() const
+{
+    return d->includeDeleted;
+}
+
+void ChangeWatchJob::setIncludeSubscribed(bool includeSubscribed)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify includeSubscribed property when job is running";
+        return;
+    }
+
+    d->includeSubscribed = includeSubscribed;
+}
+
+bool ChangeWatchJob::includeSubscribed() const
+{
+    return d->includeSubscribed;
+}
+
+void ChangeWatchJob::setStartChangeId(qlonglong startChangeId)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify startChangeId property when job is running";
+        return;
+    }
+
+    d->startChangeId = startChangeId;
+}
+
+qlonglong ChangeWatchJob::startChangeId() const
+{
+    return d->startChangeId;
+}
+
+ChannelPtr ChangeWatchJob::channel() const
+{
+    return d->channel;
+}
+
+void ChangeWatchJob::start()
+{
+    d->channel.reset();
+
+    QUrl url = DriveService::watchChangesUrl();
+    QUrlQuery query(url);
+    query.addQueryItem(QStringLiteral("includeDeleted"), Utils::bool2Str(d->includeDeleted));
+    query.addQueryItem(QStringLiteral("includeSubscribed"), Utils::bool2Str(d->includeSubscribed));
+    if (d->startChangeId > 0) {
+        query.addQueryItem(QStringLiteral("startChangeId"), QString::number(d->startChangeId));
+    }
+    query.addQueryItem(QStringLiteral("includeItemsFromAllDrives"), Utils::bool2Str(true));
+    query.addQueryItem(QStringLiteral("supportsAllDrives"), Utils::bool2Str(true));
+    url.setQuery(query);
+
+    enqueueRequest(QNetworkRequest(url), Channel::toJSON(d->requestedChannel), QStringLiteral("application/json"));
+}
+
+ObjectsList ChangeWatchJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
+{
+    const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+    ContentType ct = Utils::stringToContentType(contentType);
+    if (ct != KGAPI2::JSON) {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content type"));
+        emitFinished();
+        return {};
+    }
+
+    d->channel = Channel::fromJSON(rawData);
+    if (!d->channel) {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content"));
+        emitFinished();
+        return {};
+    }
+    // The response does not necessarily repeat the address and the token
+    if (d->channel->address().isEmpty()) {
+        d->channel->setAddress(d->requestedChannel->address());
+    }
+    if (d->channel->token().isEmpty()) {
+        d->channel->setToken(d->requestedChannel->token());
+    }
+
+    return {d->channel};
+}
+
+#include "moc_changewatchjob.cpp"
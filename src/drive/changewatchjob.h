@@ -0,0 +1,93 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "createjob.h"
+#include "kgapidrive_export.h"
+
+namespace KGAPI2
+{
+
+namespace Drive
+{
+
+/**
+ * @brief A job to subscribe to push notifications about changes in Drive
+ *
+ * Once the job finishes, Google sends a notification to the address of the
+ * channel whenever a file in the user's Drive changes. Use ChangeFetchJob to
+ * fetch the actual changes and ChannelStopJob with
+ * DriveService::stopChannelUrl() to stop receiving notifications.
+ *
+ * @see WebhookReceiver
+ * @since 6.4
+ */
+class KGAPIDRIVE_EXPORT ChangeWatchJob : public KGAPI2::CreateJob
+{
+    Q_OBJECT
+
+    /**
+     * Whether to notify about removed items.
+     *
+     * By default deleted items are included. This property can be modified
+     * only when the job is not running.
+     */
+    Q_PROPERTY(bool includeDeleted READ includeDeleted WRITE setIncludeDeleted)
+
+    /**
+     * Whether to notify about changes of shared and public files the user
+     * has opened.
+     *
+     * Default is to include subscribed files. This property can be modified
+     * only when the job is not running.
+     */
+    Q_PROPERTY(bool includeSubscribed READ includeSubscribed WRITE setIncludeSubscribed)
+
+    /**
+     * Change ID to start watching changes from.
+     *
+     * Default value is 0, i.e. the current change. This property can be
+     * modified only when the job is not running.
+     */
+    Q_PROPERTY(qlonglong startChangeId READ startChangeId WRITE setStartChangeId)
+
+public:
+    explicit ChangeWatchJob(const ChannelPtr &channel, const AccountPtr &account, QObject *parent = nullptr);
+    ~ChangeWatchJob() override;
+
+    [[nodiscard]] bool includeSubscribed() const;
+    void setIncludeSubscribed(bool includeSubscribed);
+
+    [[nodiscard]] bool includeDeleted() const;
+    void setIncludeDeleted(bool includeDeleted);
+
+    [[nodiscard]] qlonglong startChangeId() const;
+    void setStartChangeId(qlonglong startChangeId);
+
+    /**
+     * @brief Returns the established channel
+     *
+     * In addition to the properties of the requested channel, the returned
+     * channel has the resource ID and the actual expiration set.
+     */
+    [[nodiscard]] ChannelPtr channel() const;
+
+protected:
+    void start() override;
+    KGAPI2::ObjectsList handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData) override;
+
+private:
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace Drive
+
+} // namespace KGAPI2
@@ -0,0 +1,241 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "driveindex.h"
+#include "change.h"
+#include "file.h"
+#include "parentreference.h"
+
+#include <QHash>
+#include <QMultiHash>
+#include <QSet>
+
+using namespace KGAPI2;
+using namespace KGAPI2::Drive;
+
+class Q_DECL_HIDDEN DriveIndex::Private
+{
+public:
+    static QStringList parentIds(const FilePtr &file);
+    static bool isTrashed(const FilePtr &file);
+
+    void insert(const FilePtr &file);
+    void remove(const QString &fileId);
+
+    QString rootFolderId;
+    qlonglong largestChangeId = 0;
+
+    QHash<QString /* file ID */, FilePtr> files;
+    // Children of each folder by their title
+    QHash<QString /* folder ID */, QMultiHash<QString /* title */, QString /* file ID */>> children;
+};
+
+QStringList DriveIndex::Private::parentIds(const FilePtr &file)
+{
+    QStringList ids;
+    const auto parents = file->parents();
+    for (const auto &parent : parents) {
+        if (parent && !parent->id().isEmpty()) {
+            ids << parent->id();
+        }
+    }
+    return ids;
+}
+
+bool DriveIndex::Private::isTrashed(const FilePtr &file)
+{
+    return file->labels() && file->labels()->trashed();
+}
+
+void DriveIndex::Private::insert(const FilePtr &file)
+{
+    remove(file->id());
+    if (isTrashed(file)) {
+        return;
+    }
+
+    files.insert(file->id(), file);
+    const auto parents = file->parents();
+    for (const auto &parent : parents) {
+        if (!parent || parent->id().isEmpty()) {
+            continue;
+        }
+        if (parent->isRoot() && rootFolderId.isEmpty()) {
+            rootFolderId = parent->id();
+        }
+        children[parent->id()].insert(file->title(), file->id());
+    }
+}
+
+void DriveIndex::Private::remove(const QString &fileId)
+{
+    const FilePtr file = files.take(fileId);
+    if (!file) {
+        return;
+    }
+
+    const auto ids = parentIds(file);
+    for (const auto &parentId : ids) {
+        auto it = children.find(parentId);
+        if (it == children.end()) {
+            continue;
+        }
+        it->remove(file->title(), fileId);
+        if (it->isEmpty()) {
+            children.erase(it);
+        }
+    }
+}
+
+DriveIndex::DriveIndex()
+    : d(new Private)
+{
+}
+
+DriveIndex::~DriveIndex()
+{
+    delete d;
+}
+
+void DriveIndex::clear()
+{
+    d->files.clear();
+    d->children.clear();
+    d->largestChangeId = 0;
+}
+
+int DriveIndex::count() const
+{
+    return d->files.count();
+}
+
+QString DriveIndex::rootFolderId() const
+{
+    return d->rootFolderId;
+}
+
+void DriveIndex::setRootFolderId(const QString &rootFolderId)
+{
+    d->rootFolderId = rootFolderId;
+}
+
+void DriveIndex::addFiles(const FilesList &files)
+{
+    d->files.reserve(d->files.size() + files.size());
+    for (const auto &file : files) {
+        if (file && !file->id().isEmpty()) {
+            d->insert(file);
+        }
+    }
+}
+
+void DriveIndex::removeFile(const QString &fileId)
+{
+    d->remove(fileId);
+}
+
+void DriveIndex::applyChanges(const ChangesList &changes)
+{
+    for (const auto &change : changes) {
+        if (!change) {
+            continue;
+        }
+
+        if (change->deleted() || !change->file()) {
+            d->remove(change->fileId());
+        } else {
+            d->insert(change->file());
+        }
+        d->largestChangeId = qMax(d->largestChangeId, change->id());
+    }
+}
+
+qlonglong DriveIndex::largestChangeId() const
+{
+    return d->largestChangeId;
+}
+
+bool DriveIndex::contains(const QString &fileId) const
+{
+    return d->files.contains(fileId);
+}
+
+FilePtr DriveIndex::file(const QString &fileId) const
+{
+    return d->files.value(fileId);
+}
+
+QStringList DriveIndex::childIds(const QString &folderId) const
+{
+    return d->children.value(folderId).values();
+}
+
+FilesList DriveIndex::children(const QString &folderId) const
+{
+    FilesList files;
+    const auto it = d->children.constFind(folderId);
+    if (it == d->children.cend()) {
+        return files;
+    }
+
+    files.reserve(it->size());
+    for (const auto &fileId : *it) {
+        files << d->files.value(fileId);
+    }
+    return files;
+}
+
+QString DriveIndex::idForPath(const QString &path) const
+{
+    QString fileId = d->rootFolderId;
+    const auto titles = QStringView(path).split(QLatin1Char('/'), Qt::SkipEmptyParts);
+    for (const auto &title : titles) {
+        const auto it = d->children.constFind(fileId);
+        if (it == d->children.cend()) {
+            return QString();
+        }
+        fileId = it->value(title.toString());
+        if (fileId.isEmpty()) {
+            return QString();
+        }
+    }
+    return fileId;
+}
+
+FilePtr DriveIndex::fileForPath(const QString &path) const
+{
+    return d->files.value(idForPath(path));
+}
+
+QString DriveIndex::path(const QString &fileId) const
+{
+    if (fileId.isEmpty() || d->rootFolderId.isEmpty()) {
+        return QString();
+    }
+
+    QStringList titles;
+    QSet<QString> visited;
+    QString id = fileId;
+    while (id != d->rootFolderId) {
+        const FilePtr file = d->files.value(id);
+        // Detached from the root, or a broken hierarchy
+        if (!file || visited.contains(id)) {
+            return QString();
+        }
+        visited.insert(id);
+        titles.prepend(file->title());
+
+        const auto parents = Private::parentIds(file);
+        if (parents.isEmpty()) {
+            return QString();
+        }
+        id = parents.constFirst();
+    }
+
+    return QLatin1Char('/') + titles.join(QLatin1Char('/'));
+}
@@ -0,0 +1,144 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "kgapidrive_export.h"
+#include "types.h"
+
+#include <QString>
+#include <QStringList>
+
+namespace KGAPI2
+{
+
+namespace Drive
+{
+
+/**
+ * @headerfile driveindex.h
+ * @brief Local index of files in the user's Drive
+ *
+ * The index keeps all known files by their ID together with the folder
+ * hierarchy, so that paths can be resolved and folders listed without
+ * talking to the server.
+ *
+ * Populate the index with addFiles() from a full listing done by
+ * FileFetchJob, then keep it up to date by passing results of
+ * ChangeFetchJob to applyChanges(), starting with the change following
+ * largestChangeId().
+ *
+ * Trashed files are not part of the index. Files can have more than one
+ * parent, such files are listed in all of their parent folders.
+ *
+ * @since 6.4
+ */
+class KGAPIDRIVE_EXPORT DriveIndex
+{
+public:
+    explicit DriveIndex();
+    ~DriveIndex();
+
+    /**
+     * @brief Removes all files from the index
+     */
+    void clear();
+
+    /**
+     * @brief Returns number of files in the index
+     */
+    [[nodiscard]] int count() const;
+
+    /**
+     * @brief Returns ID of the root folder of My Drive
+     *
+     * The ID is learnt from the parent references of the indexed files, or
+     * can be set explicitly from About::rootFolderId().
+     */
+    [[nodiscard]] QString rootFolderId() const;
+    void setRootFolderId(const QString &rootFolderId);
+
+    /**
+     * @brief Adds or replaces @p files in the index
+     */
+    void addFiles(const FilesList &files);
+
+    /**
+     * @brief Removes file with @p fileId from the index
+     *
+     * Children of a removed folder stay in the index, they are removed by
+     * their own changes.
+     */
+    void removeFile(const QString &fileId);
+
+    /**
+     * @brief Applies @p changes fetched by ChangeFetchJob
+     */
+    void applyChanges(const ChangesList &changes);
+
+    /**
+     * @brief Returns ID of the last change applied to the index, or 0
+     */
+    [[nodiscard]] qlonglong largestChangeId() const;
+
+    /**
+     * @brief Returns whether file with @p fileId is in the index
+     */
+    [[nodiscard]] bool contains(const QString &fileId) const;
+
+    /**
+     * @brief Returns file with @p fileId or a null pointer
+     */
+    [[nodiscard]] FilePtr file(const QString &fileId) const;
+
+    /**
+     * @brief Returns IDs of files in folder @p folderId
+     */
+    [[nodiscard]] QStringList childIds(const QString &folderId) const;
+
+    /**
+     * @brief Returns files in folder @p folderId
+     */
+    [[nodiscard]] FilesList children(const QString &folderId) const;
+
+    /**
+     * @brief Returns ID of the file at @p path, or an empty string
+     *
+     * The path is made of titles of the files separated by slashes, relative
+     * to the root folder, e.g. "/Documents/report.pdf". When a folder contains
+     * more files with the same title, any of them can be returned.
+     */
+    [[nodiscard]] QString idForPath(const QString &path) const;
+
+    /**
+     * @brief Returns file at @p path or a null pointer
+     *
+     * @see idForPath()
+     */
+    [[nodiscard]] FilePtr fileForPath(const QString &path) const;
+
+    /**
+     * @brief Returns path of file with @p fileId, or an empty string
+     *
+     * When the file has more parents, the path through the first one is
+     * returned. Returns an empty string also when the file is not reachable
+     * from the root folder.
+     */
+    [[nodiscard]] QString path(const QString &fileId) const;
+
+private:
+    Q_DISABLE_COPY(DriveIndex)
+
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace Drive
+
+} // namespace KGAPI2
@@ -128,6 +128,27 @@ QUrl fetchChangesUrl()
     return url;
 }
 
+QUrl fetchChangesStartPageTokenUrl()
+{
+    QUrl url(Private::GoogleApisUrl);
+    url.setPath(Private::ChangeBasePath % QLatin1StringView("/startPageToken"));
+    return url;
+}
+
+QUrl watchChangesUrl()
+{
+    QUrl url(Private::GoogleApisUrl);
+    url.setPath(Private::ChangeBasePath % QLatin1StringView("/watch"));
+    return url;
+}
+
+QUrl stopChannelUrl()
+{
+    QUrl url(Private::GoogleApisUrl);
+    url.setPath(QStringLiteral("/drive/v2/channels/stop"));
+    return url;
+}
+
 QUrl touchFileUrl(const QString &fileId)
 {
     QUrl url(Private::GoogleApisUrl);
@@ -309,6 +330,13 @@ QUrl fetchTeamdrivesUrl()
     return url;
 }
 
+QUrl batchUrl()
+{
+    QUrl url(Private::GoogleApisUrl);
+    url.setPath(QStringLiteral("/batch/drive/v2"));
+    return url;
+}
+
 } // namespace DriveService
 
 } // namespace KGAPI2
@@ -44,6 +44,17 @@ KGAPIDRIVE_EXPORT QUrl fetchChangeUrl(const QString &changeId);
 
 KGAPIDRIVE_EXPORT QUrl fetchChangesUrl();
 
+/**
+ * @brief Returns URL for fetching the page token of the current change
+ *
+ * @since 6.4
+ */
+KGAPIDRIVE_EXPORT QUrl fetchChangesStartPageTokenUrl();
+
+KGAPIDRIVE_EXPORT QUrl watchChangesUrl();
+
+KGAPIDRIVE_EXPORT QUrl stopChannelUrl();
+
 KGAPIDRIVE_EXPORT QUrl copyFileUrl(const QString &fileId);
 
 KGAPIDRIVE_EXPORT QUrl deleteFileUrl(const QString &fileId);
@@ -99,6 +110,13 @@ KGAPIDRIVE_EXPORT QUrl fetchTeamdriveUrl(const QString &teamdriveId);
 
 KGAPIDRIVE_EXPORT QUrl fetchTeamdrivesUrl();
 
+/**
+ * @brief Returns URL of the Drive batch endpoint
+ *
+ * @since 6.4
+ */
+KGAPIDRIVE_EXPORT QUrl batchUrl();
+
 } // namespace DriveService
 
 } // namespace KGAPI2
@@ -14,6 +14,7 @@
 
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QSet>
 #include <QUrlQuery>
 
 namespace
@@ -37,6 +38,10 @@ public:
 
     QStringList fields;
 
+    // IDs of items returned so far when the query was split
+    QSet<QString> fetchedIds;
+    bool isSplit = false;
+
 private:
     DrivesFetchJob *const q;
 };
@@ -115,19 +120,31 @@ QStringList DrivesFetchJob::fields() const
 
 void DrivesFetchJob::start()
 {
-    QUrl url;
+    d->fetchedIds.clear();
+    d->isSplit = false;
+
     if (d->drivesId.isEmpty()) {
-        url = DriveService::fetchDrivesUrl();
-        applyRequestParameters(url);
-    } else {
-        url = DriveService::fetchDrivesUrl(d->drivesId);
-        if (!d->fields.isEmpty()) {
-            // Deserializing requires kind attribute, always force add it
-            if (!d->fields.contains(Drives::Fields::Kind)) {
-                d->fields << Drives::Fields::Kind;
-            }
-            Job::setFields(d->fields);
+        // Overly long queries are rejected, run them in parts
+        const QList<SearchQuery> queries = d->searchQuery.split();
+        d->isSplit = queries.size() > 1;
+        if (d->isSplit) {
+            qCDebug(KGAPIDebug) << "Splitting search query into" << queries.size() << "queries";
+        }
+        for (const auto &query : queries) {
+            QUrl url = DriveService::fetchDrivesUrl();
+            applyRequestParameters(url, query.serialize());
+            enqueueRequest(QNetworkRequest(url));
+        }
+        return;
+    }
+
+    QUrl url = DriveService::fetchDrivesUrl(d->drivesId);
+    if (!d->fields.isEmpty()) {
+        // Deserializing requires kind attribute, always force add it
+        if (!d->fields.contains(Drives::Fields::Kind)) {
+            d->fields << Drives::Fields::Kind;
         }
+        Job::setFields(d->fields);
     }
 
     QNetworkRequest request(url);
@@ -145,7 +162,17 @@ ObjectsList DrivesFetchJob::handleReplyWithItems(const QNetworkReply *reply, con
     ContentType ct = Utils::stringToContentType(contentType);
     if (ct == KGAPI2::JSON) {
         if (d->drivesId.isEmpty()) {
-            items << Drives::fromJSONFeed(rawData, feedData);
+            const auto drives = Drives::fromJSONFeed(rawData, feedData);
+            for (const auto &drive : drives) {
+                // Results of the split queries may overlap
+                if (d->isSplit) {
+                    if (d->fetchedIds.contains(drive->id())) {
+                        continue;
+                    }
+                    d->fetchedIds.insert(drive->id());
+                }
+                items << drive;
+            }
         } else {
             items << Drives::fromJSON(rawData);
         }
@@ -158,7 +185,7 @@ ObjectsList DrivesFetchJob::handleReplyWithItems(const QNetworkReply *reply, con
 
     if (feedData.nextPageUrl.isValid()) {
         // Reapply query options
-        applyRequestParameters(feedData.nextPageUrl);
+        applyRequestParameters(feedData.nextPageUrl, QUrlQuery(reply->url()).queryItemValue(QStringLiteral("q"), QUrl::FullyDecoded));
         QNetworkRequest request(feedData.nextPageUrl);
         enqueueRequest(request);
     }
@@ -166,7 +193,7 @@ ObjectsList DrivesFetchJob::handleReplyWithItems(const QNetworkReply *reply, con
     return items;
 }
 
-void DrivesFetchJob::applyRequestParameters(QUrl &url)
+void DrivesFetchJob::applyRequestParameters(QUrl &url, const QString &searchQuery)
 {
     QUrlQuery query(url);
     if (d->maxResults != 0) {
@@ -175,8 +202,8 @@ void DrivesFetchJob::applyRequestParameters(QUrl &url)
     if (!d->useDomainAdminAccess.isNull()) {
         query.addQueryItem(UseDomainAdminAccessAttr, Utils::bool2Str(d->useDomainAdminAccess.toBool()));
     }
-    if (!d->searchQuery.isEmpty()) {
-        query.addQueryItem(QStringLiteral("q"), d->searchQuery.serialize());
+    if (!searchQuery.isEmpty()) {
+        query.addQueryItem(QStringLiteral("q"), searchQuery);
     }
     if (!d->fields.isEmpty()) {
         // Deserializing requires kind attribute, always force add it
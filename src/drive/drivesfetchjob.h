@@ -70,7 +70,7 @@ private:
     QScopedPointer<Private> d;
     friend class Private;
 
-    void applyRequestParameters(QUrl &url);
+    void applyRequestParameters(QUrl &url, const QString &searchQuery);
 };
 
 } // namespace Drive
@@ -9,9 +9,11 @@
 #include "file_p.h"
 #include "parentreference_p.h"
 #include "permission_p.h"
+#include "private/jsonwriter_p.h"
 #include "user.h"
 #include "utils_p.h"
 
+#include <QJsonArray>
 #include <QJsonDocument>
 
 using namespace KGAPI2;
@@ -588,14 +590,86 @@ File::Private::Private(const Private &other)
     , shared(other.shared)
     , owners(other.owners)
     , lastModifyingUser(other.lastModifyingUser)
+    , json(other.json)
+    , lazyFields(other.lazyFields)
 {
 }
 
+void File::Private::decode(LazyField field)
+{
+    if (!(lazyFields & field)) {
+        return;
+    }
+
+    switch (field) {
+    case LazyLabels: {
+        const QJsonObject labelsData = json.value(Fields::Labels).toObject();
+        labels = File::LabelsPtr(new File::Labels());
+        labels->d->starred = labelsData.value(QStringLiteral("starred")).toBool();
+        labels->d->hidden = labelsData.value(QStringLiteral("hidden")).toBool();
+        labels->d->trashed = labelsData.value(QStringLiteral("trashed")).toBool();
+        labels->d->restricted = labelsData.value(QStringLiteral("restricted")).toBool();
+        labels->d->viewed = labelsData.value(QStringLiteral("viewed")).toBool();
+        break;
+    }
+    case LazyIndexableText:
+        indexableText = File::IndexableTextPtr(new File::IndexableText());
+        indexableText->d->text = json.value(Fields::IndexableText).toObject().value(QStringLiteral("text")).toString();
+        break;
+    case LazyUserPermission:
+        userPermission = Permission::Private::fromJSON(json.value(Fields::UserPermission).toObject().toVariantMap());
+        break;
+    case LazyExportLinks: {
+        const QJsonObject exportLinksData = json.value(Fields::ExportLinks).toObject();
+        for (auto iter = exportLinksData.constBegin(); iter != exportLinksData.constEnd(); ++iter) {
+            exportLinks.insert(iter.key(), QUrl(iter.value().toString()));
+        }
+        break;
+    }
+    case LazyImageMediaMetadata:
+        imageMediaMetadata = File::ImageMediaMetadataPtr(new File::ImageMediaMetadata(json.value(Fields::ImageMediaMetadata).toObject().toVariantMap()));
+        break;
+    case LazyThumbnail:
+        thumbnail = File::ThumbnailPtr(new File::Thumbnail(json.value(Fields::Thumbnail).toObject().toVariantMap()));
+        break;
+    case LazyOwners: {
+        const QJsonArray ownersList = json.value(Fields::Owners).toArray();
+        for (const QJsonValue &owner : ownersList) {
+            owners << User::fromJSON(owner.toObject().toVariantMap());
+        }
+        break;
+    }
+    case LazyLastModifyingUser:
+        lastModifyingUser = User::fromJSON(json.value(Fields::LastModifyingUser).toObject().toVariantMap());
+        break;
+    }
+
+    discard(field);
+}
+
+void File::Private::decodeAll()
+{
+    for (int field = LazyLabels; field & AllLazyFields; field <<= 1) {
+        decode(static_cast<LazyField>(field));
+    }
+}
+
+void File::Private::discard(LazyField field)
+{
+    lazyFields &= ~field;
+    if (lazyFields == 0) {
+        // Everything has been decoded or replaced, release the JSON
+        json = QJsonObject();
+    }
+}
+
 bool File::operator==(const File &other) const
 {
     if (!Object::operator==(other)) {
         return false;
     }
+    d->decodeAll();
+    other.d->decodeAll();
     GAPI_COMPARE(id)
     GAPI_COMPARE(selfLink)
     GAPI_COMPARE(title)
@@ -637,95 +711,66 @@ bool File::operator==(const File &other) const
     return true;
 }
 
-FilePtr File::Private::fromJSON(const QVariantMap &map)
+FilePtr File::Private::fromJSON(const QJsonObject &json)
 {
-    if (!map.contains(File::Fields::Kind) || map[File::Fields::Kind].toString() != QLatin1StringView("drive#file")) {
+    if (json.value(File::Fields::Kind).toString() != QLatin1StringView("drive#file")) {
         return FilePtr();
     }
 
     FilePtr file(new File());
-    file->setEtag(map[Fields::Etag].toString());
-    file->d->id = map[Fields::Id].toString();
-    file->d->selfLink = map[Fields::SelfLink].toUrl();
-    file->d->title = map[Fields::Title].toString();
-    file->d->mimeType = map[Fields::MimeType].toString();
-    file->d->description = map[Fields::Description].toString();
-
-    const QVariantMap labelsData = map[Fields::Labels].toMap();
-    File::LabelsPtr labels(new File::Labels());
-    labels->d->starred = labelsData[QStringLiteral("starred")].toBool();
-    labels->d->hidden = labelsData[QStringLiteral("hidden")].toBool();
-    labels->d->trashed = labelsData[QStringLiteral("trashed")].toBool();
-    labels->d->restricted = labelsData[QStringLiteral("restricted")].toBool();
-    labels->d->viewed = labelsData[QStringLiteral("viewed")].toBool();
-    file->d->labels = labels;
+    file->setEtag(json.value(Fields::Etag).toString());
+    file->d->id = json.value(Fields::Id).toString();
+    file->d->selfLink = QUrl(json.value(Fields::SelfLink).toString());
+    file->d->title = json.value(Fields::Title).toString();
+    file->d->mimeType = json.value(Fields::MimeType).toString();
+    file->d->description = json.value(Fields::Description).toString();
 
     // FIXME FIXME FIXME Verify the date format
-    file->d->createdDate = QDateTime::fromString(map[Fields::CreatedDate].toString(), Qt::ISODate);
-    file->d->modifiedDate = QDateTime::fromString(map[Fields::ModifiedDate].toString(), Qt::ISODate);
-    file->d->modifiedByMeDate = QDateTime::fromString(map[Fields::ModifiedByMeDate].toString(), Qt::ISODate);
-    file->d->downloadUrl = map[Fields::DownloadUrl].toUrl();
-
-    const QVariantMap indexableTextData = map[Fields::IndexableText].toMap();
-    File::IndexableTextPtr indexableText(new File::IndexableText());
-    indexableText->d->text = indexableTextData[QStringLiteral("text")].toString();
-    file->d->indexableText = indexableText;
-
-    const QVariantMap userPermissionData = map[Fields::UserPermission].toMap();
-    file->d->userPermission = Permission::Private::fromJSON(userPermissionData);
-
-    file->d->fileExtension = map[Fields::FileExtension].toString();
-    file->d->md5Checksum = map[Fields::Md5Checksum].toString();
-    file->d->fileSize = map[Fields::FileSize].toLongLong();
-    file->d->alternateLink = map[Fields::AlternateLink].toUrl();
-    file->d->embedLink = map[Fields::EmbedLink].toUrl();
-    file->d->version = map[Fields::Version].toLongLong();
-    file->d->sharedWithMeDate = QDateTime::fromString(map[Fields::SharedWithMeDate].toString(), Qt::ISODate);
-
-    const QVariantList parents = map[Fields::Parents].toList();
-    for (const QVariant &parent : parents) {
-        file->d->parents << ParentReference::Private::fromJSON(parent.toMap());
-    }
-
-    const QVariantMap exportLinksData = map[Fields::ExportLinks].toMap();
-    QVariantMap::ConstIterator iter = exportLinksData.constBegin();
-    for (; iter != exportLinksData.constEnd(); ++iter) {
-        file->d->exportLinks.insert(iter.key(), iter.value().toUrl());
-    }
-
-    file->d->originalFileName = map[QStringLiteral("originalFileName")].toString();
-    file->d->quotaBytesUsed = map[QStringLiteral("quotaBytesUsed")].toLongLong();
-    file->d->ownerNames = map[Fields::OwnerNames].toStringList();
-    file->d->lastModifyingUserName = map[QStringLiteral("lastModifyingUserName")].toString();
-    file->d->editable = map[Fields::Editable].toBool();
-    file->d->writersCanShare = map[Fields::WritersCanShare].toBool();
-    file->d->thumbnailLink = map[Fields::ThumbnailLink].toUrl();
-    file->d->lastViewedByMeDate = QDateTime::fromString(map[Fields::LastViewedByMeDate].toString(), Qt::ISODate);
-    file->d->webContentLink = map[Fields::WebContentLink].toUrl();
-    file->d->explicitlyTrashed = map[Fields::ExplicitlyTrashed].toBool();
-
-    const QVariantMap imageMetaData = map[Fields::ImageMediaMetadata].toMap();
-    file->d->imageMediaMetadata = File::ImageMediaMetadataPtr(new File::ImageMediaMetadata(imageMetaData));
-
-    const QVariantMap thumbnailData = map[Fields::Thumbnail].toMap();
-    File::ThumbnailPtr thumbnail(new File::Thumbnail(thumbnailData));
-    file->d->thumbnail = thumbnail;
-
-    file->d->webViewLink = map[Fields::WebViewLink].toUrl();
-    file->d->iconLink = map[Fields::IconLink].toUrl();
-    file->d->shared = map[Fields::Shared].toBool();
-
-    const QVariantList ownersList = map[Fields::Owners].toList();
-    for (const QVariant &owner : ownersList) {
-        file->d->owners << User::fromJSON(owner.toMap());
+    file->d->createdDate = QDateTime::fromString(json.value(Fields::CreatedDate).toString(), Qt::ISODate);
+    file->d->modifiedDate = QDateTime::fromString(json.value(Fields::ModifiedDate).toString(), Qt::ISODate);
+    file->d->modifiedByMeDate = QDateTime::fromString(json.value(Fields::ModifiedByMeDate).toString(), Qt::ISODate);
+    file->d->downloadUrl = QUrl(json.value(Fields::DownloadUrl).toString());
+
+    file->d->fileExtension = json.value(Fields::FileExtension).toString();
+    file->d->md5Checksum = json.value(Fields::Md5Checksum).toString();
+    // 64-bit integers are sent as strings
+    file->d->fileSize = json.value(Fields::FileSize).toVariant().toLongLong();
+    file->d->alternateLink = QUrl(json.value(Fields::AlternateLink).toString());
+    file->d->embedLink = QUrl(json.value(Fields::EmbedLink).toString());
+    file->d->version = json.value(Fields::Version).toVariant().toLongLong();
+    file->d->sharedWithMeDate = QDateTime::fromString(json.value(Fields::SharedWithMeDate).toString(), Qt::ISODate);
+
+    const QJsonArray parents = json.value(Fields::Parents).toArray();
+    for (const QJsonValue &parent : parents) {
+        file->d->parents << ParentReference::Private::fromJSON(parent.toObject().toVariantMap());
     }
 
-    const QVariantMap lastModifyingUser = map[Fields::LastModifyingUser].toMap();
-    file->d->lastModifyingUser = User::fromJSON(lastModifyingUser);
+    file->d->originalFileName = json.value(QStringLiteral("originalFileName")).toString();
+    file->d->quotaBytesUsed = json.value(QStringLiteral("quotaBytesUsed")).toVariant().toLongLong();
+    file->d->ownerNames = json.value(Fields::OwnerNames).toVariant().toStringList();
+    file->d->lastModifyingUserName = json.value(QStringLiteral("lastModifyingUserName")).toString();
+    file->d->editable = json.value(Fields::Editable).toBool();
+    file->d->writersCanShare = json.value(Fields::WritersCanShare).toBool();
+    file->d->thumbnailLink = QUrl(json.value(Fields::ThumbnailLink).toString());
+    file->d->lastViewedByMeDate = QDateTime::fromString(json.value(Fields::LastViewedByMeDate).toString(), Qt::ISODate);
+    file->d->webContentLink = QUrl(json.value(Fields::WebContentLink).toString());
+    file->d->explicitlyTrashed = json.value(Fields::ExplicitlyTrashed).toBool();
+    file->d->webViewLink = QUrl(json.value(Fields::WebViewLink).toString());
+    file->d->iconLink = QUrl(json.value(Fields::IconLink).toString());
+    file->d->shared = json.value(Fields::Shared).toBool();
+
+    // Most users never look at these, decode them only when accessed
+    file->d->json = json;
+    file->d->lazyFields = AllLazyFields;
 
     return file;
 }
 
+FilePtr File::Private::fromJSON(const QVariantMap &map)
+{
+    return fromJSON(QJsonObject::fromVariantMap(map));
+}
+
 File::File()
     : KGAPI2::Object()
     , d(new Private)
@@ -790,11 +835,13 @@ void File::setDescription(const QString &description)
 
 File::LabelsPtr File::labels() const
 {
+    d->decode(Private::LazyLabels);
     return d->labels;
 }
 
 void File::setLabels(const File::LabelsPtr &labels)
 {
+    d->discard(Private::LazyLabels);
     d->labels = labels;
 }
 
@@ -825,11 +872,13 @@ QUrl File::downloadUrl() const
 
 File::IndexableTextPtr &File::indexableText()
 {
+    d->decode(Private::LazyIndexableText);
     return d->indexableText;
 }
 
 PermissionPtr File::userPermission() const
 {
+    d->decode(Private::LazyUserPermission);
     return d->userPermission;
 }
 
@@ -880,6 +929,7 @@ void File::setParents(const ParentReferencesList &parents)
 
 QMap<QString, QUrl> File::exportLinks() const
 {
+    d->decode(Private::LazyExportLinks);
     return d->exportLinks;
 }
 
@@ -940,11 +990,13 @@ bool File::explicitlyTrashed() const
 
 File::ImageMediaMetadataPtr File::imageMediaMetadata() const
 {
+    d->decode(Private::LazyImageMediaMetadata);
     return d->imageMediaMetadata;
 }
 
 File::ThumbnailPtr File::thumbnail() const
 {
+    d->decode(Private::LazyThumbnail);
     return d->thumbnail;
 }
 
@@ -965,11 +1017,13 @@ bool File::shared() const
 
 UsersList File::owners() const
 {
+    d->decode(Private::LazyOwners);
     return d->owners;
 }
 
 UserPtr File::lastModifyingUser() const
 {
+    d->decode(Private::LazyLastModifyingUser);
     return d->lastModifyingUser;
 }
 
@@ -1036,8 +1090,7 @@ FilePtr File::fromJSON(const QByteArray &jsonData)
     if (document.isNull()) {
         return FilePtr();
     }
-    const QVariant data = document.toVariant();
-    return Private::fromJSON(data.toMap());
+    return Private::fromJSON(document.object());
 }
 
 FilePtr File::fromJSON(const QVariantMap &jsonData)
@@ -1054,24 +1107,25 @@ FilesList File::fromJSONFeed(const QByteArray &jsonData, FeedData &feedData)
     if (document.isNull()) {
         return FilesList();
     }
-    const QVariant data = document.toVariant();
-    const QVariantMap map = data.toMap();
-    if (!map.contains(File::Fields::Kind) || map[Fields::Kind].toString() != QLatin1StringView("drive#fileList")) {
+    // Avoid converting the whole listing to QVariants
+    const QJsonObject json = document.object();
+    if (json.value(Fields::Kind).toString() != QLatin1StringView("drive#fileList")) {
         return FilesList();
     }
 
     FilesList list;
-    const QVariantList items = map[File::Fields::Items].toList();
-    for (const QVariant &item : items) {
-        const FilePtr file = Private::fromJSON(item.toMap());
+    const QJsonArray items = json.value(File::Fields::Items).toArray();
+    list.reserve(items.size());
+    for (const QJsonValue &item : items) {
+        const FilePtr file = Private::fromJSON(item.toObject());
 
         if (!file.isNull()) {
             list << file;
         }
     }
 
-    if (map.contains(File::Fields::NextLink)) {
-        feedData.nextPageUrl = map[File::Fields::NextLink].toUrl();
+    if (json.contains(File::Fields::NextLink)) {
+        feedData.nextPageUrl = QUrl(json.value(File::Fields::NextLink).toString());
     }
 
     return list;
@@ -1079,132 +1133,133 @@ FilesList File::fromJSONFeed(const QByteArray &jsonData, FeedData &feedData)
 
 QByteArray File::toJSON(const FilePtr &file, SerializationOptions options)
 {
-    QVariantMap map;
+    JsonWriter writer;
+    writer.beginObject();
 
-    map[File::Fields::Kind] = QLatin1StringView("drive#file");
+    writer.insert(File::Fields::Kind, "drive#file");
     if (!file->description().isEmpty()) {
-        map[Fields::Description] = file->description();
+        writer.insert(Fields::Description, file->description());
     }
 
     if (file->indexableText() && !file->indexableText()->text().isEmpty()) {
-        QVariantMap indexableText;
-        indexableText[QStringLiteral("text")] = file->indexableText()->text();
-        map[Fields::IndexableText] = indexableText;
+        writer.beginObject(Fields::IndexableText);
+        writer.insert("text", file->indexableText()->text());
+        writer.endObject();
     }
 
     if (file->labels()) {
-        QVariantMap labels;
-        labels[QStringLiteral("hidden")] = file->labels()->hidden();
-        labels[QStringLiteral("restricted")] = file->labels()->restricted();
-        labels[QStringLiteral("starred")] = file->labels()->starred();
-        labels[QStringLiteral("trashed")] = file->labels()->trashed();
-        labels[QStringLiteral("viewed")] = file->labels()->viewed();
-        map[Fields::Labels] = labels;
+        writer.beginObject(Fields::Labels);
+        writer.insert("hidden", file->labels()->hidden());
+        writer.insert("restricted", file->labels()->restricted());
+        writer.insert("starred", file->labels()->starred());
+        writer.insert("trashed", file->labels()->trashed());
+        writer.insert("viewed", file->labels()->viewed());
+        writer.endObject();
     }
 
     if (file->lastViewedByMeDate().isValid()) {
-        map[Fields::LastViewedByMeDate] = file->lastViewedByMeDate().toString(Qt::ISODate);
+        writer.insert(Fields::LastViewedByMeDate, file->lastViewedByMeDate().toString(Qt::ISODate));
     }
 
     if (!file->mimeType().isEmpty()) {
-        map[Fields::MimeType] = file->mimeType();
+        writer.insert(Fields::MimeType, file->mimeType());
     }
 
     if (file->modifiedDate().isValid()) {
-        map[Fields::ModifiedDate] = file->modifiedDate().toString(Qt::ISODate);
+        writer.insert(Fields::ModifiedDate, file->modifiedDate().toString(Qt::ISODate));
     }
     if (file->createdDate().isValid() && !(options & ExcludeCreationDate)) {
-        map[Fields::CreatedDate] = file->createdDate().toString(Qt::ISODate);
+        writer.insert(Fields::CreatedDate, file->createdDate().toString(Qt::ISODate));
     }
     if (file->modifiedByMeDate().isValid()) {
-        map[Fields::ModifiedByMeDate] = file->modifiedByMeDate().toString(Qt::ISODate);
+        writer.insert(Fields::ModifiedByMeDate, file->modifiedByMeDate().toString(Qt::ISODate));
     }
 
     if (file->fileSize() > 0) {
-        map[Fields::FileSize] = file->fileSize();
+        writer.insert(Fields::FileSize, static_cast<qint64>(file->fileSize()));
     }
 
     if (!file->title().isEmpty()) {
-        map[Fields::Title] = file->title();
+        writer.insert(Fields::Title, file->title());
     }
 
-    QVariantList parents;
     const auto parentReferences = file->parents();
-    parents.reserve(parentReferences.size());
-    for (const ParentReferencePtr &parent : parentReferences) {
-        parents << ParentReference::Private::toJSON(parent);
-    }
-    if (!parents.isEmpty()) {
-        map[Fields::Parents] = parents;
+    if (!parentReferences.isEmpty()) {
+        writer.beginArray(Fields::Parents);
+        for (const ParentReferencePtr &parent : parentReferences) {
+            ParentReference::Private::toJSON(writer, parent);
+        }
+        writer.endArray();
     }
     if (!file->etag().isEmpty()) {
-        map[Fields::Etag] = file->etag();
+        writer.insert(Fields::Etag, file->etag());
     }
     if (!file->d->id.isEmpty()) {
-        map[Fields::Id] = file->d->id;
+        writer.insert(Fields::Id, file->d->id);
     }
     if (!file->d->selfLink.isEmpty()) {
-        map[Fields::SelfLink] = file->d->selfLink;
+        writer.insert(Fields::SelfLink, file->d->selfLink.toString(QUrl::FullyEncoded));
     }
     if (!file->d->downloadUrl.isEmpty()) {
-        map[Fields::DownloadUrl] = file->d->downloadUrl;
+        writer.insert(Fields::DownloadUrl, file->d->downloadUrl.toString(QUrl::FullyEncoded));
     }
 
     if (!file->d->fileExtension.isEmpty()) {
-        map[Fields::FileExtension] = file->d->fileExtension;
+        writer.insert(Fields::FileExtension, file->d->fileExtension);
     }
     if (!file->d->md5Checksum.isEmpty()) {
-        map[Fields::Md5Checksum] = file->d->md5Checksum;
+        writer.insert(Fields::Md5Checksum, file->d->md5Checksum);
     }
     if (!file->d->alternateLink.isEmpty()) {
-        map[Fields::AlternateLink] = file->d->alternateLink;
+        writer.insert(Fields::AlternateLink, file->d->alternateLink.toString(QUrl::FullyEncoded));
     }
     if (!file->d->embedLink.isEmpty()) {
-        map[Fields::EmbedLink] = file->d->embedLink;
+        writer.insert(Fields::EmbedLink, file->d->embedLink.toString(QUrl::FullyEncoded));
     }
     if (!file->d->sharedWithMeDate.isNull()) {
-        map[Fields::SharedWithMeDate] = file->d->sharedWithMeDate.toString(Qt::ISODate);
+        writer.insert(Fields::SharedWithMeDate, file->d->sharedWithMeDate.toString(Qt::ISODate));
     }
 
     if (!file->d->originalFileName.isEmpty()) {
-        map[QStringLiteral("originalFileName")] = file->d->originalFileName;
+        writer.insert("originalFileName", file->d->originalFileName);
     }
     if (file->d->quotaBytesUsed > 0) {
-        map[QStringLiteral("quotaBytesUsed")] = file->d->quotaBytesUsed;
+        writer.insert("quotaBytesUsed", static_cast<qint64>(file->d->quotaBytesUsed));
     }
     if (!file->d->ownerNames.isEmpty()) {
-        map[Fields::OwnerNames] = QVariant(file->d->ownerNames);
+        writer.beginArray(Fields::OwnerNames);
+        for (const QString &ownerName : std::as_const(file->d->ownerNames)) {
+            writer.value(ownerName);
+        }
+        writer.endArray();
     }
     if (!file->d->lastModifyingUserName.isEmpty()) {
-        map[QStringLiteral("lastModifyingUserName")] = file->d->lastModifyingUserName;
+        writer.insert("lastModifyingUserName", file->d->lastModifyingUserName);
     }
     if (!file->d->editable) { // default is true
-        map[Fields::Editable] = file->d->editable;
+        writer.insert(Fields::Editable, false);
     }
     if (file->d->writersCanShare) { // default is false
-        map[Fields::WritersCanShare] = file->d->writersCanShare;
+        writer.insert(Fields::WritersCanShare, true);
     }
     if (!file->d->thumbnailLink.isEmpty()) {
-        map[Fields::ThumbnailLink] = file->d->thumbnailLink;
-    }
-    if (!file->d->lastViewedByMeDate.isNull()) {
-        map[Fields::LastViewedByMeDate] = file->d->lastViewedByMeDate.toString(Qt::ISODate);
+        writer.insert(Fields::ThumbnailLink, file->d->thumbnailLink.toString(QUrl::FullyEncoded));
     }
     if (!file->d->webContentLink.isEmpty()) {
-        map[Fields::WebContentLink] = file->d->webContentLink;
+        writer.insert(Fields::WebContentLink, file->d->webContentLink.toString(QUrl::FullyEncoded));
     }
     if (file->d->explicitlyTrashed) {
-        map[Fields::ExplicitlyTrashed] = file->d->explicitlyTrashed;
+        writer.insert(Fields::ExplicitlyTrashed, true);
     }
 
     if (!file->d->webViewLink.isEmpty()) {
-        map[Fields::WebViewLink] = file->d->webViewLink;
+        writer.insert(Fields::WebViewLink, file->d->webViewLink.toString(QUrl::FullyEncoded));
     }
     if (!file->d->iconLink.isEmpty()) {
-        map[Fields::IconLink] = file->d->iconLink;
+        writer.insert(Fields::IconLink, file->d->iconLink.toString(QUrl::FullyEncoded));
     }
     if (file->d->shared) {
-        map[Fields::Shared] = file->d->shared;
+        writer.insert(Fields::Shared, true);
     }
 
 #if 0
@@ -1243,6 +1298,6 @@ QByteArray File::toJSON(const FilePtr &file, SerializationOptions options)
 
 #endif
 
-    QJsonDocument document = QJsonDocument::fromVariant(map);
-    return document.toJson(QJsonDocument::Compact);
+    writer.endObject();
+    return writer.data();
 }
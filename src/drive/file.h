@@ -29,6 +29,10 @@ namespace Drive
  * Getters and setters' documentation is based on Google Drive's API v2 reference
  * @see <a href="https://developers.google.com/drive/v2/reference/files">Files</a>
  *
+ * Labels, indexable text, user permission, export links, image metadata,
+ * thumbnail and owners of a parsed file are decoded on first access. Because
+ * of that, a File shared between threads must not be accessed concurrently.
+ *
  * @since 2.0
  * @author Andrius da Costa Ribas <andriusmao@gmail.com>
  * @author Daniel Vrátil <dvratil@redhat.com>
@@ -8,6 +8,7 @@
 
 #include "file.h"
 
+#include <QJsonObject>
 #include <QVariantMap>
 
 namespace KGAPI2
@@ -22,6 +23,23 @@ public:
     Private();
     Private(const Private &other);
 
+    // Sub-objects that are decoded from the JSON on first access
+    enum LazyField {
+        LazyLabels = 1 << 0,
+        LazyIndexableText = 1 << 1,
+        LazyUserPermission = 1 << 2,
+        LazyExportLinks = 1 << 3,
+        LazyImageMediaMetadata = 1 << 4,
+        LazyThumbnail = 1 << 5,
+        LazyOwners = 1 << 6,
+        LazyLastModifyingUser = 1 << 7,
+    };
+    static constexpr int AllLazyFields = (LazyLastModifyingUser << 1) - 1;
+
+    void decode(LazyField field);
+    void decodeAll();
+    void discard(LazyField field);
+
     QString id;
     QUrl selfLink;
     QString title;
@@ -61,6 +79,10 @@ public:
     UsersList owners;
     UserPtr lastModifyingUser;
 
+    QJsonObject json;
+    int lazyFields = 0;
+
+    static FilePtr fromJSON(const QJsonObject &json);
     static FilePtr fromJSON(const QVariantMap &map);
 };
 
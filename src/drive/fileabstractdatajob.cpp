@@ -7,6 +7,8 @@
  */
 
 #include "fileabstractdatajob.h"
+#include "bandwidthlimiter.h"
+#include "bandwidthlimiter_p.h"
 #include "debug.h"
 #include "utils.h"
 
@@ -30,6 +32,9 @@ public:
     QString timedTextLanguage;
     QString timedTextTrackName;
     bool useContentAsIndexableText = false;
+
+    QPointer<BandwidthLimiter> bandwidthLimiter;
+    ThroughputMeter throughput;
 };
 
 FileAbstractDataJob::Private::Private()
@@ -192,6 +197,36 @@ bool FileAbstractDataJob::useContentAsIndexableText() const
     return d->useContentAsIndexableText;
 }
 
+void FileAbstractDataJob::setBandwidthLimiter(BandwidthLimiter *limiter)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify bandwidthLimiter property when job is running";
+        return;
+    }
+
+    d->bandwidthLimiter = limiter;
+}
+
+BandwidthLimiter *FileAbstractDataJob::bandwidthLimiter() const
+{
+    return d->bandwidthLimiter ? d->bandwidthLimiter.data() : BandwidthLimiter::forAccount(account());
+}
+
+qint64 FileAbstractDataJob::throughput() const
+{
+    return d->throughput.rate();
+}
+
+void FileAbstractDataJob::startTransfer()
+{
+    d->throughput.begin();
+}
+
+void FileAbstractDataJob::updateTransfer(qint64 bytes)
+{
+    d->throughput.update(bytes);
+}
+
 QUrl FileAbstractDataJob::updateUrl(QUrl &url)
 {
     QUrlQuery query(url);
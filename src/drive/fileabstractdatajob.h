@@ -17,6 +17,8 @@ namespace KGAPI2
 namespace Drive
 {
 
+class BandwidthLimiter;
+
 class KGAPIDRIVE_EXPORT FileAbstractDataJob : public KGAPI2::Job
 {
     Q_OBJECT
@@ -163,9 +165,54 @@ public:
     [[nodiscard]] bool useContentAsIndexableText() const;
     void setUseContentAsIndexableText(bool useContentAsIndexableText);
 
+    /**
+     * @brief Sets limiter of the bandwidth used to upload content of files
+     *
+     * Defaults to BandwidthLimiter::forAccount() of the job's account. The
+     * job does not take ownership of the @p limiter. A limit set while the
+     * content is not being limited applies from the next request.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @since 6.4
+     */
+    void setBandwidthLimiter(BandwidthLimiter *limiter);
+
+    /**
+     * @brief Returns limiter of the bandwidth used to upload content of files
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] BandwidthLimiter *bandwidthLimiter() const;
+
+    /**
+     * @brief Returns bytes per second uploaded recently
+     *
+     * Updated whenever the progress() signal is emitted.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] qint64 throughput() const;
+
 protected:
     QUrl updateUrl(QUrl &url);
 
+    /**
+     * @brief Starts measuring throughput of a new request
+     *
+     * @since 6.4
+     */
+    void startTransfer();
+
+    /**
+     * @brief Updates throughput with @p bytes uploaded by the current request
+     *
+     * Call before emitting progress.
+     *
+     * @since 6.4
+     */
+    void updateTransfer(qint64 bytes);
+
 private:
     class Private;
     Private *const d;
@@ -7,9 +7,13 @@
  */
 
 #include "fileabstractmodifyjob.h"
+#include "debug.h"
+#include "driveservice.h"
 #include "file.h"
+#include "private/batchrequest_p.h"
 #include "utils.h"
 
+#include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QNetworkRequest>
 #include <QUrlQuery>
@@ -22,11 +26,16 @@ class Q_DECL_HIDDEN FileAbstractModifyJob::Private
 public:
     Private(FileAbstractModifyJob *parent);
     void processNext();
+    QUrl fileUrl(const QString &fileId) const;
 
     QStringList filesIds;
 
     bool supportsAllDrives = true;
 
+    int batchSize = 1;
+    int currentBatchSize = 0;
+    ItemResultsList itemResults;
+
 private:
     FileAbstractModifyJob *const q;
 };
@@ -43,17 +52,33 @@ void FileAbstractModifyJob::Private::processNext()
         return;
     }
 
+    if (batchSize > 1) {
+        BatchRequest batch(DriveService::batchUrl());
+        const QStringList ids = filesIds.mid(0, batchSize);
+        filesIds.remove(0, ids.size());
+        for (const QString &fileId : ids) {
+            batch.addRequest("POST", fileUrl(fileId));
+        }
+        currentBatchSize = batch.count();
+        q->enqueueRequest(batch.request(), batch.data(), batch.contentType());
+        return;
+    }
+
     const QString fileId = filesIds.takeFirst();
+    QNetworkRequest request(fileUrl(fileId));
+    request.setHeader(QNetworkRequest::ContentLengthHeader, 0);
+
+    q->enqueueRequest(request);
+}
+
+QUrl FileAbstractModifyJob::Private::fileUrl(const QString &fileId) const
+{
     QUrl url = q->url(fileId);
 
     QUrlQuery query(url);
     query.addQueryItem(QStringLiteral("supportsAllDrives"), Utils::bool2Str(supportsAllDrives));
     url.setQuery(query);
-
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentLengthHeader, 0);
-
-    q->enqueueRequest(request);
+    return url;
 }
 
 FileAbstractModifyJob::FileAbstractModifyJob(const QString &fileId, const AccountPtr &account, QObject *parent)
@@ -91,11 +116,33 @@ FileAbstractModifyJob::~FileAbstractModifyJob()
     delete d;
 }
 
+void FileAbstractModifyJob::aboutToStart()
+{
+    d->itemResults.clear();
+    ModifyJob::aboutToStart();
+}
+
 void FileAbstractModifyJob::start()
 {
     d->processNext();
 }
 
+void FileAbstractModifyJob::dispatchRequest(QNetworkAccessManager *accessManager,
+                                            const QNetworkRequest &request,
+                                            const QByteArray &data,
+                                            const QString &contentType)
+{
+    if (d->batchSize > 1) {
+        // Batch requests are always POSTed to the batch endpoint
+        QNetworkRequest r(request);
+        r.setHeader(QNetworkRequest::ContentTypeHeader, contentType);
+        accessManager->post(r, data);
+        return;
+    }
+
+    ModifyJob::dispatchRequest(accessManager, request, data, contentType);
+}
+
 bool FileAbstractModifyJob::supportsAllDrives() const
 {
     return d->supportsAllDrives;
@@ -106,13 +153,63 @@ void FileAbstractModifyJob::setSupportsAllDrives(bool supportsAllDrives)
     d->supportsAllDrives = supportsAllDrives;
 }
 
+void FileAbstractModifyJob::setBatchSize(int batchSize)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify batchSize property when job is running";
+        return;
+    }
+
+    d->batchSize = qBound(1, batchSize, BatchRequest::MaxBatchSize);
+}
+
+int FileAbstractModifyJob::batchSize() const
+{
+    return d->batchSize;
+}
+
+ItemResultsList FileAbstractModifyJob::itemResults() const
+{
+    return d->itemResults;
+}
+
 ObjectsList FileAbstractModifyJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
 {
     const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
-    ContentType ct = Utils::stringToContentType(contentType);
     ObjectsList items;
+
+    if (d->batchSize > 1) {
+        if (!BatchRequest::isBatchResponse(contentType)) {
+            setError(KGAPI2::InvalidResponse);
+            setErrorString(tr("Invalid response content type"));
+            emitFinished();
+            return items;
+        }
+
+        const ItemResult failure = BatchRequest::appendResults(
+            contentType,
+            rawData,
+            d->currentBatchSize,
+            d->itemResults,
+            [](const QByteArray &body) -> ObjectPtr {
+                return File::fromJSON(body);
+            },
+            &items);
+        if (failure.error != KGAPI2::NoError) {
+            setError(failure.error);
+            setErrorString(failure.errorString);
+        }
+
+        // Enqueue next batch or finish
+        d->processNext();
+
+        return items;
+    }
+
+    ContentType ct = Utils::stringToContentType(contentType);
     if (ct == KGAPI2::JSON) {
         items << File::fromJSON(rawData);
+        d->itemResults << ItemResult{items.constLast(), KGAPI2::NoError, QString()};
     } else {
         setError(KGAPI2::InvalidResponse);
         setErrorString(tr("Invalid response content type"));
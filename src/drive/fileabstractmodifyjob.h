@@ -23,6 +23,22 @@ class KGAPIDRIVE_EXPORT FileAbstractModifyJob : public KGAPI2::ModifyJob
 {
     Q_OBJECT
 
+    /**
+     * @brief Number of files modified in a single request
+     *
+     * When larger than 1, files are modified through the Drive batch
+     * endpoint in groups of up to batchSize files, instead of one request
+     * per file. Results of the individual files are available through
+     * itemResults().
+     *
+     * Defaults to 1, the maximum is 100. This property can be modified only
+     * when the job is not running.
+     *
+     * @see setBatchSize, batchSize
+     * @since 6.4
+     */
+    Q_PROPERTY(int batchSize READ batchSize WRITE setBatchSize)
+
 public:
     explicit FileAbstractModifyJob(const QString &fileId, const AccountPtr &account, QObject *parent = nullptr);
     explicit FileAbstractModifyJob(const QStringList &filesIds, const AccountPtr &account, QObject *parent = nullptr);
@@ -50,8 +66,36 @@ public:
      */
     KGAPIDRIVE_DEPRECATED void setSupportsAllDrives(bool supportsAllDrives);
 
+    /**
+     * @brief Sets number of files to modify in a single batch request
+     *
+     * @param batchSize Number of files per request, between 1 and 100.
+     * @since 6.4
+     */
+    void setBatchSize(int batchSize);
+
+    /**
+     * @brief Returns number of files modified in a single batch request
+     * @since 6.4
+     */
+    [[nodiscard]] int batchSize() const;
+
+    /**
+     * @brief Returns results of the individual files
+     *
+     * The results are in the same order as the files passed to the
+     * constructor. In batch mode a failure of a single file does not stop
+     * the job, error() then reports the first failure and the result of
+     * every file is available here.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] ItemResultsList itemResults() const;
+
 protected:
+    void aboutToStart() override;
     void start() override;
+    void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType) override;
     KGAPI2::ObjectsList handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData) override;
 
     virtual QUrl url(const QString &fileId) = 0;
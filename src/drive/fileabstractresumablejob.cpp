@@ -7,20 +7,72 @@
  */
 
 #include "fileabstractresumablejob.h"
+#include "bandwidthlimiter.h"
+#include "bandwidthlimiter_p.h"
 #include "debug.h"
 #include "utils.h"
 
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QMimeDatabase>
 #include <QNetworkReply>
 #include <QNetworkRequest>
 #include <QUrlQuery>
 
+#include <utility>
+
 using namespace KGAPI2;
 using namespace KGAPI2::Drive;
 
 namespace
 {
-static const int ChunkSize = 262144;
+// Chunks except for the last one must be a multiple of 256 KiB
+static constexpr qint64 ChunkGranularity = 256 * 1024;
+// Attempts to resume the upload after an error without the server committing
+// any more data
+static constexpr int MaxResumeAttempts = 3;
+
+qint64 committedFromRange(const QNetworkReply *reply)
+{
+    // Range: bytes=0-<last committed byte>, missing if nothing has been committed
+    const QByteArray range = reply->rawHeader("Range");
+    const int dash = range.indexOf('-');
+    if (!range.startsWith("bytes=") || dash == -1) {
+        return 0;
+    }
+    bool ok = false;
+    const qint64 last = range.mid(dash + 1).toLongLong(&ok);
+    return ok ? last + 1 : 0;
+}
+} // namespace
+
+bool FileAbstractResumableJob::UploadState::isValid() const
+{
+    return sessionUrl.isValid() && !sessionUrl.isEmpty();
+}
+
+QByteArray FileAbstractResumableJob::UploadState::toJSON() const
+{
+    QJsonObject object;
+    object.insert(QStringLiteral("sessionUrl"), sessionUrl.toString());
+    object.insert(QStringLiteral("totalSize"), totalSize);
+    object.insert(QStringLiteral("offset"), offset);
+    return QJsonDocument(object).toJson(QJsonDocument::Compact);
+}
+
+FileAbstractResumableJob::UploadState FileAbstractResumableJob::UploadState::fromJSON(const QByteArray &jsonData)
+{
+    const QJsonDocument document = QJsonDocument::fromJson(jsonData);
+    if (!document.isObject()) {
+        return {};
+    }
+
+    const QJsonObject object = document.object();
+    UploadState state;
+    state.sessionUrl = QUrl(object.value(QStringLiteral("sessionUrl")).toString());
+    state.totalSize = object.value(QStringLiteral("totalSize")).toInteger();
+    state.offset = object.value(QStringLiteral("offset")).toInteger();
+    return state;
 }
 
 class Q_DECL_HIDDEN FileAbstractResumableJob::Private
@@ -28,9 +80,13 @@ class Q_DECL_HIDDEN FileAbstractResumableJob::Private
 public:
     Private(FileAbstractResumableJob *parent);
     void startUploadSession();
-    void uploadChunk(bool lastChunk);
+    void uploadChunk(bool isLast);
     void processNext();
-    void readFromDevice();
+    bool readFromDevice();
+    QByteArray takeChunk();
+    void queryStatus();
+    bool resumeInterrupted(const QString &reason);
+    bool rewindTo(qint64 committed);
     bool isTotalSizeKnown() const;
 
     void _k_uploadProgress(qint64 bytesSent, qint64 totalBytes);
@@ -39,9 +95,24 @@ public:
     QIODevice *device = nullptr;
 
     QString sessionPath;
-    QList<QByteArray> chunks;
-    int uploadedSize = 0;
-    int totalUploadSize = 0;
+    // Data written or read but not uploaded yet, at most one chunk when
+    // reading from the device
+    QByteArray buffer;
+    qint64 chunkSize = ChunkGranularity;
+    qint64 uploadedSize = 0;
+    qint64 totalUploadSize = 0;
+    // The client has written all data
+    bool dataComplete = false;
+
+    // Last uploaded chunk, kept until the server commits it
+    QByteArray lastChunk;
+    qint64 lastChunkOffset = 0;
+    qint64 committedSize = 0;
+    UploadState resumeState;
+    qint64 deviceOrigin = 0;
+    bool resuming = false;
+    bool queryingStatus = false;
+    int resumeAttempts = 0;
 
     enum SessionState { ReadyStart, Started, ClientEnough, Completed };
 
@@ -72,10 +143,10 @@ void FileAbstractResumableJob::Private::startUploadSession()
     QNetworkRequest request(url);
     QByteArray rawData;
     if (!metaData.isNull()) {
-        if (metaData->mimeType().isEmpty() && !chunks.isEmpty()) {
+        if (metaData->mimeType().isEmpty() && !buffer.isEmpty()) {
             // No mimeType set, determine from title and first chunk
             const QMimeDatabase db;
-            const QMimeType mime = db.mimeTypeForFileNameAndData(metaData->title(), chunks.first());
+            const QMimeType mime = db.mimeTypeForFileNameAndData(metaData->title(), buffer);
             const QString contentType = mime.name();
             metaData->setMimeType(contentType);
             qCDebug(KGAPIDebug) << "Metadata mimeType was missing, determined" << contentType;
@@ -93,19 +164,19 @@ void FileAbstractResumableJob::Private::startUploadSession()
     q->enqueueRequest(request, rawData, contentType);
 }
 
-void FileAbstractResumableJob::Private::uploadChunk(bool lastChunk)
+void FileAbstractResumableJob::Private::uploadChunk(bool isLast)
 {
     QString rangeHeader;
     QByteArray partData;
-    if (chunks.isEmpty()) {
+    if (buffer.isEmpty()) {
         // We have consumed everything but must send one last request with total file size
-        qCDebug(KGAPIDebug) << "Chunks is empty, sending only final size" << uploadedSize;
+        qCDebug(KGAPIDebug) << "Buffer is empty, sending only final size" << uploadedSize;
         rangeHeader = QStringLiteral("bytes */%1").arg(uploadedSize);
     } else {
-        partData = chunks.takeFirst();
+        partData = takeChunk();
         // Build range header from saved upload size and new
         QString tempRangeHeader = QStringLiteral("bytes %1-%2/%3").arg(uploadedSize).arg(uploadedSize + partData.size() - 1);
-        if (lastChunk) {
+        if (isLast) {
             // Need to send last chunk, therefore final file size is known now
             tempRangeHeader = tempRangeHeader.arg(uploadedSize + partData.size());
         } else {
@@ -123,7 +194,54 @@ void FileAbstractResumableJob::Private::uploadChunk(bool lastChunk)
     request.setRawHeader(QByteArray("Content-Range"), rangeHeader.toUtf8());
     request.setHeader(QNetworkRequest::ContentLengthHeader, partData.length());
     q->enqueueRequest(request, partData);
+    lastChunkOffset = uploadedSize;
     uploadedSize += partData.size();
+    lastChunk = partData;
+}
+
+void FileAbstractResumableJob::Private::queryStatus()
+{
+    const QString totalSymbol = isTotalSizeKnown() ? QString::number(totalUploadSize) : QStringLiteral("*");
+    const QString rangeHeader = QStringLiteral("bytes */%1").arg(totalSymbol);
+    qCDebug(KGAPIDebug) << "Querying status of upload session with Content-Range header" << rangeHeader;
+
+    QNetworkRequest request(QUrl(sessionPath));
+    request.setRawHeader(QByteArray("Content-Range"), rangeHeader.toUtf8());
+    request.setHeader(QNetworkRequest::ContentLengthHeader, 0);
+    queryingStatus = true;
+    q->enqueueRequest(request);
+}
+
+bool FileAbstractResumableJob::Private::resumeInterrupted(const QString &reason)
+{
+    if (sessionState == ReadyStart || resumeAttempts >= MaxResumeAttempts) {
+        return false;
+    }
+
+    ++resumeAttempts;
+    qCDebug(KGAPIDebug) << "Upload interrupted:" << reason << ", resuming, attempt" << resumeAttempts;
+    queryStatus();
+    return true;
+}
+
+bool FileAbstractResumableJob::Private::rewindTo(qint64 committed)
+{
+    if (committed == uploadedSize) {
+        lastChunk.clear();
+        return true;
+    }
+
+    // Only the last chunk is available to send again
+    if (committed < lastChunkOffset || committed > uploadedSize) {
+        qCWarning(KGAPIDebug) << "Server committed" << committed << "bytes, can't resume from there, last chunk starts at" << lastChunkOffset;
+        return false;
+    }
+
+    qCDebug(KGAPIDebug) << "Server committed only" << committed << "of" << uploadedSize << "bytes, sending the rest again";
+    buffer.prepend(lastChunk.sliced(committed - lastChunkOffset));
+    lastChunk.clear();
+    uploadedSize = committed;
+    return true;
 }
 
 void FileAbstractResumableJob::Private::processNext()
@@ -135,11 +253,13 @@ void FileAbstractResumableJob::Private::processNext()
         startUploadSession();
         return;
     case Started: {
-        if (chunks.isEmpty() || chunks.first().size() < ChunkSize) {
-            qCDebug(KGAPIDebug) << "Chunks empty or not big enough to process, asking for more";
+        if (buffer.size() < chunkSize) {
+            qCDebug(KGAPIDebug) << "Buffer not big enough to upload a chunk, asking for more";
 
             if (device) {
-                readFromDevice();
+                if (!readFromDevice()) {
+                    return;
+                }
             } else {
                 // Warning: an endless loop could be started here if the signal receiver isn't using
                 // a direct connection.
@@ -152,6 +272,11 @@ void FileAbstractResumableJob::Private::processNext()
         return;
     }
     case ClientEnough: {
+        // The client could have written more than a chunk before finishing
+        if (buffer.size() > chunkSize) {
+            uploadChunk(false);
+            return;
+        }
         uploadChunk(true);
         sessionState = Completed;
         return;
@@ -163,16 +288,48 @@ void FileAbstractResumableJob::Private::processNext()
     }
 }
 
-void KGAPI2::Drive::FileAbstractResumableJob::Private::readFromDevice()
+bool FileAbstractResumableJob::Private::readFromDevice()
 {
-    char buf[ChunkSize];
-    int read = device->read(buf, ChunkSize);
-    if (read == -1) {
-        qCWarning(KGAPIDebug) << "Failed reading from device" << device->errorString();
-        return;
+    // Read straight into the buffer that will be sent as the request body
+    const qint64 buffered = buffer.size();
+    if (buffered >= chunkSize) {
+        return true;
+    }
+    buffer.resize(chunkSize);
+    qint64 filled = buffered;
+    while (filled < chunkSize) {
+        const qint64 read = device->read(buffer.data() + filled, chunkSize - filled);
+        if (read == -1) {
+            buffer.truncate(buffered);
+            qCWarning(KGAPIDebug) << "Failed reading from device" << device->errorString();
+            q->setError(KGAPI2::UnknownError);
+            q->setErrorString(tr("Failed reading from device: %1").arg(device->errorString()));
+            q->emitFinished();
+            return false;
+        }
+        if (read == 0) {
+            break;
+        }
+        filled += read;
+    }
+    buffer.truncate(filled);
+
+    qCDebug(KGAPIDebug) << "Read from device bytes" << filled - buffered;
+    if (filled == buffered) {
+        q->write(QByteArray());
     }
-    qCDebug(KGAPIDebug) << "Read from device bytes" << read;
-    q->write(QByteArray(buf, read));
+    return true;
+}
+
+QByteArray FileAbstractResumableJob::Private::takeChunk()
+{
+    if (buffer.size() <= chunkSize) {
+        return std::exchange(buffer, QByteArray());
+    }
+
+    QByteArray chunk = buffer.first(chunkSize);
+    buffer.remove(0, chunkSize);
+    return chunk;
 }
 
 bool FileAbstractResumableJob::Private::isTotalSizeKnown() const
@@ -182,6 +339,11 @@ bool FileAbstractResumableJob::Private::isTotalSizeKnown() const
 
 void FileAbstractResumableJob::Private::_k_uploadProgress(qint64 bytesSent, qint64 totalBytes)
 {
+    q->updateTransfer(bytesSent);
+    if (!isTotalSizeKnown()) {
+        return;
+    }
+
     // uploadedSize corresponds to total bytes enqueued (including current chunk upload)
     qint64 totalUploaded = uploadedSize - totalBytes + bytesSent;
     q->emitProgress(totalUploaded, totalUploadSize);
@@ -222,7 +384,7 @@ FilePtr FileAbstractResumableJob::metadata() const
     return d->metaData;
 }
 
-void FileAbstractResumableJob::setUploadSize(int size)
+void FileAbstractResumableJob::setUploadSize(qint64 size)
 {
     if (isRunning()) {
         qCWarning(KGAPIDebug) << "Can't set upload size when the job is already running";
@@ -232,47 +394,88 @@ void FileAbstractResumableJob::setUploadSize(int size)
     d->totalUploadSize = size;
 }
 
+void FileAbstractResumableJob::setChunkSize(qint64 size)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify chunkSize property when job is running";
+        return;
+    }
+
+    d->chunkSize = qMax(size - size % ChunkGranularity, ChunkGranularity);
+}
+
+qint64 FileAbstractResumableJob::chunkSize() const
+{
+    return d->chunkSize;
+}
+
+FileAbstractResumableJob::UploadState FileAbstractResumableJob::uploadState() const
+{
+    UploadState state;
+    state.sessionUrl = QUrl(d->sessionPath);
+    state.totalSize = d->totalUploadSize;
+    state.offset = d->committedSize;
+    return state;
+}
+
+void FileAbstractResumableJob::setUploadState(const UploadState &state)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify uploadState property when job is running";
+        return;
+    }
+
+    d->resumeState = state;
+    if (state.totalSize > 0) {
+        d->totalUploadSize = state.totalSize;
+    }
+}
+
 void FileAbstractResumableJob::write(const QByteArray &data)
 {
     qCDebug(KGAPIDebug) << "Received" << data.size() << "bytes to upload";
 
     if (data.isEmpty()) {
         qCDebug(KGAPIDebug) << "Data empty, won't receive any more data from client";
-        d->sessionState = Private::ClientEnough;
+        d->dataComplete = true;
+        if (d->sessionState == Private::Started) {
+            d->sessionState = Private::ClientEnough;
+        }
         return;
     }
 
-    int pos = 0;
-    // Might need to add to last chunk
-    if (!d->chunks.isEmpty() && d->chunks.last().size() < ChunkSize) {
-        QByteArray lastChunk = d->chunks.takeLast();
-        int missing = ChunkSize - lastChunk.size();
-        qCDebug(KGAPIDebug) << "Previous last chunk was" << lastChunk.size() << "bytes and could use" << missing << "bytes more, adding to it";
-        lastChunk.append(data.mid(0, missing));
-        pos = missing;
-        d->chunks << lastChunk;
-    }
-
-    int dataSize = data.size();
-    QList<QByteArray> chunks;
-    while (pos < dataSize) {
-        QByteArray chunk = data.mid(pos, ChunkSize);
-        chunks << chunk;
-        pos += chunk.size();
+    if (d->buffer.isEmpty()) {
+        // Share the data instead of copying them
+        d->buffer = data;
+    } else {
+        d->buffer.append(data);
     }
-
-    qCDebug(KGAPIDebug) << "Added" << chunks.size() << "new chunks";
-    d->chunks << chunks;
+    qCDebug(KGAPIDebug) << "Buffered" << d->buffer.size() << "bytes";
 }
 
 void FileAbstractResumableJob::start()
 {
     if (d->device) {
-        d->readFromDevice();
+        d->deviceOrigin = d->device->pos();
+    }
+
+    if (d->resumeState.isValid()) {
+        qCDebug(KGAPIDebug) << "Resuming upload session" << d->resumeState.sessionUrl;
+        d->sessionPath = d->resumeState.sessionUrl.toString();
+        d->sessionState = Private::Started;
+        d->resuming = true;
+        d->queryStatus();
+        return;
+    }
+
+    if (d->device) {
+        if (!d->readFromDevice()) {
+            return;
+        }
     }
     // Ask for more chunks right away in case
     // write() wasn't called before starting
-    if (d->chunks.isEmpty()) {
+    if (d->buffer.isEmpty()) {
         emitReadyWrite();
     }
     d->processNext();
@@ -286,27 +489,30 @@ void FileAbstractResumableJob::dispatchRequest(QNetworkAccessManager *accessMana
     Q_UNUSED(contentType)
 
     QNetworkReply *reply;
+    BandwidthLimiter *limiter = bandwidthLimiter();
     if (d->sessionState == Private::ReadyStart) {
         reply = accessManager->post(request, data);
+    } else if (!data.isEmpty() && limiter->isLimited(BandwidthLimiter::Upload)) {
+        auto device = new ThrottledDevice(limiter, BandwidthLimiter::Upload);
+        device->append(data);
+        device->open(QIODevice::ReadOnly);
+        reply = accessManager->put(request, device);
+        device->setParent(reply);
     } else {
         reply = accessManager->put(request, data);
     }
 
-    if (d->isTotalSizeKnown()) {
-        connect(reply, &QNetworkReply::uploadProgress, this, [this](qint64 bytesSent, qint64 totalBytes) {
-            d->_k_uploadProgress(bytesSent, totalBytes);
-        });
-    }
+    startTransfer();
+    connect(reply, &QNetworkReply::uploadProgress, this, [this](qint64 bytesSent, qint64 totalBytes) {
+        d->_k_uploadProgress(bytesSent, totalBytes);
+    });
 }
 
 void FileAbstractResumableJob::handleReply(const QNetworkReply *reply, const QByteArray &rawData)
 {
-    Q_UNUSED(rawData)
-
     int replyCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
 
-    switch (d->sessionState) {
-    case Private::ReadyStart: {
+    if (d->sessionState == Private::ReadyStart) {
         if (replyCode != KGAPI2::OK) {
             qCWarning(KGAPIDebug) << "Failed opening upload session" << replyCode;
             setError(KGAPI2::UnknownError);
@@ -318,63 +524,111 @@ void FileAbstractResumableJob::handleReply(const QNetworkReply *reply, const QBy
         const QString uploadLocation = reply->header(QNetworkRequest::LocationHeader).toString();
         qCDebug(KGAPIDebug) << "Got upload session location" << uploadLocation;
         d->sessionPath = uploadLocation;
-        d->sessionState = Private::Started;
-        break;
-    }
-    case Private::Started: {
-        // If during upload total size is declared via Content-Range header, Google will
-        // respond with 200 on the last chunk upload. The job is complete in that case.
-        if (d->isTotalSizeKnown() && replyCode == KGAPI2::OK) {
-            d->sessionState = Private::Completed;
-            const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
-            ContentType ct = Utils::stringToContentType(contentType);
-            if (ct == KGAPI2::JSON) {
-                d->metaData = File::fromJSON(rawData);
-            }
-            return;
-        }
+        d->sessionState = d->dataComplete ? Private::ClientEnough : Private::Started;
+        Q_EMIT uploadStateChanged(this);
+        d->processNext();
+        return;
+    }
 
-        // Google will continue answering ResumeIncomplete until the total upload size is declared
-        // in the Content-Range header or until last upload range not total upload size.
-        if (replyCode != KGAPI2::ResumeIncomplete) {
-            qCWarning(KGAPIDebug) << "Failed uploading chunk" << replyCode;
-            setError(KGAPI2::UnknownError);
-            setErrorString(tr("Failed uploading chunk"));
-            emitFinished();
+    const bool statusQuery = std::exchange(d->queryingStatus, false);
+
+    // Network failures have no status code, ask the server what it has received
+    if (replyCode == 0 && reply->error() != QNetworkReply::NoError) {
+        if (d->resumeInterrupted(reply->errorString())) {
             return;
         }
+        qCWarning(KGAPIDebug) << "Failed uploading chunk:" << reply->errorString();
+        setError(KGAPI2::NetworkError);
+        setErrorString(tr("Failed uploading chunk: %1").arg(reply->errorString()));
+        emitFinished();
+        return;
+    }
 
-        // Server could send us a new upload session location any time, use it if present
-        const QString newUploadLocation = reply->header(QNetworkRequest::LocationHeader).toString();
-        if (!newUploadLocation.isEmpty()) {
-            qCDebug(KGAPIDebug) << "Got new location" << newUploadLocation;
-            d->sessionPath = newUploadLocation;
+    // Google responds with 200 or 201 once the total upload size has been declared
+    // in the Content-Range header and all the data have been received.
+    if (replyCode == KGAPI2::OK || replyCode == KGAPI2::Created) {
+        d->sessionState = Private::Completed;
+        d->buffer.clear();
+        d->lastChunk.clear();
+        d->committedSize = d->uploadedSize;
+        const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+        ContentType ct = Utils::stringToContentType(contentType);
+        if (ct == KGAPI2::JSON) {
+            d->metaData = File::fromJSON(rawData);
         }
+        d->processNext();
+        return;
+    }
 
-        const QString readRange = QString::fromUtf8(reply->rawHeader(QStringLiteral("Range").toUtf8()));
-        qCDebug(KGAPIDebug) << "Server confirms range" << readRange;
-        break;
+    // Google will continue answering ResumeIncomplete until the total upload size is declared
+    // in the Content-Range header or until last upload range not total upload size.
+    if (replyCode != KGAPI2::ResumeIncomplete) {
+        qCWarning(KGAPIDebug) << "Failed uploading chunk" << replyCode;
+        setError(KGAPI2::UnknownError);
+        setErrorString(tr("Failed uploading chunk"));
+        emitFinished();
+        return;
     }
-    case Private::ClientEnough:
-    case Private::Completed:
-        if (replyCode != KGAPI2::OK) {
-            qCWarning(KGAPIDebug) << "Failed completing upload session" << replyCode;
+
+    // Server could send us a new upload session location any time, use it if present
+    const QString newUploadLocation = reply->header(QNetworkRequest::LocationHeader).toString();
+    if (!newUploadLocation.isEmpty()) {
+        qCDebug(KGAPIDebug) << "Got new location" << newUploadLocation;
+        d->sessionPath = newUploadLocation;
+    }
+
+    const qint64 committed = committedFromRange(reply);
+    qCDebug(KGAPIDebug) << "Server confirms range" << reply->rawHeader("Range");
+
+    if (d->resuming) {
+        d->resuming = false;
+        if (d->device && committed > 0 && (d->device->isSequential() || !d->device->seek(d->deviceOrigin + committed))) {
+            qCWarning(KGAPIDebug) << "Failed seeking device to" << committed;
             setError(KGAPI2::UnknownError);
-            setErrorString(tr("Failed completing upload session"));
+            setErrorString(tr("Failed seeking device to resume the upload"));
             emitFinished();
             return;
         }
-        const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
-        ContentType ct = Utils::stringToContentType(contentType);
-        if (ct == KGAPI2::JSON) {
-            d->metaData = File::fromJSON(rawData);
-        }
-        break;
+        d->uploadedSize = committed;
+        d->lastChunkOffset = committed;
+    } else if (d->sessionState == Private::Completed && !statusQuery && committed == d->uploadedSize) {
+        qCWarning(KGAPIDebug) << "Failed completing upload session" << replyCode;
+        setError(KGAPI2::UnknownError);
+        setErrorString(tr("Failed completing upload session"));
+        emitFinished();
+        return;
+    } else if (!d->rewindTo(committed)) {
+        setError(KGAPI2::UnknownError);
+        setErrorString(tr("Failed resuming upload, the server has lost committed data"));
+        emitFinished();
+        return;
+    }
+
+    if (committed > d->committedSize) {
+        d->resumeAttempts = 0;
+        d->committedSize = committed;
+        Q_EMIT uploadStateChanged(this);
+    }
+
+    if (d->sessionState == Private::Completed) {
+        // The last chunk has not been committed completely
+        d->sessionState = Private::ClientEnough;
     }
 
     d->processNext();
 }
 
+bool FileAbstractResumableJob::handleError(int statusCode, const QByteArray &rawData)
+{
+    if (statusCode >= 500 && statusCode < 600) {
+        if (d->resumeInterrupted(QStringLiteral("status %1").arg(statusCode))) {
+            return true;
+        }
+    }
+
+    return FileAbstractDataJob::handleError(statusCode, rawData);
+}
+
 void FileAbstractResumableJob::emitReadyWrite()
 {
     Q_EMIT readyWrite(this);
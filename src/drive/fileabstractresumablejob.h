@@ -32,6 +32,12 @@ namespace Drive
  * Writing 0 bytes will indicate that the File has been completely transferred
  * and the Job will close the upload session.
  *
+ * An upload interrupted by a server error or a network failure is resumed
+ * automatically from the last byte the server has committed. The state of the
+ * upload session can also be persisted with uploadState() whenever the
+ * uploadStateChanged() signal is emitted, and passed to setUploadState() of
+ * a new job to resume the upload after the application has been restarted.
+ *
  * @see <a href="https://developers.google.com/drive/api/v2/manage-uploads#resumable">Perform a resumable upload</a>
  * @see readyWrite, write
  *
@@ -43,6 +49,37 @@ class KGAPIDRIVE_EXPORT FileAbstractResumableJob : public KGAPI2::Drive::FileAbs
     Q_OBJECT
 
 public:
+    /**
+     * @brief State of an upload session needed to resume the upload
+     *
+     * @since 6.4
+     */
+    struct KGAPIDRIVE_EXPORT UploadState {
+        /**
+         * @brief Returns whether the state refers to an upload session
+         */
+        [[nodiscard]] bool isValid() const;
+
+        /**
+         * @brief Serializes the state to JSON
+         */
+        [[nodiscard]] QByteArray toJSON() const;
+
+        /**
+         * @brief Parses a state serialized with toJSON()
+         *
+         * Returns an invalid state when @p jsonData can't be parsed.
+         */
+        [[nodiscard]] static UploadState fromJSON(const QByteArray &jsonData);
+
+        /// URL of the upload session
+        QUrl sessionUrl;
+        /// Total size of the upload, 0 when unknown
+        qint64 totalSize = 0;
+        /// Number of bytes committed by the server
+        qint64 offset = 0;
+    };
+
     /**
      * @brief Constructs a job that will upload an Untitled file in the
      * users root folder.
@@ -97,13 +134,70 @@ public:
      * @brief Sets the total upload size and is required for progress reporting
      * via the Job::progress() signal.
      */
-    void setUploadSize(int size);
+    void setUploadSize(qint64 size);
+
+    /**
+     * @brief Sets the size of chunks uploaded in a single request
+     *
+     * Every chunk costs a full round trip to the server, so large uploads
+     * benefit from chunks of several megabytes (Google recommends at least
+     * 8 MiB). On the other hand a whole chunk is held in memory and has to
+     * be sent again when its upload fails. The size is rounded down to a
+     * multiple of 256 KiB as required by the API, the default is 256 KiB.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @param size Chunk size in bytes
+     *
+     * @since 6.4
+     */
+    void setChunkSize(qint64 size);
+
+    /**
+     * @brief Returns the size of chunks uploaded in a single request
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] qint64 chunkSize() const;
+
+    /**
+     * @brief Returns state of the upload session
+     *
+     * The state is invalid until the upload session has been opened.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] UploadState uploadState() const;
+
+    /**
+     * @brief Resumes an upload session instead of opening a new one
+     *
+     * The job asks the server how much data it has committed and continues
+     * from there. When uploading from a device, the device must be positioned
+     * where the original upload started and must not be sequential, the job
+     * skips the committed data. Otherwise the readyWrite() signal is emitted
+     * once uploadState() holds the committed offset, and the data must be
+     * written starting at that offset.
+     *
+     * Upload sessions expire after about a week, the job fails with
+     * KGAPI2::NotFound or KGAPI2::Gone error when the session no longer
+     * exists.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @param state State obtained from uploadState() of the interrupted job
+     *
+     * @since 6.4
+     */
+    void setUploadState(const UploadState &state);
 
     /**
      * @brief This function writes all the bytes in \p data to the upload session.
      *
-     * The write operation splits written data in chunks that will be
-     * subsequently uploaded in the session.
+     * The written data are buffered until there is enough of them to upload
+     * a whole chunk, the readyWrite() signal is not emitted again before the
+     * buffered data have been uploaded. To keep the memory usage bounded,
+     * avoid writing much more than chunkSize() bytes at once.
      *
      * Writing an empty \p data will signal the Job that it can complete as no
      * more data will be written.
@@ -130,6 +224,16 @@ protected:
      */
     void handleReply(const QNetworkReply *reply, const QByteArray &rawData) override;
 
+    /**
+     * @brief KGAPI2::Job::handleError implementation
+     *
+     * Resumes the upload after a server error or a network failure.
+     *
+     * @param statusCode
+     * @param rawData
+     */
+    bool handleError(int statusCode, const QByteArray &rawData) override;
+
     /**
      * @brief KGAPI2::Job::dispatchRequest implementation
      *
@@ -169,6 +273,19 @@ Q_SIGNALS:
      */
     void readyWrite(KGAPI2::Drive::FileAbstractResumableJob *job);
 
+    /**
+     * @brief Emitted when the upload session has been opened and whenever the
+     * server has committed more data
+     *
+     * Persist uploadState() in a handler of this signal to be able to resume
+     * the upload later.
+     *
+     * @param job The job whose upload state has changed
+     *
+     * @since 6.4
+     */
+    void uploadStateChanged(KGAPI2::Drive::FileAbstractResumableJob *job);
+
 private:
     class Private;
     QScopedPointer<Private> d;
@@ -7,39 +7,95 @@
  */
 
 #include "fileabstractuploadjob.h"
+#include "bandwidthlimiter.h"
+#include "bandwidthlimiter_p.h"
 #include "debug.h"
+#include "driveservice.h"
+#include "filechecksumcache.h"
 #include "utils.h"
 
+#include <QHttpMultiPart>
+#include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QNetworkRequest>
 
-#include <QCryptographicHash>
 #include <QFile>
 #include <QFileInfo>
 #include <QMimeDatabase>
 #include <QMimeType>
+#include <QRandomGenerator>
+#include <QThreadPool>
 #include <QUrlQuery>
 
 using namespace KGAPI2;
 using namespace KGAPI2::Drive;
 
+namespace
+{
+// The content is streamed and can't be searched for the boundary, a random
+// boundary makes a collision with it practically impossible
+QByteArray randomBoundary(const QByteArray &metaData)
+{
+    QByteArray boundary;
+    do {
+        quint32 random[6];
+        QRandomGenerator::global()->fillRange(random);
+        boundary = "kgapi_" + QByteArray(reinterpret_cast<const char *>(random), sizeof(random)).toHex();
+    } while (metaData.contains(boundary));
+    return boundary;
+}
+}
+
 class Q_DECL_HIDDEN FileAbstractUploadJob::Private
 {
 public:
     Private(FileAbstractUploadJob *parent);
     void processNext();
-    QByteArray buildMultipart(const QString &filePath, const FilePtr &metaData, QString &boundary);
-    QByteArray readFile(const QString &filePath, QString &contentType);
+    void checksumComputed(const QString &filePath, const FilePtr &metaData, const QString &fileId, const QString &checksum);
+    void upload(const QString &filePath, const FilePtr &metaData, bool contentUnchanged);
+    void queryChecksum(const QString &filePath, const FilePtr &metaData, const QString &fileId);
+    QHttpMultiPart *buildMultipart(QFile *file, const FilePtr &metaData, const QByteArray &boundary, const QString &contentType);
+    ThrottledDevice *buildThrottledMultipart(QFile *file, const FilePtr &metaData, const QByteArray &boundary, const QString &contentType);
+    bool checkFile(const QString &filePath, QString &contentType);
 
     void _k_uploadProgress(qint64 bytesSent, qint64 totalBytes);
 
     int originalFilesCount = 0;
     QMap<QString, FilePtr> files;
 
+    enum class Mode {
+        Metadata,
+        Media,
+        Multipart,
+        // Fetching checksum of the remote file
+        Checksum,
+    };
+
+    // The file being uploaded, its content is streamed from the file
+    // whenever the request is dispatched
+    Mode currentMode = Mode::Metadata;
+    QString currentFilePath;
+    FilePtr currentMetaData;
+    QByteArray currentBoundary;
+    QString currentContentType;
+    QString currentChecksum;
+
+    bool skipUnchangedContent = false;
+    FileChecksumCache *checksumCache = nullptr;
+    QStringList unchangedFiles;
+
     QMap<QString, FilePtr> uploadedFiles;
 
     File::SerializationOptions serializationOptions = File::NoOptions;
 
+    // The job runs out of requests while the checksum of the next file is
+    // computed
+    bool checksumPending = false;
+
+    // Destroyed with the job, waits for the running tasks, whose results
+    // are delivered through the event loop of the job
+    QThreadPool threadPool;
+
 private:
     FileAbstractUploadJob *const q;
 };
@@ -49,61 +105,55 @@ FileAbstractUploadJob::Private::Private(FileAbstractUploadJob *parent)
 {
 }
 
-QByteArray FileAbstractUploadJob::Private::readFile(const QString &filePath, QString &contentType)
+bool FileAbstractUploadJob::Private::checkFile(const QString &filePath, QString &contentType)
 {
     QFile file(filePath);
-    if (!file.open(QIODevice::ReadOnly)) {
+    if (!file.open(QIODevice::ReadOnly) || file.size() == 0) {
         qCWarning(KGAPIDebug) << "Failed to access" << filePath;
-        return QByteArray();
+        return false;
     }
 
     if (contentType.isEmpty()) {
+        // Only reads the head of the file
         const QMimeDatabase db;
         const QMimeType mime = db.mimeTypeForFileNameAndData(filePath, &file);
         contentType = mime.name();
         qCDebug(KGAPIDebug) << "Determined content type" << contentType << "for" << filePath;
     }
 
-    file.reset();
-    QByteArray output = file.readAll();
-
-    file.close();
-
-    return output;
+    return true;
 }
 
-QByteArray FileAbstractUploadJob::Private::buildMultipart(const QString &filePath, const FilePtr &metaData, QString &boundary)
+QHttpMultiPart *FileAbstractUploadJob::Private::buildMultipart(QFile *file, const FilePtr &metaData, const QByteArray &boundary, const QString &contentType)
 {
-    QString fileContentType = metaData->mimeType();
-    QByteArray fileContent;
-
-    fileContent = readFile(filePath, fileContentType);
-    if (fileContent.isEmpty()) {
-        return QByteArray();
-    }
-
-    qCDebug(KGAPIDebug) << "Setting content type" << fileContentType << "for" << filePath;
-
-    // Wannabe implementation of RFC2387, i.e. multipart/related
-    QByteArray body;
-    QFileInfo finfo(filePath);
-    const QByteArray md5 = QCryptographicHash::hash(finfo.fileName().toLatin1(), QCryptographicHash::Md5);
-    boundary = QString::fromLatin1(md5.toHex());
-
-    body += "--" + boundary.toLatin1() + '\n';
-    body += "Content-Type: application/json; charset=UTF-8\n";
-    body += '\n';
-    body += File::toJSON(metaData, q->serializationOptions());
-    body += '\n';
-    body += '\n';
-    body += "--" + boundary.toLatin1() + '\n';
-    body += "Content-Type: " + fileContentType.toLatin1() + '\n';
-    body += '\n';
-    body += fileContent;
-    body += '\n';
-    body += "--" + boundary.toLatin1() + "--";
+    // RFC2387, i.e. multipart/related
+    auto multiPart = new QHttpMultiPart(QHttpMultiPart::RelatedType);
+    multiPart->setBoundary(boundary);
+
+    QHttpPart metaDataPart;
+    metaDataPart.setHeader(QNetworkRequest::ContentTypeHeader, QStringLiteral("application/json; charset=UTF-8"));
+    metaDataPart.setBody(File::toJSON(metaData, q->serializationOptions()));
+    multiPart->append(metaDataPart);
+
+    QHttpPart contentPart;
+    contentPart.setHeader(QNetworkRequest::ContentTypeHeader, contentType);
+    contentPart.setBodyDevice(file);
+    file->setParent(multiPart);
+    multiPart->append(contentPart);
+
+    return multiPart;
+}
 
-    return body;
+ThrottledDevice *FileAbstractUploadJob::Private::buildThrottledMultipart(QFile *file, const FilePtr &metaData, const QByteArray &boundary, const QString &contentType)
+{
+    // Same as buildMultipart(), but QHttpMultiPart can't wait for the limiter
+    auto device = new ThrottledDevice(q->bandwidthLimiter(), BandwidthLimiter::Upload);
+    device->append("--" + boundary + "\r\nContent-Type: application/json; charset=UTF-8\r\n\r\n" + File::toJSON(metaData, q->serializationOptions()) + "\r\n--"
+                   + boundary + "\r\nContent-Type: " + contentType.toUtf8() + "\r\n\r\n");
+    device->append(file);
+    device->append("\r\n--" + boundary + "--\r\n");
+    device->open(QIODevice::ReadOnly);
+    return device;
 }
 
 void FileAbstractUploadJob::Private::processNext()
@@ -122,8 +172,78 @@ void FileAbstractUploadJob::Private::processNext()
 
     const FilePtr metaData = files.take(filePath);
 
+    if (skipUnchangedContent && !filePath.startsWith(QLatin1StringView("?="))) {
+        const QString fileId = q->existingFileId(filePath, metaData);
+        if (!fileId.isEmpty()) {
+            // Reading the whole file would block the event loop, the cache
+            // can be used from any thread
+            checksumPending = true;
+            threadPool.start([this, job = q, filePath, metaData, fileId, cache = checksumCache]() {
+                const QString checksum = cache ? cache->checksum(filePath) : FileChecksumCache::computeChecksum(filePath);
+                QMetaObject::invokeMethod(
+                    job,
+                    [this, filePath, metaData, fileId, checksum]() {
+                        checksumComputed(filePath, metaData, fileId, checksum);
+                    },
+                    Qt::QueuedConnection);
+            });
+            return;
+        }
+    }
+
+    upload(filePath, metaData, false);
+}
+
+void FileAbstractUploadJob::Private::checksumComputed(const QString &filePath, const FilePtr &metaData, const QString &fileId, const QString &checksum)
+{
+    checksumPending = false;
+    if (!q->isRunning()) {
+        return;
+    }
+
+    currentChecksum = checksum;
+    if (currentChecksum.isEmpty()) {
+        qCWarning(KGAPIDebug) << "Failed to compute checksum of" << filePath;
+        processNext();
+        return;
+    }
+
+    if (metaData && !metaData->md5Checksum().isEmpty()) {
+        upload(filePath, metaData, metaData->md5Checksum() == currentChecksum);
+    } else {
+        queryChecksum(filePath, metaData, fileId);
+    }
+}
+
+void FileAbstractUploadJob::Private::queryChecksum(const QString &filePath, const FilePtr &metaData, const QString &fileId)
+{
+    currentMode = Mode::Checksum;
+    currentFilePath = filePath;
+    currentMetaData = metaData;
+
+    QUrl url = DriveService::fetchFileUrl(fileId);
+    QUrlQuery query(url);
+    query.addQueryItem(QStringLiteral("supportsAllDrives"), Utils::bool2Str(q->supportsAllDrives()));
+    // Custom fields of the job are appended to every request
+    if (q->fields().isEmpty()) {
+        query.addQueryItem(Job::StandardParams::Fields, QStringList{File::Fields::Kind, File::Fields::Id, File::Fields::Md5Checksum}.join(QLatin1Char(',')));
+    }
+    url.setQuery(query);
+
+    QNetworkRequest request(url);
+    request.setAttribute(QNetworkRequest::User, filePath);
+    q->enqueueRequest(request);
+}
+
+void FileAbstractUploadJob::Private::upload(const QString &filePath, const FilePtr &metaData, bool contentUnchanged)
+{
+    if (contentUnchanged) {
+        qCDebug(KGAPIDebug) << "Content of" << filePath << "is unchanged, skipping upload";
+        unchangedFiles << filePath;
+    }
+
     QUrl url;
-    if (filePath.startsWith(QLatin1StringView("?="))) {
+    if (contentUnchanged || filePath.startsWith(QLatin1StringView("?="))) {
         url = q->createUrl(QString(), metaData);
     } else {
         url = q->createUrl(filePath, metaData);
@@ -134,38 +254,50 @@ void FileAbstractUploadJob::Private::processNext()
 
     QByteArray rawData;
     QString contentType;
+    qint64 contentLength = -1;
+
+    currentMetaData = metaData;
+    currentBoundary.clear();
+    currentContentType.clear();
 
     // just to be sure
     query.removeQueryItem(QStringLiteral("uploadType"));
     if (metaData.isNull()) {
+        currentMode = Mode::Media;
         query.addQueryItem(QStringLiteral("uploadType"), QStringLiteral("media"));
 
-        rawData = readFile(filePath, contentType);
-        if (rawData.isEmpty()) {
+        if (!checkFile(filePath, contentType)) {
             processNext();
             return;
         }
-
-    } else if (!filePath.startsWith(QLatin1StringView("?="))) {
+        currentContentType = contentType;
+        contentLength = QFileInfo(filePath).size();
+    } else if (!contentUnchanged && !filePath.startsWith(QLatin1StringView("?="))) {
+        currentMode = Mode::Multipart;
         query.addQueryItem(QStringLiteral("uploadType"), QStringLiteral("multipart"));
 
-        QString boundary;
-        rawData = buildMultipart(filePath, metaData, boundary);
-
-        contentType = QStringLiteral("multipart/related; boundary=%1").arg(boundary);
-        if (rawData.isEmpty()) {
+        currentContentType = metaData->mimeType();
+        if (!checkFile(filePath, currentContentType)) {
             processNext();
             return;
         }
+        qCDebug(KGAPIDebug) << "Setting content type" << currentContentType << "for" << filePath;
+
+        currentBoundary = randomBoundary(File::toJSON(metaData, q->serializationOptions()));
+        contentType = QStringLiteral("multipart/related; boundary=%1").arg(QString::fromLatin1(currentBoundary));
     } else {
+        currentMode = Mode::Metadata;
         rawData = File::toJSON(metaData, q->serializationOptions());
         contentType = QStringLiteral("application/json");
+        contentLength = rawData.length();
     }
 
     url.setQuery(query);
 
     QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentLengthHeader, rawData.length());
+    if (contentLength >= 0) {
+        request.setHeader(QNetworkRequest::ContentLengthHeader, contentLength);
+    }
     request.setHeader(QNetworkRequest::ContentTypeHeader, contentType);
     request.setAttribute(QNetworkRequest::User, filePath);
 
@@ -180,6 +312,7 @@ void FileAbstractUploadJob::Private::_k_uploadProgress(qint64 bytesSent, qint64
     int processedParts = (originalFilesCount - files.count() - 1) * 100;
     int currentFileParts = 100.0 * ((qreal)bytesSent / (qreal)totalBytes);
 
+    q->updateTransfer(bytesSent);
     q->emitProgress(processedParts + currentFileParts, originalFilesCount * 100);
 }
 
@@ -244,14 +377,77 @@ FileAbstractUploadJob::~FileAbstractUploadJob()
 
 void FileAbstractUploadJob::start()
 {
+    d->unchangedFiles.clear();
     d->processNext();
 }
 
+void FileAbstractUploadJob::emitFinished()
+{
+    if (d->checksumPending) {
+        return;
+    }
+
+    FileAbstractDataJob::emitFinished();
+}
+
+QNetworkReply *FileAbstractUploadJob::dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, QIODevice *data)
+{
+    return accessManager->post(request, data);
+}
+
+QNetworkReply *FileAbstractUploadJob::dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, QHttpMultiPart *multiPart)
+{
+    return accessManager->post(request, multiPart);
+}
+
 QMap<QString, FilePtr> FileAbstractUploadJob::files() const
 {
     return d->uploadedFiles;
 }
 
+void FileAbstractUploadJob::setSkipUnchangedContent(bool skip)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify skipUnchangedContent property when job is running";
+        return;
+    }
+
+    d->skipUnchangedContent = skip;
+}
+
+bool FileAbstractUploadJob::skipUnchangedContent() const
+{
+    return d->skipUnchangedContent;
+}
+
+void FileAbstractUploadJob::setChecksumCache(FileChecksumCache *cache)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify checksumCache property when job is running";
+        return;
+    }
+
+    d->checksumCache = cache;
+}
+
+FileChecksumCache *FileAbstractUploadJob::checksumCache() const
+{
+    return d->checksumCache;
+}
+
+QStringList FileAbstractUploadJob::unchangedFiles() const
+{
+    return d->unchangedFiles;
+}
+
+QString FileAbstractUploadJob::existingFileId(const QString &filePath, const FilePtr &metaData) const
+{
+    Q_UNUSED(filePath)
+    Q_UNUSED(metaData)
+
+    return QString();
+}
+
 void FileAbstractUploadJob::dispatchRequest(QNetworkAccessManager *accessManager,
                                             const QNetworkRequest &request,
                                             const QByteArray &data,
@@ -259,8 +455,49 @@ void FileAbstractUploadJob::dispatchRequest(QNetworkAccessManager *accessManager
 {
     Q_UNUSED(contentType)
 
-    QNetworkReply *reply = dispatch(accessManager, request, data);
+    QNetworkReply *reply = nullptr;
+    const QString filePath = request.attribute(QNetworkRequest::User).toString();
+    if (d->currentMode == Private::Mode::Checksum) {
+        accessManager->get(request);
+        return;
+    } else if (d->currentMode == Private::Mode::Metadata) {
+        reply = dispatch(accessManager, request, data);
+    } else {
+        // Open the file again for every dispatch, the request could be retried
+        auto file = new QFile(filePath);
+        if (!file->open(QIODevice::ReadOnly)) {
+            qCWarning(KGAPIDebug) << "Failed to open" << filePath << ":" << file->errorString();
+            setError(KGAPI2::UnknownError);
+            setErrorString(tr("Failed to open %1: %2").arg(filePath, file->errorString()));
+            delete file;
+            emitFinished();
+            return;
+        }
+
+        if (bandwidthLimiter()->isLimited(BandwidthLimiter::Upload)) {
+            QNetworkRequest throttledRequest(request);
+            ThrottledDevice *device;
+            if (d->currentMode == Private::Mode::Media) {
+                device = new ThrottledDevice(bandwidthLimiter(), BandwidthLimiter::Upload);
+                device->append(file);
+                device->open(QIODevice::ReadOnly);
+            } else {
+                device = d->buildThrottledMultipart(file, d->currentMetaData, d->currentBoundary, d->currentContentType);
+            }
+            throttledRequest.setHeader(QNetworkRequest::ContentLengthHeader, device->size());
+            reply = dispatch(accessManager, throttledRequest, device);
+            device->setParent(reply);
+        } else if (d->currentMode == Private::Mode::Media) {
+            reply = dispatch(accessManager, request, file);
+            file->setParent(reply);
+        } else {
+            QHttpMultiPart *multiPart = d->buildMultipart(file, d->currentMetaData, d->currentBoundary, d->currentContentType);
+            reply = dispatch(accessManager, request, multiPart);
+            multiPart->setParent(reply);
+        }
+    }
 
+    startTransfer();
     connect(reply, &QNetworkReply::uploadProgress, this, [this](qint64 bytesSent, qint64 totalBytes) {
         d->_k_uploadProgress(bytesSent, totalBytes);
     });
@@ -276,6 +513,27 @@ void FileAbstractUploadJob::handleReply(const QNetworkReply *reply, const QByteA
 
         FilePtr file = File::fromJSON(rawData);
 
+        if (d->currentMode == Private::Mode::Checksum) {
+            if (!file) {
+                setError(KGAPI2::InvalidResponse);
+                setErrorString(tr("Invalid response content"));
+                emitFinished();
+                return;
+            }
+
+            const bool unchanged = file->md5Checksum() == d->currentChecksum;
+            if (unchanged && d->currentMetaData.isNull()) {
+                // Nothing to update
+                qCDebug(KGAPIDebug) << "Content of" << d->currentFilePath << "is unchanged, skipping upload";
+                d->unchangedFiles << d->currentFilePath;
+                d->uploadedFiles.insert(d->currentFilePath, file);
+                d->processNext();
+            } else {
+                d->upload(d->currentFilePath, d->currentMetaData, unchanged);
+            }
+            return;
+        }
+
         d->uploadedFiles.insert(filePath, file);
     } else {
         setError(KGAPI2::InvalidResponse);
@@ -15,12 +15,17 @@
 #include <QMap>
 #include <QStringList>
 
+class QHttpMultiPart;
+class QIODevice;
+
 namespace KGAPI2
 {
 
 namespace Drive
 {
 
+class FileChecksumCache;
+
 class KGAPIDRIVE_EXPORT FileAbstractUploadJob : public KGAPI2::Drive::FileAbstractDataJob
 {
     Q_OBJECT
@@ -36,13 +41,91 @@ public:
 
     QMap<QString /* file path */, FilePtr /* metadata */> files() const;
 
+    /**
+     * @brief Sets whether to skip upload of content that is already on the server
+     *
+     * When enabled, MD5 checksum of each local file is compared against
+     * File::md5Checksum() of the file it replaces. Checksum from the metadata
+     * passed to the job is used when available, otherwise it is fetched from
+     * the server. If you set custom fields on the job, they must include
+     * File::Fields::Kind and File::Fields::Md5Checksum.
+     *
+     * When the content is unchanged only the metadata are sent. When there are
+     * no metadata nothing is sent at all, and files() contains the fetched
+     * remote file with only the requested fields set.
+     *
+     * Applies only to jobs that replace content of an existing file. The
+     * checksums are computed in a thread, so that reading large files does
+     * not block the event loop.
+     *
+     * Default value is false.
+     *
+     * @since 6.4
+     */
+    void setSkipUnchangedContent(bool skip);
+    [[nodiscard]] bool skipUnchangedContent() const;
+
+    /**
+     * @brief Sets cache of checksums of the local files
+     *
+     * Without a cache each file is read in full to compute its checksum.
+     * The job does not take ownership of the @p cache, which is used from
+     * a thread of the job and must outlive it.
+     *
+     * @see setSkipUnchangedContent()
+     * @since 6.4
+     */
+    void setChecksumCache(FileChecksumCache *cache);
+    [[nodiscard]] FileChecksumCache *checksumCache() const;
+
+    /**
+     * @brief Returns paths of files whose content has not been uploaded because it was unchanged
+     *
+     * @see setSkipUnchangedContent()
+     * @since 6.4
+     */
+    [[nodiscard]] QStringList unchangedFiles() const;
+
 protected:
     void start() override;
+    void emitFinished() override;
     void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType) override;
     void handleReply(const QNetworkReply *reply, const QByteArray &rawData) override;
 
     virtual QUrl createUrl(const QString &filePath, const FilePtr &metaData) = 0;
     virtual QNetworkReply *dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data) = 0;
+
+    /**
+     * @brief Sends a request with content of a file streamed from @p data
+     *
+     * The default implementation sends a POST request.
+     *
+     * @since 6.4
+     */
+    virtual QNetworkReply *dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, QIODevice *data);
+
+    /**
+     * @brief Sends a request with metadata and content of a file streamed from @p multiPart
+     *
+     * The parts are separated by a random boundary, unrelated to the name
+     * or the content of the file.
+     *
+     * The default implementation sends a POST request.
+     *
+     * @since 6.4
+     */
+    virtual QNetworkReply *dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, QHttpMultiPart *multiPart);
+
+    /**
+     * @brief Returns ID of the remote file whose content @p filePath replaces
+     *
+     * Used to skip upload of unchanged content. The default implementation
+     * returns an empty string, i.e. there is no such file.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] virtual QString existingFileId(const QString &filePath, const FilePtr &metaData) const;
+
     void setSerializationOptions(File::SerializationOptions options);
     [[nodiscard]] File::SerializationOptions serializationOptions() const;
 
@@ -0,0 +1,212 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "filechecksumcache.h"
+#include "debug.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QSaveFile>
+
+using namespace KGAPI2;
+using namespace KGAPI2::Drive;
+
+namespace
+{
+struct Entry {
+    qint64 size = -1;
+    qint64 modified = 0;
+    QString checksum;
+};
+} // namespace
+
+class Q_DECL_HIDDEN FileChecksumCache::Private
+{
+public:
+    void ensureLoaded()
+    {
+        if (loaded) {
+            return;
+        }
+        loaded = true;
+
+        if (fileName.isEmpty()) {
+            return;
+        }
+
+        QFile file(fileName);
+        if (!file.exists()) {
+            return;
+        }
+        if (!file.open(QIODevice::ReadOnly)) {
+            errorString = file.errorString();
+            qCWarning(KGAPIDebug) << "Failed to open checksum cache" << fileName << ":" << errorString;
+            return;
+        }
+
+        QJsonParseError parseError;
+        const auto document = QJsonDocument::fromJson(file.readAll(), &parseError);
+        if (!document.isObject()) {
+            // The checksums will be computed again
+            errorString = parseError.errorString();
+            qCWarning(KGAPIDebug) << "Invalid checksum cache" << fileName << ":" << errorString;
+            return;
+        }
+
+        const auto object = document.object();
+        for (auto it = object.constBegin(), end = object.constEnd(); it != end; ++it) {
+            const auto value = it.value().toObject();
+            Entry entry;
+            entry.size = value.value(QLatin1StringView("size")).toInteger(-1);
+            entry.modified = value.value(QLatin1StringView("modified")).toInteger();
+            entry.checksum = value.value(QLatin1StringView("md5")).toString();
+            if (entry.size >= 0 && !entry.checksum.isEmpty()) {
+                entries.insert(it.key(), entry);
+            }
+        }
+    }
+
+    bool save()
+    {
+        if (fileName.isEmpty() || !dirty) {
+            return true;
+        }
+
+        const QFileInfo info(fileName);
+        if (!QDir().mkpath(info.absolutePath())) {
+            errorString = QStringLiteral("Failed to create directory %1").arg(info.absolutePath());
+            return false;
+        }
+
+        QJsonObject object;
+        for (auto it = entries.cbegin(), end = entries.cend(); it != end; ++it) {
+            object.insert(it.key(),
+                          QJsonObject{{QStringLiteral("size"), it->size}, {QStringLiteral("modified"), it->modified}, {QStringLiteral("md5"), it->checksum}});
+        }
+
+        QSaveFile file(fileName);
+        if (!file.open(QIODevice::WriteOnly)) {
+            errorString = file.errorString();
+            return false;
+        }
+        file.write(QJsonDocument(object).toJson(QJsonDocument::Compact));
+        if (!file.commit()) {
+            errorString = file.errorString();
+            return false;
+        }
+
+        dirty = false;
+        return true;
+    }
+
+    QString fileName;
+    QString errorString;
+    QHash<QString, Entry> entries;
+    bool loaded = false;
+    bool dirty = false;
+    QMutex lock;
+};
+
+FileChecksumCache::FileChecksumCache(const QString &fileName)
+    : d(new Private)
+{
+    d->fileName = fileName;
+}
+
+FileChecksumCache::~FileChecksumCache()
+{
+    if (!d->save()) {
+        qCWarning(KGAPIDebug) << "Failed to save checksum cache to" << d->fileName << ":" << d->errorString;
+    }
+    delete d;
+}
+
+QString FileChecksumCache::fileName() const
+{
+    return d->fileName;
+}
+
+QString FileChecksumCache::errorString() const
+{
+    QMutexLocker locker(&d->lock);
+    return d->errorString;
+}
+
+QString FileChecksumCache::checksum(const QString &filePath)
+{
+    const QFileInfo info(filePath);
+    if (!info.isFile()) {
+        return QString();
+    }
+
+    const QString path = info.absoluteFilePath();
+    const qint64 size = info.size();
+    const qint64 modified = info.lastModified().toMSecsSinceEpoch();
+
+    {
+        QMutexLocker locker(&d->lock);
+        d->ensureLoaded();
+        const auto it = d->entries.constFind(path);
+        if (it != d->entries.cend() && it->size == size && it->modified == modified) {
+            return it->checksum;
+        }
+    }
+
+    // Don't block other threads while reading the file
+    const QString checksum = computeChecksum(path);
+    if (checksum.isEmpty()) {
+        return QString();
+    }
+
+    QMutexLocker locker(&d->lock);
+    d->entries.insert(path, {size, modified, checksum});
+    d->dirty = true;
+    return checksum;
+}
+
+void FileChecksumCache::clear()
+{
+    QMutexLocker locker(&d->lock);
+    d->loaded = true;
+    d->dirty = true;
+    d->entries.clear();
+}
+
+bool FileChecksumCache::save()
+{
+    QMutexLocker locker(&d->lock);
+    if (!d->save()) {
+        qCWarning(KGAPIDebug) << "Failed to save checksum cache to" << d->fileName << ":" << d->errorString;
+        return false;
+    }
+    return true;
+}
+
+QString FileChecksumCache::computeChecksum(const QString &filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(KGAPIDebug) << "Failed to open" << filePath << ":" << file.errorString();
+        return QString();
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    if (!hash.addData(&file)) {
+        qCWarning(KGAPIDebug) << "Failed to read" << filePath << ":" << file.errorString();
+        return QString();
+    }
+
+    return QString::fromLatin1(hash.result().toHex());
+}
@@ -0,0 +1,105 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "kgapidrive_export.h"
+
+#include <QString>
+
+namespace KGAPI2
+{
+
+namespace Drive
+{
+
+/**
+ * @headerfile filechecksumcache.h
+ * @brief Caches MD5 checksums of local files
+ *
+ * Checksums are remembered together with size and modification time of the
+ * file and are computed again only when either of them changes. The cache
+ * can be backed by a file, so that unchanged files don't have to be read
+ * again by the next run of the application.
+ *
+ * The checksums are in the same format as File::md5Checksum(), so they can
+ * be compared directly.
+ *
+ * All methods are thread-safe.
+ *
+ * @see FileAbstractUploadJob::setSkipUnchangedContent()
+ *
+ * @since 6.4
+ */
+class KGAPIDRIVE_EXPORT FileChecksumCache
+{
+public:
+    /**
+     * @brief Constructs a cache backed by file @p fileName
+     *
+     * The file is read on first access and written by save(). When
+     * @p fileName is empty the cache is kept in memory only.
+     */
+    explicit FileChecksumCache(const QString &fileName = QString());
+
+    /**
+     * @brief Destroys the cache, saving it if there are unsaved changes
+     */
+    ~FileChecksumCache();
+
+    /**
+     * @brief Returns name of the backing file
+     */
+    [[nodiscard]] QString fileName() const;
+
+    /**
+     * @brief Returns description of the last error
+     */
+    [[nodiscard]] QString errorString() const;
+
+    /**
+     * @brief Returns MD5 checksum of file @p filePath as a hex string
+     *
+     * The checksum is computed only when the file is not in the cache or has
+     * changed since. Returns an empty string when the file cannot be read.
+     */
+    [[nodiscard]] QString checksum(const QString &filePath);
+
+    /**
+     * @brief Removes all checksums from the cache
+     */
+    void clear();
+
+    /**
+     * @brief Writes the cache to the backing file
+     *
+     * The file is replaced atomically.
+     *
+     * @return Returns whether the cache has been written
+     */
+    bool save();
+
+    /**
+     * @brief Computes MD5 checksum of file @p filePath without caching it
+     *
+     * The file is read in blocks, it is never loaded into memory as a whole.
+     * Returns an empty string when the file cannot be read.
+     */
+    [[nodiscard]] static QString computeChecksum(const QString &filePath);
+
+private:
+    Q_DISABLE_COPY(FileChecksumCache)
+
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace Drive
+
+} // namespace KGAPI2
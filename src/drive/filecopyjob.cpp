@@ -6,8 +6,10 @@
  * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
  */
 #include "filecopyjob.h"
+#include "debug.h"
 #include "driveservice.h"
 #include "file.h"
+#include "private/batchrequest_p.h"
 #include "utils.h"
 
 #include <QNetworkReply>
@@ -26,6 +28,10 @@ public:
 
     QList<FilePtr> copies;
 
+    int batchSize = 1;
+    int currentBatchSize = 0;
+    ItemResultsList itemResults;
+
 private:
     FileCopyJob *const q;
 };
@@ -42,6 +48,21 @@ void FileCopyJob::Private::processNext()
         return;
     }
 
+    if (batchSize > 1) {
+        BatchRequest batch(DriveService::batchUrl());
+        while (!files.isEmpty() && batch.count() < batchSize) {
+            const QString fileId = files.cbegin().key();
+            const FilePtr file = files.take(fileId);
+
+            QUrl url = DriveService::copyFileUrl(fileId);
+            q->updateUrl(url);
+            batch.addRequest("POST", url, File::toJSON(file), QStringLiteral("application/json"));
+        }
+        currentBatchSize = batch.count();
+        q->enqueueRequest(batch.request(), batch.data(), batch.contentType());
+        return;
+    }
+
     const QString fileId = files.cbegin().key();
     const FilePtr file = files.take(fileId);
 
@@ -97,6 +118,32 @@ FilesList FileCopyJob::files() const
     return d->copies;
 }
 
+void FileCopyJob::setBatchSize(int batchSize)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify batchSize property when job is running";
+        return;
+    }
+
+    d->batchSize = qBound(1, batchSize, BatchRequest::MaxBatchSize);
+}
+
+int FileCopyJob::batchSize() const
+{
+    return d->batchSize;
+}
+
+ItemResultsList FileCopyJob::itemResults() const
+{
+    return d->itemResults;
+}
+
+void FileCopyJob::aboutToStart()
+{
+    d->itemResults.clear();
+    FileAbstractDataJob::aboutToStart();
+}
+
 void FileCopyJob::start()
 {
     d->processNext();
@@ -113,9 +160,35 @@ void FileCopyJob::dispatchRequest(QNetworkAccessManager *accessManager, const QN
 void FileCopyJob::handleReply(const QNetworkReply *reply, const QByteArray &rawData)
 {
     const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+
+    if (d->batchSize > 1) {
+        if (!BatchRequest::isBatchResponse(contentType)) {
+            setError(KGAPI2::InvalidResponse);
+            setErrorString(tr("Invalid response content type"));
+            emitFinished();
+            return;
+        }
+
+        const ItemResult failure =
+            BatchRequest::appendResults(contentType, rawData, d->currentBatchSize, d->itemResults, [this](const QByteArray &body) -> ObjectPtr {
+                const FilePtr copy = File::fromJSON(body);
+                d->copies << copy;
+                return copy;
+            });
+        if (failure.error != KGAPI2::NoError) {
+            setError(failure.error);
+            setErrorString(failure.errorString);
+        }
+
+        // Enqueue next batch or finish
+        d->processNext();
+        return;
+    }
+
     ContentType ct = Utils::stringToContentType(contentType);
     if (ct == KGAPI2::JSON) {
         d->copies << File::fromJSON(rawData);
+        d->itemResults << ItemResult{d->copies.constLast(), KGAPI2::NoError, QString()};
     } else {
         setError(KGAPI2::InvalidResponse);
         setErrorString(tr("Invalid response content type"));
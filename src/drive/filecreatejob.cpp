@@ -9,6 +9,7 @@
 #include "filecreatejob.h"
 #include "driveservice.h"
 
+#include <QHttpMultiPart>
 #include <QNetworkAccessManager>
 #include <QNetworkRequest>
 
@@ -65,6 +66,16 @@ QNetworkReply *FileCreateJob::dispatch(QNetworkAccessManager *accessManager, con
     return accessManager->post(request, data);
 }
 
+QNetworkReply *FileCreateJob::dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, QIODevice *data)
+{
+    return accessManager->post(request, data);
+}
+
+QNetworkReply *FileCreateJob::dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, QHttpMultiPart *multiPart)
+{
+    return accessManager->post(request, multiPart);
+}
+
 QUrl FileCreateJob::createUrl(const QString &filePath, const FilePtr &metaData)
 {
     if (filePath.isEmpty() && !metaData.isNull()) {
@@ -32,6 +32,8 @@ public:
 
 protected:
     QNetworkReply *dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data) override;
+    QNetworkReply *dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, QIODevice *data) override;
+    QNetworkReply *dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, QHttpMultiPart *multiPart) override;
 
     [[nodiscard]] QUrl createUrl(const QString &filePath, const FilePtr &metaData) override;
 
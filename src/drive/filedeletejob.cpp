@@ -7,9 +7,13 @@
  */
 
 #include "filedeletejob.h"
+#include "debug.h"
 #include "driveservice.h"
 #include "file.h"
+#include "private/batchrequest_p.h"
 
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
 #include <QNetworkRequest>
 
 using namespace KGAPI2;
@@ -19,6 +23,9 @@ class Q_DECL_HIDDEN FileDeleteJob::Private
 {
 public:
     QStringList filesIDs;
+    int batchSize = 1;
+    int currentBatchSize = 0;
+    ItemResultsList itemResults;
 };
 
 FileDeleteJob::FileDeleteJob(const QString &fileId, const AccountPtr &account, QObject *parent)
@@ -56,6 +63,32 @@ FileDeleteJob::~FileDeleteJob()
     delete d;
 }
 
+void FileDeleteJob::setBatchSize(int batchSize)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify batchSize property when job is running";
+        return;
+    }
+
+    d->batchSize = qBound(1, batchSize, BatchRequest::MaxBatchSize);
+}
+
+int FileDeleteJob::batchSize() const
+{
+    return d->batchSize;
+}
+
+ItemResultsList FileDeleteJob::itemResults() const
+{
+    return d->itemResults;
+}
+
+void FileDeleteJob::aboutToStart()
+{
+    d->itemResults.clear();
+    DeleteJob::aboutToStart();
+}
+
 void FileDeleteJob::start()
 {
     if (d->filesIDs.isEmpty()) {
@@ -63,6 +96,18 @@ void FileDeleteJob::start()
         return;
     }
 
+    if (d->batchSize > 1) {
+        BatchRequest batch(DriveService::batchUrl());
+        const QStringList filesIds = d->filesIDs.mid(0, d->batchSize);
+        d->filesIDs.remove(0, filesIds.size());
+        for (const QString &fileId : filesIds) {
+            batch.addRequest("DELETE", DriveService::deleteFileUrl(fileId));
+        }
+        d->currentBatchSize = batch.count();
+        enqueueRequest(batch.request(), batch.data(), batch.contentType());
+        return;
+    }
+
     const QString fileId = d->filesIDs.takeFirst();
     const QUrl url = DriveService::deleteFileUrl(fileId);
 
@@ -70,4 +115,38 @@ void FileDeleteJob::start()
     enqueueRequest(request);
 }
 
+void FileDeleteJob::dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType)
+{
+    if (d->batchSize > 1) {
+        // Batch requests are always POSTed to the batch endpoint
+        accessManager->post(request, data);
+        return;
+    }
+
+    DeleteJob::dispatchRequest(accessManager, request, data, contentType);
+}
+
+void FileDeleteJob::handleReply(const QNetworkReply *reply, const QByteArray &rawData)
+{
+    if (d->batchSize > 1) {
+        const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+        if (!BatchRequest::isBatchResponse(contentType)) {
+            setError(KGAPI2::InvalidResponse);
+            setErrorString(tr("Invalid response content type"));
+            emitFinished();
+            return;
+        }
+
+        const ItemResult failure = BatchRequest::appendResults(contentType, rawData, d->currentBatchSize, d->itemResults);
+        if (failure.error != KGAPI2::NoError) {
+            setError(failure.error);
+            setErrorString(failure.errorString);
+        }
+    } else {
+        d->itemResults << ItemResult();
+    }
+
+    DeleteJob::handleReply(reply, rawData);
+}
+
 #include "moc_filedeletejob.cpp"
@@ -23,6 +23,22 @@ class KGAPIDRIVE_EXPORT FileDeleteJob : public KGAPI2::DeleteJob
 {
     Q_OBJECT
 
+    /**
+     * @brief Number of files deleted in a single request
+     *
+     * When larger than 1, files are deleted through the Drive batch
+     * endpoint in groups of up to batchSize files, instead of one request
+     * per file. Results of the individual files are available through
+     * itemResults().
+     *
+     * Defaults to 1, the maximum is 100. This property can be modified only
+     * when the job is not running.
+     *
+     * @see setBatchSize, batchSize
+     * @since 6.4
+     */
+    Q_PROPERTY(int batchSize READ batchSize WRITE setBatchSize)
+
 public:
     explicit FileDeleteJob(const QString &fileId, const AccountPtr &account, QObject *parent = nullptr);
     explicit FileDeleteJob(const QStringList &filesIds, const AccountPtr &account, QObject *parent = nullptr);
@@ -30,8 +46,37 @@ public:
     explicit FileDeleteJob(const FilesList &files, const AccountPtr &account, QObject *parent = nullptr);
     ~FileDeleteJob() override;
 
+    /**
+     * @brief Sets number of files to delete in a single batch request
+     *
+     * @param batchSize Number of files per request, between 1 and 100.
+     * @since 6.4
+     */
+    void setBatchSize(int batchSize);
+
+    /**
+     * @brief Returns number of files deleted in a single batch request
+     * @since 6.4
+     */
+    [[nodiscard]] int batchSize() const;
+
+    /**
+     * @brief Returns results of the individual files
+     *
+     * The results are in the same order as the files passed to the
+     * constructor. In batch mode a failure of a single file does not stop
+     * the job, error() then reports the first failure and the result of
+     * every file is available here.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] ItemResultsList itemResults() const;
+
 protected:
+    void aboutToStart() override;
     void start() override;
+    void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType) override;
+    void handleReply(const QNetworkReply *reply, const QByteArray &rawData) override;
 
 private:
     class Private;
@@ -7,14 +7,29 @@
  */
 
 #include "filefetchcontentjob.h"
+#include "bandwidthlimiter.h"
+#include "bandwidthlimiter_p.h"
+#include "debug.h"
 #include "file.h"
 
+#include <QHash>
+#include <QIODevice>
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QSet>
+#include <QTimer>
 
 using namespace KGAPI2;
 using namespace KGAPI2::Drive;
 
+namespace
+{
+// Don't split the content into ranges smaller than this
+static constexpr qint64 MinimumRangeSize = 1024 * 1024;
+// Content the network may receive ahead of the limiter
+static constexpr qint64 ReadBufferSize = 256 * 1024;
+}
+
 class Q_DECL_HIDDEN FileFetchContentJob::Private
 {
 public:
@@ -22,9 +37,36 @@ public:
 
     void _k_downloadProgress(qint64 downloaded, qint64 total);
 
+    struct Range {
+        qint64 start;
+        // Last byte of the range, -1 for the rest of the content
+        qint64 end;
+        // Offset of the next byte to receive
+        qint64 position;
+    };
+
+    QNetworkRequest rangeRequest(const Range &range) const;
+    int rangeForRequest(const QNetworkRequest &request) const;
+    bool writeData(const QNetworkReply *reply, const QByteArray &data);
+    void _k_readyRead(QNetworkReply *reply);
+
     QUrl url;
+    qint64 fileSize = -1;
     QByteArray fileData;
 
+    QIODevice *device = nullptr;
+    qint64 deviceOrigin = 0;
+    int parallelDownloads = 1;
+    qint64 startOffset = 0;
+
+    QList<Range> ranges;
+    QHash<const QNetworkReply *, int> replyRanges;
+
+    QPointer<BandwidthLimiter> bandwidthLimiter;
+    ThroughputMeter throughput;
+    // Replies waiting for the limiter to read more content
+    QSet<const QNetworkReply *> throttledReplies;
+
 private:
     FileFetchContentJob *const q;
 };
@@ -36,7 +78,123 @@ FileFetchContentJob::Private::Private(FileFetchContentJob *parent)
 
 void FileFetchContentJob::Private::_k_downloadProgress(qint64 downloaded, qint64 total)
 {
-    q->emitProgress(downloaded, total);
+    if (ranges.size() <= 1) {
+        throughput.update(downloaded);
+        q->emitProgress(downloaded, total);
+        return;
+    }
+
+    qint64 received = 0;
+    for (const auto &range : std::as_const(ranges)) {
+        received += range.position - range.start;
+    }
+    throughput.update(received);
+    q->emitProgress(received, fileSize - startOffset);
+}
+
+QNetworkRequest FileFetchContentJob::Private::rangeRequest(const Range &range) const
+{
+    QNetworkRequest request(url);
+    if (range.start > 0 || range.end >= 0) {
+        const QString end = range.end >= 0 ? QString::number(range.end) : QString();
+        request.setRawHeader("Range", QStringLiteral("bytes=%1-%2").arg(range.start).arg(end).toLatin1());
+    }
+    return request;
+}
+
+int FileFetchContentJob::Private::rangeForRequest(const QNetworkRequest &request) const
+{
+    // Range: bytes=<start>-[<end>]
+    const QByteArray header = request.rawHeader("Range");
+    const qint64 start = header.isEmpty() ? 0 : header.mid(6, header.indexOf('-') - 6).toLongLong();
+    for (int i = 0; i < ranges.size(); ++i) {
+        if (ranges.at(i).start == start) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool FileFetchContentJob::Private::writeData(const QNetworkReply *reply, const QByteArray &data)
+{
+    const auto it = replyRanges.constFind(reply);
+    if (it == replyRanges.cend() || data.isEmpty()) {
+        return true;
+    }
+    Range &range = ranges[*it];
+
+    if (!device) {
+        fileData.append(data);
+        range.position += data.size();
+        return true;
+    }
+
+    if (!device->isSequential() && !device->seek(deviceOrigin + range.position - startOffset)) {
+        qCWarning(KGAPIDebug) << "Failed seeking device to" << range.position << ":" << device->errorString();
+        q->setError(KGAPI2::UnknownError);
+        q->setErrorString(tr("Failed writing downloaded content: %1").arg(device->errorString()));
+        q->emitFinished();
+        return false;
+    }
+    if (device->write(data) != data.size()) {
+        qCWarning(KGAPIDebug) << "Failed writing downloaded content:" << device->errorString();
+        q->setError(KGAPI2::UnknownError);
+        q->setErrorString(tr("Failed writing downloaded content: %1").arg(device->errorString()));
+        q->emitFinished();
+        return false;
+    }
+    range.position += data.size();
+    return true;
+}
+
+void FileFetchContentJob::Private::_k_readyRead(QNetworkReply *reply)
+{
+    if (!q->isRunning()) {
+        return;
+    }
+
+    // Leave the body of errors and redirects to the Job
+    const int replyCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (replyCode != KGAPI2::PartialContent && replyCode != KGAPI2::OK) {
+        return;
+    }
+
+    const auto it = replyRanges.constFind(reply);
+    if (it != replyRanges.cend() && replyCode == KGAPI2::OK && ranges.at(*it).start > 0) {
+        qCWarning(KGAPIDebug) << "Server ignored the Range header";
+        q->setError(KGAPI2::UnknownError);
+        q->setErrorString(tr("Server does not support downloading ranges of the content"));
+        q->emitFinished();
+        return;
+    }
+
+    if (throttledReplies.contains(reply)) {
+        // Waiting for the limiter
+        return;
+    }
+
+    BandwidthLimiter *limiter = q->bandwidthLimiter();
+    const qint64 available = reply->bytesAvailable();
+    const qint64 granted = limiter->take(BandwidthLimiter::Download, available);
+    if (granted > 0 && !writeData(reply, reply->read(granted))) {
+        return;
+    }
+
+    if (granted < available) {
+        // The rest stays in the read buffer of the reply, which stops
+        // receiving more content once it is full. The limit may have been
+        // set only after the download has started.
+        if (reply->readBufferSize() == 0) {
+            reply->setReadBufferSize(ReadBufferSize);
+        }
+        throttledReplies.insert(reply);
+        QTimer::singleShot(limiter->delay(BandwidthLimiter::Download, available - granted), q, [this, reply = QPointer<QNetworkReply>(reply)]() {
+            if (reply) {
+                throttledReplies.remove(reply.data());
+                _k_readyRead(reply.data());
+            }
+        });
+    }
 }
 
 FileFetchContentJob::FileFetchContentJob(const FilePtr &file, const AccountPtr &account, QObject *parent)
@@ -44,6 +202,9 @@ FileFetchContentJob::FileFetchContentJob(const FilePtr &file, const AccountPtr &
     , d(new Private(this))
 {
     d->url = file->downloadUrl();
+    if (file->fileSize() > 0) {
+        d->fileSize = file->fileSize();
+    }
 }
 
 FileFetchContentJob::FileFetchContentJob(const QUrl &url, const AccountPtr &account, QObject *parent)
@@ -63,10 +224,117 @@ QByteArray FileFetchContentJob::data() const
     return d->fileData;
 }
 
+void FileFetchContentJob::setDevice(QIODevice *device)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify device property when job is running";
+        return;
+    }
+
+    d->device = device;
+}
+
+QIODevice *FileFetchContentJob::device() const
+{
+    return d->device;
+}
+
+void FileFetchContentJob::setParallelDownloads(int count)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify parallelDownloads property when job is running";
+        return;
+    }
+
+    d->parallelDownloads = qMax(count, 1);
+}
+
+int FileFetchContentJob::parallelDownloads() const
+{
+    return d->parallelDownloads;
+}
+
+void FileFetchContentJob::setStartOffset(qint64 offset)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify startOffset property when job is running";
+        return;
+    }
+
+    d->startOffset = qMax<qint64>(offset, 0);
+}
+
+qint64 FileFetchContentJob::startOffset() const
+{
+    return d->startOffset;
+}
+
+void FileFetchContentJob::setBandwidthLimiter(BandwidthLimiter *limiter)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify bandwidthLimiter property when job is running";
+        return;
+    }
+
+    d->bandwidthLimiter = limiter;
+}
+
+BandwidthLimiter *FileFetchContentJob::bandwidthLimiter() const
+{
+    return d->bandwidthLimiter ? d->bandwidthLimiter.data() : BandwidthLimiter::forAccount(account());
+}
+
+qint64 FileFetchContentJob::throughput() const
+{
+    return d->throughput.rate();
+}
+
+qint64 FileFetchContentJob::completedOffset() const
+{
+    qint64 offset = d->startOffset;
+    for (const auto &range : std::as_const(d->ranges)) {
+        offset = range.position;
+        if (range.end < 0 || range.position <= range.end) {
+            break;
+        }
+    }
+    return offset;
+}
+
+void FileFetchContentJob::aboutToStart()
+{
+    d->fileData.clear();
+    d->ranges.clear();
+    d->replyRanges.clear();
+    d->throttledReplies.clear();
+    if (d->device) {
+        d->deviceOrigin = d->device->pos();
+    }
+
+    FetchJob::aboutToStart();
+}
+
 void FileFetchContentJob::start()
 {
-    QNetworkRequest request(d->url);
-    enqueueRequest(request);
+    const qint64 remaining = d->fileSize - d->startOffset;
+    int count = 1;
+    if (d->device && !d->device->isSequential() && d->fileSize > 0 && remaining > 0) {
+        count = static_cast<int>(qBound<qint64>(1, remaining / MinimumRangeSize, d->parallelDownloads));
+    }
+
+    if (count == 1) {
+        d->ranges.append({d->startOffset, -1, d->startOffset});
+    } else {
+        const qint64 rangeSize = (remaining + count - 1) / count;
+        for (qint64 start = d->startOffset; start < d->fileSize; start += rangeSize) {
+            d->ranges.append({start, qMin(start + rangeSize, d->fileSize) - 1, start});
+        }
+        qCDebug(KGAPIDebug) << "Downloading" << remaining << "bytes in" << d->ranges.size() << "ranges";
+    }
+
+    for (const auto &range : std::as_const(d->ranges)) {
+        enqueueRequest(d->rangeRequest(range));
+    }
 }
 
 void FileFetchContentJob::dispatchRequest(QNetworkAccessManager *accessManager,
@@ -78,16 +346,67 @@ void FileFetchContentJob::dispatchRequest(QNetworkAccessManager *accessManager,
     Q_UNUSED(contentType)
 
     QNetworkReply *reply = accessManager->get(request);
+    // Let the limiter hold back the download, see _k_readyRead(). An
+    // unlimited download is not slowed down by a small buffer.
+    if (bandwidthLimiter()->isLimited(BandwidthLimiter::Download)) {
+        reply->setReadBufferSize(ReadBufferSize);
+    }
+    const int range = d->rangeForRequest(request);
+    if (range != -1) {
+        d->replyRanges.insert(reply, range);
+    }
+    connect(reply, &QNetworkReply::readyRead, this, [this, reply]() {
+        d->_k_readyRead(reply);
+    });
     connect(reply, &QNetworkReply::downloadProgress, this, [this](qint64 downloaded, qint64 total) {
         d->_k_downloadProgress(downloaded, total);
     });
+    connect(reply, &QObject::destroyed, this, [this, reply]() {
+        d->replyRanges.remove(reply);
+        d->throttledReplies.remove(reply);
+    });
 }
 
 void FileFetchContentJob::handleReply(const QNetworkReply *reply, const QByteArray &rawData)
 {
-    Q_UNUSED(reply)
+    const int replyCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    const auto it = d->replyRanges.constFind(reply);
+    if (it != d->replyRanges.cend() && replyCode == KGAPI2::OK && d->ranges.at(*it).start > 0) {
+        setError(KGAPI2::UnknownError);
+        setErrorString(tr("Server does not support downloading ranges of the content"));
+        emitFinished();
+        return;
+    }
+
+    // The rest of the content that has not been handled in readyRead
+    if (!d->writeData(reply, rawData)) {
+        return;
+    }
+
+    // A dropped connection may still come with the status of the reply
+    if (reply->error() != QNetworkReply::NoError) {
+        qCWarning(KGAPIDebug) << "Download interrupted:" << reply->errorString();
+        setError(KGAPI2::NetworkError);
+        setErrorString(tr("Download interrupted: %1").arg(reply->errorString()));
+        emitFinished();
+        return;
+    }
 
-    d->fileData = rawData;
+    if (it == d->replyRanges.cend()) {
+        return;
+    }
+    const auto &range = d->ranges.at(*it);
+    qint64 expectedEnd = range.end + 1;
+    if (range.end < 0) {
+        const QVariant contentLength = reply->header(QNetworkRequest::ContentLengthHeader);
+        expectedEnd = d->fileSize > 0 ? d->fileSize : (contentLength.isValid() ? range.start + contentLength.toLongLong() : -1);
+    }
+    if (expectedEnd >= 0 && range.position < expectedEnd) {
+        qCWarning(KGAPIDebug) << "Download ended at" << range.position << "instead of" << expectedEnd;
+        setError(KGAPI2::NetworkError);
+        setErrorString(tr("Download ended after %1 of %2 bytes").arg(range.position).arg(expectedEnd));
+        emitFinished();
+    }
 }
 
 ObjectsList FileFetchContentJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
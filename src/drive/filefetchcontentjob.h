@@ -11,11 +11,15 @@
 #include "fetchjob.h"
 #include "kgapidrive_export.h"
 
+class QIODevice;
+
 namespace KGAPI2
 {
 namespace Drive
 {
 
+class BandwidthLimiter;
+
 class KGAPIDRIVE_EXPORT FileFetchContentJob : public KGAPI2::FetchJob
 {
     Q_OBJECT
@@ -25,11 +29,116 @@ public:
     explicit FileFetchContentJob(const QUrl &url, const AccountPtr &account, QObject *parent = nullptr);
     ~FileFetchContentJob() override;
 
+    /**
+     * @brief Returns the downloaded content
+     *
+     * Empty when the content has been written to a device.
+     */
     [[nodiscard]] QByteArray data() const;
 
+    /**
+     * @brief Sets a device to write the content to as it is received
+     *
+     * The content is then not kept in memory and data() returns an empty
+     * array. When the device is not sequential, byte X of the content is
+     * written at position of the device when the job started plus X minus
+     * startOffset(). A sequential device receives the content in order.
+     *
+     * The device must be open for writing and must outlive the job.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @since 6.4
+     */
+    void setDevice(QIODevice *device);
+
+    /**
+     * @brief Returns the device the content is written to
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] QIODevice *device() const;
+
+    /**
+     * @brief Sets the number of ranges of the content to download concurrently
+     *
+     * Large files are split into up to @p count ranges that are requested at
+     * the same time, which helps to saturate the bandwidth when the throughput
+     * of a single connection is limited. Ranges are only used when the content
+     * is written to a device that is not sequential and the size of the file
+     * is known from its metadata. Defaults to 1.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @since 6.4
+     */
+    void setParallelDownloads(int count);
+
+    /**
+     * @brief Returns the number of ranges of the content to download concurrently
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] int parallelDownloads() const;
+
+    /**
+     * @brief Sets the offset in the content to start downloading from
+     *
+     * Use completedOffset() of a failed job, for example one whose connection
+     * was interrupted, to resume the download.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @since 6.4
+     */
+    void setStartOffset(qint64 offset);
+
+    /**
+     * @brief Returns the offset in the content to start downloading from
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] qint64 startOffset() const;
+
+    /**
+     * @brief Returns offset up to which the content has been received without gaps
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] qint64 completedOffset() const;
+
+    /**
+     * @brief Sets limiter of the bandwidth used to download the content
+     *
+     * Defaults to BandwidthLimiter::forAccount() of the job's account. The
+     * job does not take ownership of the @p limiter.
+     *
+     * This property can be modified only when the job is not running.
+     *
+     * @since 6.4
+     */
+    void setBandwidthLimiter(BandwidthLimiter *limiter);
+
+    /**
+     * @brief Returns limiter of the bandwidth used to download the content
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] BandwidthLimiter *bandwidthLimiter() const;
+
+    /**
+     * @brief Returns bytes per second downloaded recently
+     *
+     * Updated whenever the progress() signal is emitted.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] qint64 throughput() const;
+
 protected:
     void start() override;
     void handleReply(const QNetworkReply *reply, const QByteArray &rawData) override;
+    void aboutToStart() override;
     void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType) override;
 
     KGAPI2::ObjectsList handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData) override;
@@ -15,6 +15,7 @@
 
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QSet>
 #include <QUrlQuery>
 
 using namespace KGAPI2;
@@ -36,6 +37,10 @@ public:
 
     QStringList fields;
 
+    // IDs of files returned so far when the query was split
+    QSet<QString> fetchedIds;
+    bool isSplit = false;
+
 private:
     FileFetchJob *const q;
 };
@@ -47,20 +52,7 @@ FileFetchJob::Private::Private(FileFetchJob *parent)
 
 void FileFetchJob::Private::processNext()
 {
-    QUrl url;
-
     if (isFeed) {
-        url = DriveService::fetchFilesUrl();
-
-        QUrlQuery query(url);
-        if (!searchQuery.isEmpty()) {
-            query.addQueryItem(QStringLiteral("q"), searchQuery.serialize());
-        }
-
-        query.addQueryItem(QStringLiteral("includeItemsFromAllDrives"), Utils::bool2Str(includeItemsFromAllDrives));
-
-        url.setQuery(query);
-
         if (!fields.isEmpty()) {
             // Deserializing requires kind attribute, always force add it
             if (!fields.contains(File::Fields::Kind)) {
@@ -74,23 +66,47 @@ void FileFetchJob::Private::processNext()
                                 File::Fields::SelfLink,
                                 Job::buildSubfields(File::Fields::Items, fields)});
         }
-    } else {
-        if (filesIDs.isEmpty()) {
-            q->emitFinished();
-            return;
-        }
 
-        const QString fileId = filesIDs.takeFirst();
-        url = DriveService::fetchFileUrl(fileId);
+        // Overly long queries are rejected, run them in parts
+        const QList<SearchQuery> queries = searchQuery.split();
+        isSplit = queries.size() > 1;
+        if (isSplit) {
+            qCDebug(KGAPIDebug) << "Splitting search query into" << queries.size() << "queries";
+        }
+        for (const auto &subquery : queries) {
+            QUrl url = DriveService::fetchFilesUrl();
 
-        if (!fields.isEmpty()) {
-            // Deserializing requires kind attribute, always force add it
-            if (!fields.contains(File::Fields::Kind)) {
-                fields << File::Fields::Kind;
+            QUrlQuery query(url);
+            if (!subquery.isEmpty()) {
+                query.addQueryItem(QStringLiteral("q"), subquery.serialize());
             }
-            Job *baseJob = dynamic_cast<Job *>(q);
-            baseJob->setFields(fields);
+
+            query.addQueryItem(QStringLiteral("includeItemsFromAllDrives"), Utils::bool2Str(includeItemsFromAllDrives));
+            query.addQueryItem(QStringLiteral("supportsAllDrives"), Utils::bool2Str(supportsAllDrives));
+
+            url.setQuery(query);
+
+            QNetworkRequest request(url);
+            q->enqueueRequest(request);
         }
+        return;
+    }
+
+    if (filesIDs.isEmpty()) {
+        q->emitFinished();
+        return;
+    }
+
+    const QString fileId = filesIDs.takeFirst();
+    QUrl url = DriveService::fetchFileUrl(fileId);
+
+    if (!fields.isEmpty()) {
+        // Deserializing requires kind attribute, always force add it
+        if (!fields.contains(File::Fields::Kind)) {
+            fields << File::Fields::Kind;
+        }
+        Job *baseJob = dynamic_cast<Job *>(q);
+        baseJob->setFields(fields);
     }
 
     QUrlQuery withDriveSupportQuery(url);
@@ -152,6 +168,8 @@ void FileFetchJob::setUpdateViewedDate(bool updateViewedDate)
 
 void FileFetchJob::start()
 {
+    d->fetchedIds.clear();
+    d->isSplit = false;
     d->processNext();
 }
 
@@ -235,7 +253,17 @@ ObjectsList FileFetchJob::handleReplyWithItems(const QNetworkReply *reply, const
         if (d->isFeed) {
             FeedData feedData;
 
-            items << File::fromJSONFeed(rawData, feedData);
+            const FilesList files = File::fromJSONFeed(rawData, feedData);
+            for (const auto &file : files) {
+                // Results of the split queries may overlap
+                if (d->isSplit) {
+                    if (d->fetchedIds.contains(file->id())) {
+                        continue;
+                    }
+                    d->fetchedIds.insert(file->id());
+                }
+                items << file;
+            }
 
             if (feedData.nextPageUrl.isValid()) {
                 QNetworkRequest request(feedData.nextPageUrl);
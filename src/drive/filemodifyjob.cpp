@@ -12,6 +12,7 @@
 #include "file.h"
 #include "utils.h"
 
+#include <QHttpMultiPart>
 #include <QNetworkAccessManager>
 #include <QNetworkRequest>
 #include <QUrlQuery>
@@ -148,9 +149,26 @@ QUrl FileModifyJob::createUrl(const QString &filePath, const FilePtr &metaData)
     return url;
 }
 
+QString FileModifyJob::existingFileId(const QString &filePath, const FilePtr &metaData) const
+{
+    Q_UNUSED(metaData)
+
+    return d->files.value(filePath);
+}
+
 QNetworkReply *FileModifyJob::dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data)
 {
     return accessManager->put(request, data);
 }
 
+QNetworkReply *FileModifyJob::dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, QIODevice *data)
+{
+    return accessManager->put(request, data);
+}
+
+QNetworkReply *FileModifyJob::dispatch(QNetworkAccessManager *accessManager, const QNetworkRequest &request, QHttpMultiPart *multiPart)
+{
+    return accessManager->put(request, multiPart);
+}
+
 #include "moc_filemodifyjob.cpp"
@@ -0,0 +1,276 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "foldertreefetchjob.h"
+#include "debug.h"
+#include "driveservice.h"
+#include "file.h"
+#include "filesearchquery.h"
+#include "utils.h"
+
+#include <QMap>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QSet>
+#include <QUrlQuery>
+
+using namespace KGAPI2;
+using namespace KGAPI2::Drive;
+
+namespace
+{
+// Keep the request URL well below the limits of the servers and proxies
+static constexpr int MaxQueryLength = 4096;
+// Maximum number of items per page of files.list
+static constexpr int MaxPageSize = 1000;
+} // namespace
+
+class Q_DECL_HIDDEN FolderTreeFetchJob::Private
+{
+public:
+    Private(FolderTreeFetchJob *parent);
+
+    void scheduleRequests();
+    void emitFetchedLevels();
+
+    struct Level {
+        // Number of queries for files on this level that are still running
+        int runningQueries = 0;
+        FilesList files;
+    };
+
+    QStringList folderIds;
+    int maxDepth = 0;
+    int maxParallelRequests = 4;
+    QStringList fields;
+
+    // Folders whose children have not been requested yet, by depth of the children
+    QMap<int, QStringList> pendingFolders;
+    QMap<int, Level> levels;
+    QSet<QString> visitedFolders;
+    int runningRequests = 0;
+    int fetchedDepth = 0;
+
+private:
+    FolderTreeFetchJob *const q;
+};
+
+FolderTreeFetchJob::Private::Private(FolderTreeFetchJob *parent)
+    : q(parent)
+{
+}
+
+void FolderTreeFetchJob::Private::scheduleRequests()
+{
+    while (runningRequests < maxParallelRequests && !pendingFolders.isEmpty()) {
+        // Finish the upper levels first
+        auto it = pendingFolders.begin();
+        const int depth = it.key();
+        QStringList &folders = it.value();
+
+        FileSearchQuery parentsQuery(FileSearchQuery::Or);
+        int length = 0;
+        int count = 0;
+        for (const auto &folderId : std::as_const(folders)) {
+            FileSearchQuery parentQuery;
+            parentQuery.addQuery(FileSearchQuery::Parents, FileSearchQuery::In, folderId);
+            length += QUrl::toPercentEncoding(parentQuery.serialize()).size() + 8;
+            if (count > 0 && length > MaxQueryLength) {
+                break;
+            }
+            parentsQuery.addQuery(FileSearchQuery::Parents, FileSearchQuery::In, folderId);
+            ++count;
+        }
+        folders.remove(0, count);
+        if (folders.isEmpty()) {
+            pendingFolders.erase(it);
+        }
+
+        FileSearchQuery searchQuery;
+        searchQuery.addQuery(parentsQuery);
+        searchQuery.addQuery(FileSearchQuery::Trashed, FileSearchQuery::Equals, false);
+
+        QUrl url = DriveService::fetchFilesUrl();
+        QUrlQuery query(url);
+        query.addQueryItem(QStringLiteral("q"), searchQuery.serialize());
+        query.addQueryItem(QStringLiteral("includeItemsFromAllDrives"), Utils::bool2Str(true));
+        query.addQueryItem(QStringLiteral("supportsAllDrives"), Utils::bool2Str(true));
+        url.setQuery(query);
+
+        qCDebug(KGAPIDebug) << "Fetching children of" << count << "folders on level" << depth - 1;
+        ++levels[depth].runningQueries;
+        ++runningRequests;
+        // Depth of the files returned by the query
+        QNetworkRequest request(url);
+        request.setAttribute(QNetworkRequest::User, depth);
+        q->enqueueRequest(request);
+    }
+}
+
+void FolderTreeFetchJob::Private::emitFetchedLevels()
+{
+    // A level is complete once all queries for it have finished and the
+    // level above is complete, so no more folders can be found for it
+    for (auto it = levels.begin(); it != levels.end() && it.key() == fetchedDepth + 1;) {
+        if (it->runningQueries > 0 || pendingFolders.contains(it.key())) {
+            return;
+        }
+
+        const int depth = it.key();
+        const FilesList files = it->files;
+        it = levels.erase(it);
+        fetchedDepth = depth;
+        Q_EMIT q->levelFetched(q, depth, files);
+    }
+}
+
+FolderTreeFetchJob::FolderTreeFetchJob(const QString &folderId, const AccountPtr &account, QObject *parent)
+    : FolderTreeFetchJob(QStringList{folderId}, account, parent)
+{
+}
+
+FolderTreeFetchJob::FolderTreeFetchJob(const QStringList &folderIds, const AccountPtr &account, QObject *parent)
+    : FetchJob(account, parent)
+    , d(new Private(this))
+{
+    d->folderIds = folderIds;
+    setPageSizeParameter(QStringLiteral("maxResults"), MaxPageSize);
+}
+
+FolderTreeFetchJob::~FolderTreeFetchJob()
+{
+    delete d;
+}
+
+int FolderTreeFetchJob::maxDepth() const
+{
+    return d->maxDepth;
+}
+
+void FolderTreeFetchJob::setMaxDepth(int maxDepth)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify maxDepth property when job is running";
+        return;
+    }
+
+    d->maxDepth = qMax(maxDepth, 0);
+}
+
+int FolderTreeFetchJob::maxParallelRequests() const
+{
+    return d->maxParallelRequests;
+}
+
+void FolderTreeFetchJob::setMaxParallelRequests(int maxParallelRequests)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify maxParallelRequests property when job is running";
+        return;
+    }
+
+    d->maxParallelRequests = qMax(maxParallelRequests, 1);
+}
+
+void FolderTreeFetchJob::setFields(const QStringList &fields)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify fields property when job is running";
+        return;
+    }
+
+    d->fields = fields;
+}
+
+QStringList FolderTreeFetchJob::fields() const
+{
+    return d->fields;
+}
+
+void FolderTreeFetchJob::start()
+{
+    d->pendingFolders.clear();
+    d->levels.clear();
+    d->visitedFolders.clear();
+    d->runningRequests = 0;
+    d->fetchedDepth = 0;
+
+    if (d->folderIds.isEmpty()) {
+        emitFinished();
+        return;
+    }
+
+    if (!d->fields.isEmpty()) {
+        // Walking the tree requires these
+        QStringList fields = d->fields;
+        for (const auto &field : {File::Fields::Kind, File::Fields::Id, File::Fields::MimeType}) {
+            if (!fields.contains(field)) {
+                fields << field;
+            }
+        }
+        Job::setFields({File::Fields::Kind, File::Fields::NextLink, File::Fields::NextPageToken, Job::buildSubfields(File::Fields::Items, fields)});
+    }
+
+    for (const auto &folderId : std::as_const(d->folderIds)) {
+        if (!d->visitedFolders.contains(folderId)) {
+            d->visitedFolders.insert(folderId);
+            d->pendingFolders[1] << folderId;
+        }
+    }
+    d->levels.insert(1, {});
+    d->scheduleRequests();
+}
+
+ObjectsList FolderTreeFetchJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
+{
+    --d->runningRequests;
+
+    const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
+    ContentType ct = Utils::stringToContentType(contentType);
+    if (ct != KGAPI2::JSON) {
+        setError(KGAPI2::InvalidResponse);
+        setErrorString(tr("Invalid response content type"));
+        emitFinished();
+        return {};
+    }
+
+    const int depth = reply->request().attribute(QNetworkRequest::User).toInt();
+
+    FeedData feedData;
+    const FilesList files = File::fromJSONFeed(rawData, feedData);
+
+    ObjectsList items;
+    items.reserve(files.size());
+    const bool descend = d->maxDepth == 0 || depth < d->maxDepth;
+    for (const auto &file : files) {
+        items << file;
+        if (descend && file->isFolder() && !d->visitedFolders.contains(file->id())) {
+            d->visitedFolders.insert(file->id());
+            d->pendingFolders[depth + 1] << file->id();
+            // Make sure the level is not considered complete before the query is sent
+            d->levels[depth + 1];
+        }
+    }
+    d->levels[depth].files << files;
+
+    if (feedData.nextPageUrl.isValid()) {
+        ++d->runningRequests;
+        QNetworkRequest request(feedData.nextPageUrl);
+        request.setAttribute(QNetworkRequest::User, depth);
+        enqueueRequest(request);
+    } else {
+        --d->levels[depth].runningQueries;
+    }
+
+    d->scheduleRequests();
+    d->emitFetchedLevels();
+
+    return items;
+}
+
+#include "moc_foldertreefetchjob.cpp"
@@ -0,0 +1,101 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "fetchjob.h"
+#include "kgapidrive_export.h"
+
+#include <QStringList>
+
+namespace KGAPI2
+{
+
+namespace Drive
+{
+
+/**
+ * @headerfile foldertreefetchjob.h
+ * @brief Recursively fetches content of folders
+ *
+ * The job walks the folder tree breadth-first. Children of many folders are
+ * fetched with a single query, and up to maxParallelRequests() queries run
+ * at the same time. Trashed files are not fetched.
+ *
+ * Files are delivered page by page through FetchJob::itemsReceived(), and
+ * level by level through levelFetched(). Use the parents of the files to
+ * rebuild the tree.
+ *
+ * @since 6.4
+ */
+class KGAPIDRIVE_EXPORT FolderTreeFetchJob : public KGAPI2::FetchJob
+{
+    Q_OBJECT
+
+    /**
+     * Number of levels of the tree to fetch.
+     *
+     * Default value is 0, i.e. the whole tree.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(int maxDepth READ maxDepth WRITE setMaxDepth)
+
+    /**
+     * Maximum number of requests running at the same time.
+     *
+     * Default value is 4.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(int maxParallelRequests READ maxParallelRequests WRITE setMaxParallelRequests)
+
+public:
+    explicit FolderTreeFetchJob(const QString &folderId, const AccountPtr &account, QObject *parent = nullptr);
+    explicit FolderTreeFetchJob(const QStringList &folderIds, const AccountPtr &account, QObject *parent = nullptr);
+    ~FolderTreeFetchJob() override;
+
+    [[nodiscard]] int maxDepth() const;
+    void setMaxDepth(int maxDepth);
+
+    [[nodiscard]] int maxParallelRequests() const;
+    void setMaxParallelRequests(int maxParallelRequests);
+
+    /**
+     * @brief Sets fields of the files to fetch
+     *
+     * Fields needed to walk the tree are always fetched.
+     */
+    void setFields(const QStringList &fields);
+    [[nodiscard]] QStringList fields() const;
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when all files on level @p depth have been fetched
+     *
+     * Direct children of the initial folders are on level 1.
+     *
+     * @param job The job that emitted the signal
+     * @param depth
+     * @param files All files on the level
+     */
+    void levelFetched(KGAPI2::Drive::FolderTreeFetchJob *job, int depth, const KGAPI2::Drive::FilesList &files);
+
+protected:
+    void start() override;
+    KGAPI2::ObjectsList handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData) override;
+
+private:
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace Drive
+
+} // namespace KGAPI2
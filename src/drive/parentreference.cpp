@@ -6,6 +6,7 @@
 
 #include "parentreference.h"
 #include "parentreference_p.h"
+#include "private/jsonwriter_p.h"
 #include "utils_p.h"
 
 #include <QJsonDocument>
@@ -41,23 +42,22 @@ ParentReferencePtr ParentReference::Private::fromJSON(const QVariantMap &map)
     return reference;
 }
 
-QVariantMap ParentReference::Private::toJSON(const ParentReferencePtr &reference)
+void ParentReference::Private::toJSON(JsonWriter &writer, const ParentReferencePtr &reference)
 {
-    QVariantMap map;
+    writer.beginObject();
     if (!reference->d->id.isEmpty()) {
-        map[QStringLiteral("id")] = reference->id();
+        writer.insert("id", reference->d->id);
     }
     if (!reference->d->selfLink.isEmpty()) {
-        map[QStringLiteral("selfLink")] = reference->d->selfLink;
+        writer.insert("selfLink", reference->d->selfLink.toString(QUrl::FullyEncoded));
     }
     if (!reference->d->parentLink.isEmpty()) {
-        map[QStringLiteral("parentLink")] = reference->d->parentLink;
+        writer.insert("parentLink", reference->d->parentLink.toString(QUrl::FullyEncoded));
     }
     if (reference->d->isRoot) { // default is false
-        map[QStringLiteral("isRoot")] = reference->d->isRoot;
+        writer.insert("isRoot", true);
     }
-
-    return map;
+    writer.endObject();
 }
 
 ParentReference::ParentReference(const QString &id)
@@ -149,8 +149,7 @@ ParentReferencesList ParentReference::fromJSONFeed(const QByteArray &jsonData)
 
 QByteArray ParentReference::toJSON(const ParentReferencePtr &reference)
 {
-    const QVariantMap map = Private::toJSON(reference);
-
-    QJsonDocument document = QJsonDocument::fromVariant(map);
-    return document.toJson(QJsonDocument::Compact);
+    JsonWriter writer(128);
+    Private::toJSON(writer, reference);
+    return writer.data();
 }
@@ -15,6 +15,8 @@
 namespace KGAPI2
 {
 
+class JsonWriter;
+
 namespace Drive
 {
 
@@ -30,7 +32,7 @@ public:
     bool isRoot;
 
     static ParentReferencePtr fromJSON(const QVariantMap &map);
-    static QVariantMap toJSON(const ParentReferencePtr &reference);
+    static void toJSON(JsonWriter &writer, const ParentReferencePtr &reference);
 };
 
 } // namespace Drive
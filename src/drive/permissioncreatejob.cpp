@@ -7,8 +7,10 @@
  */
 
 #include "permissioncreatejob.h"
+#include "debug.h"
 #include "driveservice.h"
 #include "permission.h"
+#include "private/batchrequest_p.h"
 #include "utils.h"
 
 #include <QNetworkReply>
@@ -29,6 +31,7 @@ class Q_DECL_HIDDEN PermissionCreateJob::Private
 public:
     Private(PermissionCreateJob *parent);
     void processNext();
+    QUrl createUrl() const;
 
     PermissionsList permissions;
     QString fileId;
@@ -37,6 +40,10 @@ public:
     bool supportsAllDrives = true;
     bool useDomainAdminAccess;
 
+    int batchSize = 1;
+    int currentBatchSize = 0;
+    ItemResultsList itemResults;
+
 private:
     PermissionCreateJob *const q;
 };
@@ -55,8 +62,28 @@ void PermissionCreateJob::Private::processNext()
         return;
     }
 
+    if (batchSize > 1) {
+        BatchRequest batch(DriveService::batchUrl());
+        const QUrl url = createUrl();
+        const PermissionsList batchPermissions = permissions.mid(0, batchSize);
+        permissions.remove(0, batchPermissions.size());
+        for (const PermissionPtr &permission : batchPermissions) {
+            batch.addRequest("POST", url, Permission::toJSON(permission), QStringLiteral("application/json"));
+        }
+        currentBatchSize = batch.count();
+        q->enqueueRequest(batch.request(), batch.data(), batch.contentType());
+        return;
+    }
+
     const PermissionPtr permission = permissions.takeFirst();
+    QNetworkRequest request(createUrl());
+
+    const QByteArray rawData = Permission::toJSON(permission);
+    q->enqueueRequest(request, rawData, QStringLiteral("application/json"));
+}
 
+QUrl PermissionCreateJob::Private::createUrl() const
+{
     QUrl url = DriveService::createPermissionUrl(fileId);
 
     QUrlQuery query(url);
@@ -75,10 +102,7 @@ void PermissionCreateJob::Private::processNext()
     }
 
     url.setQuery(query);
-    QNetworkRequest request(url);
-
-    const QByteArray rawData = Permission::toJSON(permission);
-    q->enqueueRequest(request, rawData, QStringLiteral("application/json"));
+    return url;
 }
 
 PermissionCreateJob::PermissionCreateJob(const QString &fileId, const PermissionPtr &permission, const AccountPtr &account, QObject *parent)
@@ -139,6 +163,32 @@ void PermissionCreateJob::setUseDomainAdminAccess(bool useDomainAdminAccess)
     d->useDomainAdminAccess = useDomainAdminAccess;
 }
 
+void PermissionCreateJob::setBatchSize(int batchSize)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify batchSize property when job is running";
+        return;
+    }
+
+    d->batchSize = qBound(1, batchSize, BatchRequest::MaxBatchSize);
+}
+
+int PermissionCreateJob::batchSize() const
+{
+    return d->batchSize;
+}
+
+ItemResultsList PermissionCreateJob::itemResults() const
+{
+    return d->itemResults;
+}
+
+void PermissionCreateJob::aboutToStart()
+{
+    d->itemResults.clear();
+    CreateJob::aboutToStart();
+}
+
 void PermissionCreateJob::start()
 {
     d->processNext();
@@ -147,10 +197,40 @@ void PermissionCreateJob::start()
 ObjectsList PermissionCreateJob::handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData)
 {
     const QString contentType = reply->header(QNetworkRequest::ContentTypeHeader).toString();
-    ContentType ct = Utils::stringToContentType(contentType);
     ObjectsList items;
+
+    if (d->batchSize > 1) {
+        if (!BatchRequest::isBatchResponse(contentType)) {
+            setError(KGAPI2::InvalidResponse);
+            setErrorString(tr("Invalid response content type"));
+            emitFinished();
+            return items;
+        }
+
+        const ItemResult failure = BatchRequest::appendResults(
+            contentType,
+            rawData,
+            d->currentBatchSize,
+            d->itemResults,
+            [](const QByteArray &body) -> ObjectPtr {
+                return Permission::fromJSON(body);
+            },
+            &items);
+        if (failure.error != KGAPI2::NoError) {
+            setError(failure.error);
+            setErrorString(failure.errorString);
+        }
+
+        // Enqueue next batch or finish
+        d->processNext();
+
+        return items;
+    }
+
+    ContentType ct = Utils::stringToContentType(contentType);
     if (ct == KGAPI2::JSON) {
         items << Permission::fromJSON(rawData);
+        d->itemResults << ItemResult{items.constLast(), KGAPI2::NoError, QString()};
     } else {
         setError(KGAPI2::InvalidResponse);
         setErrorString(tr("Invalid response content type"));
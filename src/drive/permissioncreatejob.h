@@ -21,6 +21,22 @@ class KGAPIDRIVE_EXPORT PermissionCreateJob : public KGAPI2::CreateJob
 {
     Q_OBJECT
 
+    /**
+     * @brief Number of permissions created in a single request
+     *
+     * When larger than 1, permissions are created through the Drive batch
+     * endpoint in groups of up to batchSize permissions, instead of one request
+     * per permission. Results of the individual permissions are available through
+     * itemResults().
+     *
+     * Defaults to 1, the maximum is 100. This property can be modified only
+     * when the job is not running.
+     *
+     * @see setBatchSize, batchSize
+     * @since 6.4
+     */
+    Q_PROPERTY(int batchSize READ batchSize WRITE setBatchSize)
+
 public:
     explicit PermissionCreateJob(const QString &fileId, const PermissionPtr &permission, const AccountPtr &account, QObject *parent = nullptr);
     explicit PermissionCreateJob(const QString &fileId, const PermissionsList &permissions, const AccountPtr &account, QObject *parent = nullptr);
@@ -86,7 +102,34 @@ public:
      */
     void setUseDomainAdminAccess(bool useDomainAdminAccess);
 
+    /**
+     * @brief Sets number of permissions to create in a single batch request
+     *
+     * @param batchSize Number of permissions per request, between 1 and 100.
+     * @since 6.4
+     */
+    void setBatchSize(int batchSize);
+
+    /**
+     * @brief Returns number of permissions created in a single batch request
+     * @since 6.4
+     */
+    [[nodiscard]] int batchSize() const;
+
+    /**
+     * @brief Returns results of the individual permissions
+     *
+     * The results are in the same order as the permissions passed to the
+     * constructor. In batch mode a failure of a single permission does not stop
+     * the job, error() then reports the first failure and the result of
+     * every permission is available here.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] ItemResultsList itemResults() const;
+
 protected:
+    void aboutToStart() override;
     void start() override;
     KGAPI2::ObjectsList handleReplyWithItems(const QNetworkReply *reply, const QByteArray &rawData) override;
 
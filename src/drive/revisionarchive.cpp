@@ -0,0 +1,15 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "revisionarchive.h"
+
+using namespace KGAPI2::Drive;
+
+RevisionArchive::RevisionArchive() = default;
+
+RevisionArchive::~RevisionArchive() = default;
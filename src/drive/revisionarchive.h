@@ -0,0 +1,83 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "kgapidrive_export.h"
+#include "types.h"
+
+#include <QString>
+
+class QIODevice;
+
+namespace KGAPI2
+{
+
+namespace Drive
+{
+
+/**
+ * @headerfile revisionarchive.h
+ * @brief Destination of revisions downloaded by RevisionArchiveJob
+ *
+ * The archive is implemented by the application, it decides where the
+ * content of each revision is stored and remembers which revisions have
+ * already been archived, so that repeated runs of the job download only new
+ * revisions and resume downloads that have been interrupted.
+ *
+ * Methods of the archive are called from the thread of the job.
+ *
+ * @since 6.4
+ */
+class KGAPIDRIVE_EXPORT RevisionArchive
+{
+public:
+    virtual ~RevisionArchive();
+
+    /**
+     * @brief Returns whether content with checksum @p md5Checksum is archived
+     *
+     * Revisions whose content is already in the archive are not downloaded.
+     * Only called for revisions that have a checksum.
+     */
+    [[nodiscard]] virtual bool containsChecksum(const QString &md5Checksum) const = 0;
+
+    /**
+     * @brief Returns device to write content of @p revision of file @p fileId to
+     *
+     * The device must be open for writing and stay valid until close() is
+     * called. To resume an interrupted download, set @p offset to the number
+     * of bytes of the content already written and return the device
+     * positioned right after them. Return a null pointer to skip the
+     * revision.
+     *
+     * When the device is also open for reading and is not sequential, the
+     * downloaded content is read back and compared with the checksum of the
+     * revision before the revision is reported as archived.
+     */
+    virtual QIODevice *open(const QString &fileId, const RevisionPtr &revision, qint64 &offset) = 0;
+
+    /**
+     * @brief Releases device returned by open()
+     *
+     * When @p completed is false the download has failed, the first
+     * @p completedOffset bytes of the content have been written to the
+     * device and the download can be resumed from there by the next run.
+     */
+    virtual void close(const QString &fileId, const RevisionPtr &revision, QIODevice *device, qint64 completedOffset, bool completed) = 0;
+
+protected:
+    explicit RevisionArchive();
+
+private:
+    Q_DISABLE_COPY(RevisionArchive)
+};
+
+} // namespace Drive
+
+} // namespace KGAPI2
@@ -0,0 +1,343 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "revisionarchivejob.h"
+#include "debug.h"
+#include "filefetchcontentjob.h"
+#include "revision.h"
+#include "revisionarchive.h"
+#include "revisionfetchjob.h"
+
+#include <QCryptographicHash>
+#include <QIODevice>
+#include <QQueue>
+
+using namespace KGAPI2;
+using namespace KGAPI2::Drive;
+
+class Q_DECL_HIDDEN RevisionArchiveJob::Private
+{
+public:
+    Private(RevisionArchiveJob *parent);
+
+    struct Download {
+        QString fileId;
+        RevisionPtr revision;
+    };
+
+    void startNext();
+    void startListing(const QString &fileId);
+    void listingFinished(const QString &fileId, RevisionFetchJob *job);
+    void startDownload(const Download &download);
+    void downloadFinished(const Download &download, QIODevice *device, FileFetchContentJob *job);
+    bool verify(const Download &download, QIODevice *device, qint64 completedOffset);
+    void archived(const Download &download);
+    void fail(const QString &fileId, const QString &revisionId, Job *job);
+    void fail(const QString &fileId, const QString &revisionId, KGAPI2::Error error, const QString &errorString);
+
+    QStringList fileIds;
+    RevisionArchive *archive = nullptr;
+    QDateTime modifiedSince;
+    int maxParallelJobs = 4;
+
+    QMultiMap<QString, QString> failedRevisions;
+    QMultiMap<QString, QString> skippedRevisions;
+
+    QQueue<QString> pendingFiles;
+    QQueue<Download> pendingDownloads;
+    int runningJobs = 0;
+    int processedRevisions = 0;
+    int totalRevisions = 0;
+    KGAPI2::Error lastError = KGAPI2::NoError;
+    QString lastErrorString;
+
+private:
+    RevisionArchiveJob *const q;
+};
+
+RevisionArchiveJob::Private::Private(RevisionArchiveJob *parent)
+    : q(parent)
+{
+}
+
+void RevisionArchiveJob::Private::startNext()
+{
+    // Downloads go first, so that listings don't pile up revisions
+    while (runningJobs < maxParallelJobs) {
+        if (!pendingDownloads.isEmpty()) {
+            startDownload(pendingDownloads.dequeue());
+        } else if (!pendingFiles.isEmpty()) {
+            startListing(pendingFiles.dequeue());
+        } else {
+            break;
+        }
+    }
+
+    if (runningJobs > 0) {
+        return;
+    }
+
+    if (!failedRevisions.isEmpty()) {
+        q->setError(lastError);
+        q->setErrorString(lastErrorString);
+    }
+    q->emitFinished();
+}
+
+void RevisionArchiveJob::Private::startListing(const QString &fileId)
+{
+    auto job = new RevisionFetchJob(fileId, q->account(), q);
+    QObject::connect(job, &Job::finished, q, [this, fileId](Job *job) {
+        listingFinished(fileId, static_cast<RevisionFetchJob *>(job));
+    });
+    ++runningJobs;
+}
+
+void RevisionArchiveJob::Private::listingFinished(const QString &fileId, RevisionFetchJob *job)
+{
+    --runningJobs;
+    job->deleteLater();
+
+    if (job->error() != KGAPI2::NoError) {
+        fail(fileId, QString(), job);
+        startNext();
+        return;
+    }
+
+    const ObjectsList items = job->items();
+    for (const ObjectPtr &item : items) {
+        const RevisionPtr revision = item.dynamicCast<Revision>();
+        if (!revision || (modifiedSince.isValid() && revision->modifiedDate() < modifiedSince)) {
+            continue;
+        }
+        if (revision->downloadUrl().isEmpty()) {
+            qCDebug(KGAPIDebug) << "Revision" << revision->id() << "of" << fileId << "can't be downloaded";
+            skippedRevisions.insert(fileId, revision->id());
+            continue;
+        }
+        if (!revision->md5Checksum().isEmpty() && archive->containsChecksum(revision->md5Checksum())) {
+            skippedRevisions.insert(fileId, revision->id());
+            continue;
+        }
+        pendingDownloads.enqueue({fileId, revision});
+        ++totalRevisions;
+    }
+
+    startNext();
+}
+
+void RevisionArchiveJob::Private::startDownload(const Download &download)
+{
+    qint64 offset = 0;
+    QIODevice *device = archive->open(download.fileId, download.revision, offset);
+    if (!device) {
+        skippedRevisions.insert(download.fileId, download.revision->id());
+        ++processedRevisions;
+        return;
+    }
+
+    // Interrupted right before the archive was told the download has finished
+    if (download.revision->fileSize() > 0 && offset >= download.revision->fileSize()) {
+        if (verify(download, device, offset)) {
+            archive->close(download.fileId, download.revision, device, offset, true);
+            archived(download);
+        }
+        return;
+    }
+
+    auto job = new FileFetchContentJob(download.revision->downloadUrl(), q->account(), q);
+    job->setDevice(device);
+    job->setStartOffset(offset);
+    QObject::connect(job, &Job::finished, q, [this, download, device](Job *job) {
+        downloadFinished(download, device, static_cast<FileFetchContentJob *>(job));
+    });
+    ++runningJobs;
+}
+
+void RevisionArchiveJob::Private::downloadFinished(const Download &download, QIODevice *device, FileFetchContentJob *job)
+{
+    --runningJobs;
+    job->deleteLater();
+
+    if (job->error() == KGAPI2::NoError) {
+        if (verify(download, device, job->completedOffset())) {
+            archive->close(download.fileId, download.revision, device, job->completedOffset(), true);
+            archived(download);
+        }
+    } else {
+        archive->close(download.fileId, download.revision, device, job->completedOffset(), false);
+        fail(download.fileId, download.revision->id(), job);
+        ++processedRevisions;
+        q->emitProgress(processedRevisions, totalRevisions);
+    }
+
+    startNext();
+}
+
+bool RevisionArchiveJob::Private::verify(const Download &download, QIODevice *device, qint64 completedOffset)
+{
+    const RevisionPtr &revision = download.revision;
+    if (revision->fileSize() > 0 && completedOffset != revision->fileSize()) {
+        // A short download is resumed by the next run, a longer one can't be
+        archive->close(download.fileId, revision, device, completedOffset < revision->fileSize() ? completedOffset : 0, false);
+        fail(download.fileId,
+             revision->id(),
+             KGAPI2::InvalidResponse,
+             RevisionArchiveJob::tr("Downloaded %1 of %2 bytes of the revision").arg(completedOffset).arg(revision->fileSize()));
+        ++processedRevisions;
+        q->emitProgress(processedRevisions, totalRevisions);
+        return false;
+    }
+
+    // Devices the archive does not read back from can't be checked
+    if (revision->md5Checksum().isEmpty() || !device->isReadable() || device->isSequential()) {
+        return true;
+    }
+
+    const qint64 position = device->pos();
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    bool ok = device->seek(0);
+    for (qint64 remaining = completedOffset; ok && remaining > 0;) {
+        const QByteArray data = device->read(qMin<qint64>(remaining, 64 * 1024));
+        ok = !data.isEmpty();
+        hash.addData(data);
+        remaining -= data.size();
+    }
+    device->seek(position);
+
+    const QString checksum = QString::fromLatin1(hash.result().toHex());
+    if (ok && checksum.compare(revision->md5Checksum(), Qt::CaseInsensitive) == 0) {
+        return true;
+    }
+
+    // The content is corrupted, so it can't be resumed either
+    archive->close(download.fileId, revision, device, 0, false);
+    fail(download.fileId,
+         revision->id(),
+         KGAPI2::InvalidResponse,
+         ok ? RevisionArchiveJob::tr("Checksum of the downloaded revision does not match") : RevisionArchiveJob::tr("Failed to read back the downloaded revision"));
+    ++processedRevisions;
+    q->emitProgress(processedRevisions, totalRevisions);
+    return false;
+}
+
+void RevisionArchiveJob::Private::archived(const Download &download)
+{
+    ++processedRevisions;
+    q->emitProgress(processedRevisions, totalRevisions);
+    Q_EMIT q->revisionArchived(q, download.fileId, download.revision);
+}
+
+void RevisionArchiveJob::Private::fail(const QString &fileId, const QString &revisionId, Job *job)
+{
+    fail(fileId, revisionId, job->error(), job->errorString());
+}
+
+void RevisionArchiveJob::Private::fail(const QString &fileId, const QString &revisionId, KGAPI2::Error error, const QString &errorString)
+{
+    qCWarning(KGAPIDebug) << "Failed to archive revision" << revisionId << "of" << fileId << ":" << errorString;
+    failedRevisions.insert(fileId, revisionId);
+    lastError = error;
+    lastErrorString = errorString;
+}
+
+RevisionArchiveJob::RevisionArchiveJob(const QStringList &fileIds, RevisionArchive *archive, const AccountPtr &account, QObject *parent)
+    : Job(account, parent)
+    , d(new Private(this))
+{
+    d->fileIds = fileIds;
+    d->archive = archive;
+}
+
+RevisionArchiveJob::~RevisionArchiveJob()
+{
+    delete d;
+}
+
+QDateTime RevisionArchiveJob::modifiedSince() const
+{
+    return d->modifiedSince;
+}
+
+void RevisionArchiveJob::setModifiedSince(const QDateTime &modifiedSince)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify modifiedSince property when job is running";
+        return;
+    }
+
+    d->modifiedSince = modifiedSince;
+}
+
+int RevisionArchiveJob::maxParallelJobs() const
+{
+    return d->maxParallelJobs;
+}
+
+void RevisionArchiveJob::setMaxParallelJobs(int maxParallelJobs)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify maxParallelJobs property when job is running";
+        return;
+    }
+
+    d->maxParallelJobs = qMax(maxParallelJobs, 1);
+}
+
+QMultiMap<QString, QString> RevisionArchiveJob::failedRevisions() const
+{
+    return d->failedRevisions;
+}
+
+QMultiMap<QString, QString> RevisionArchiveJob::skippedRevisions() const
+{
+    return d->skippedRevisions;
+}
+
+void RevisionArchiveJob::start()
+{
+    d->failedRevisions.clear();
+    d->skippedRevisions.clear();
+    d->pendingFiles.clear();
+    d->pendingDownloads.clear();
+    d->runningJobs = 0;
+    d->processedRevisions = 0;
+    d->totalRevisions = 0;
+    d->lastError = KGAPI2::NoError;
+    d->lastErrorString.clear();
+
+    if (!d->archive) {
+        qCWarning(KGAPIDebug) << "No archive to store the revisions to";
+        setError(KGAPI2::UnknownError);
+        setErrorString(tr("No archive to store the revisions to"));
+        emitFinished();
+        return;
+    }
+
+    for (const auto &fileId : std::as_const(d->fileIds)) {
+        d->pendingFiles.enqueue(fileId);
+    }
+    d->startNext();
+}
+
+void RevisionArchiveJob::dispatchRequest(QNetworkAccessManager * /*accessManager*/,
+                                         const QNetworkRequest & /*request*/,
+                                         const QByteArray & /*data*/,
+                                         const QString & /*contentType*/)
+{
+    // Should never be called.
+    Q_UNREACHABLE();
+}
+
+void RevisionArchiveJob::handleReply(const QNetworkReply * /*reply*/, const QByteArray & /*rawData*/)
+{
+    // Should never be called.
+    Q_UNREACHABLE();
+}
+
+#include "moc_revisionarchivejob.cpp"
@@ -0,0 +1,129 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "job.h"
+#include "kgapidrive_export.h"
+
+#include <QDateTime>
+#include <QMultiMap>
+#include <QStringList>
+
+namespace KGAPI2
+{
+
+namespace Drive
+{
+
+class RevisionArchive;
+
+/**
+ * @headerfile revisionarchivejob.h
+ * @brief Downloads revisions of files to a RevisionArchive
+ *
+ * The job lists revisions of the files with RevisionFetchJob and downloads
+ * content of each revision with FileFetchContentJob straight to the device
+ * returned by RevisionArchive::open(), so the content is never held in
+ * memory as a whole. Up to maxParallelJobs of the listings and downloads
+ * run at the same time.
+ *
+ * Revisions whose checksum is already in the archive are skipped, and
+ * downloads the archive has kept partially are resumed, so running the job
+ * again archives only what is missing. Revisions that can only be exported,
+ * i.e. revisions of Google Docs, Sheets and Slides, have no downloadable
+ * content and are skipped as well.
+ *
+ * A revision is reported as archived only when the size of the downloaded
+ * content matches the size of the revision and, if the archive device can
+ * be read back, its MD5 checksum matches as well.
+ *
+ * A revision that could not be archived does not abort archiving of the
+ * others. The job finishes with the error of the last failure in that case,
+ * see failedRevisions().
+ *
+ * @since 6.4
+ */
+class KGAPIDRIVE_EXPORT RevisionArchiveJob : public KGAPI2::Job
+{
+    Q_OBJECT
+
+    /**
+     * Only revisions modified at or after this date are archived.
+     *
+     * Default value is an invalid date, i.e. all revisions.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(QDateTime modifiedSince READ modifiedSince WRITE setModifiedSince)
+
+    /**
+     * Maximum number of listings and downloads running at the same time.
+     *
+     * Default value is 4.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(int maxParallelJobs READ maxParallelJobs WRITE setMaxParallelJobs)
+
+public:
+    /**
+     * @brief Constructs a job archiving revisions of files @p fileIds to @p archive
+     *
+     * The job does not take ownership of the @p archive, which must outlive
+     * the job.
+     */
+    explicit RevisionArchiveJob(const QStringList &fileIds, RevisionArchive *archive, const AccountPtr &account, QObject *parent = nullptr);
+    ~RevisionArchiveJob() override;
+
+    [[nodiscard]] QDateTime modifiedSince() const;
+    void setModifiedSince(const QDateTime &modifiedSince);
+
+    [[nodiscard]] int maxParallelJobs() const;
+    void setMaxParallelJobs(int maxParallelJobs);
+
+    /**
+     * @brief Returns IDs of revisions that could not be archived by ID of the file
+     *
+     * When the revisions of a file could not be listed, the file is listed
+     * with an empty revision ID.
+     */
+    [[nodiscard]] QMultiMap<QString, QString> failedRevisions() const;
+
+    /**
+     * @brief Returns IDs of revisions that have been skipped by ID of the file
+     *
+     * Revisions are skipped when they are already in the archive, when they
+     * cannot be downloaded or when the archive refused to store them.
+     */
+    [[nodiscard]] QMultiMap<QString, QString> skippedRevisions() const;
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when @p revision of file @p fileId has been archived
+     *
+     * @param job The job that emitted the signal
+     * @param fileId
+     * @param revision
+     */
+    void revisionArchived(KGAPI2::Drive::RevisionArchiveJob *job, const QString &fileId, const KGAPI2::Drive::RevisionPtr &revision);
+
+protected:
+    void start() override;
+    void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType) override;
+    void handleReply(const QNetworkReply *reply, const QByteArray &rawData) override;
+
+private:
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace Drive
+
+} // namespace KGAPI2
@@ -9,6 +9,9 @@
 
 #include <QDateTime>
 #include <QString>
+#include <QUrl>
+
+#include <algorithm>
 
 using namespace KGAPI2;
 using namespace KGAPI2::Drive;
@@ -22,6 +25,7 @@ public:
 
     static QString compareOperatorToString(CompareOperator op);
     static QString logicOperatorToString(LogicOperator op);
+    static int encodedLength(const QString &query);
 
     QList<SearchQuery> subqueries;
     QString field;
@@ -70,6 +74,11 @@ QString SearchQuery::Private::logicOperatorToString(SearchQuery::LogicOperator o
     return QString();
 }
 
+int SearchQuery::Private::encodedLength(const QString &query)
+{
+    return QUrl::toPercentEncoding(query).size();
+}
+
 SearchQuery::SearchQuery(SearchQuery::LogicOperator op)
     : d(new Private)
 {
@@ -129,3 +138,74 @@ QString SearchQuery::serialize() const
 
     return r;
 }
+
+QList<SearchQuery> SearchQuery::split(int maxLength) const
+{
+    const int length = Private::encodedLength(serialize());
+    if (length <= maxLength || d->subqueries.isEmpty()) {
+        return {*this};
+    }
+
+    QList<SearchQuery> queries;
+    if (d->logicOp == Or) {
+        // Pack the alternatives into as few queries as possible
+        const int separatorLength = Private::encodedLength(Private::logicOperatorToString(Or));
+        SearchQuery current(Or);
+        int currentLength = 2; // parentheses
+        for (const auto &subquery : std::as_const(d->subqueries)) {
+            const auto pieces = subquery.split(maxLength - 2);
+            for (const auto &piece : pieces) {
+                const int pieceLength = Private::encodedLength(piece.serialize());
+                if (!current.isEmpty() && currentLength + separatorLength + pieceLength > maxLength) {
+                    queries << current;
+                    current = SearchQuery(Or);
+                    currentLength = 2;
+                }
+                if (!current.isEmpty()) {
+                    currentLength += separatorLength;
+                }
+                current.addQuery(piece);
+                currentLength += pieceLength;
+            }
+        }
+        queries << current;
+        return queries;
+    }
+
+    // (A or B) and C is (A and C) or (B and C), split the longest disjunction
+    // that can be split
+    // Lengths of the subqueries by their index, each is serialized only once
+    QList<std::pair<int, int>> candidates;
+    for (int i = 0; i < d->subqueries.size(); ++i) {
+        const auto &subquery = d->subqueries.at(i);
+        if (!subquery.d->subqueries.isEmpty()) {
+            candidates.append({Private::encodedLength(subquery.serialize()), i});
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const auto &a, const auto &b) {
+        return a.first > b.first;
+    });
+
+    int index = -1;
+    QList<SearchQuery> pieces;
+    for (const auto &[subqueryLength, candidate] : std::as_const(candidates)) {
+        pieces = d->subqueries.at(candidate).split(maxLength - (length - subqueryLength));
+        if (pieces.size() > 1) {
+            index = candidate;
+            break;
+        }
+    }
+    if (index < 0) {
+        return {*this};
+    }
+
+    for (const auto &piece : pieces) {
+        SearchQuery query(And);
+        for (int i = 0; i < d->subqueries.size(); ++i) {
+            query.addQuery(i == index ? piece : d->subqueries.at(i));
+        }
+        // Another disjunction may still be too long
+        queries << query.split(maxLength);
+    }
+    return queries;
+}
@@ -9,6 +9,7 @@
 
 #include "kgapidrive_export.h"
 
+#include <QList>
 #include <QSharedDataPointer>
 #include <QVariant>
 
@@ -38,8 +39,36 @@ public:
 
     [[nodiscard]] bool isEmpty() const;
 
+    /**
+     * @brief Serializes the query
+     */
     [[nodiscard]] QString serialize() const;
 
+    /**
+     * @brief Splits the query into queries that fit into @p maxLength
+     *
+     * Files matching any of the returned queries match this query. The
+     * disjunctions of the query are divided so that the percent-encoded
+     * serialization of each returned query is at most @p maxLength characters
+     * long where possible. A query that already fits, or that cannot be split,
+     * is returned as it is.
+     *
+     * Results of the returned queries can overlap.
+     *
+     * To pick the disjunction to divide, each subquery is serialized only
+     * once to measure its length.
+     *
+     * @since 6.4
+     */
+    [[nodiscard]] QList<SearchQuery> split(int maxLength = MaxLength) const;
+
+    /**
+     * Default maximum length of a percent-encoded query used by split()
+     *
+     * @since 6.4
+     */
+    static constexpr int MaxLength = 4096;
+
 private:
     class Private;
     QSharedDataPointer<Private> d;
@@ -14,6 +14,7 @@
 
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QSet>
 #include <QUrlQuery>
 
 namespace
@@ -37,6 +38,10 @@ public:
 
     QStringList fields;
 
+    // IDs of items returned so far when the query was split
+    QSet<QString> fetchedIds;
+    bool isSplit = false;
+
 private:
     TeamdriveFetchJob *const q;
 };
@@ -116,19 +121,31 @@ QStringList TeamdriveFetchJob::fields() const
 
 void TeamdriveFetchJob::start()
 {
-    QUrl url;
+    d->fetchedIds.clear();
+    d->isSplit = false;
+
     if (d->teamdriveId.isEmpty()) {
-        url = DriveService::fetchTeamdrivesUrl();
-        applyRequestParameters(url);
-    } else {
-        url = DriveService::fetchTeamdriveUrl(d->teamdriveId);
-        if (!d->fields.isEmpty()) {
-            // Deserializing requires kind attribute, always force add it
-            if (!d->fields.contains(Teamdrive::Fields::Kind)) {
-                d->fields << Teamdrive::Fields::Kind;
-            }
-            Job::setFields(d->fields);
+        // Overly long queries are rejected, run them in parts
+        const QList<SearchQuery> queries = d->searchQuery.split();
+        d->isSplit = queries.size() > 1;
+        if (d->isSplit) {
+            qCDebug(KGAPIDebug) << "Splitting search query into" << queries.size() << "queries";
+        }
+        for (const auto &query : queries) {
+            QUrl url = DriveService::fetchTeamdrivesUrl();
+            applyRequestParameters(url, query.serialize());
+            enqueueRequest(QNetworkRequest(url));
+        }
+        return;
+    }
+
+    QUrl url = DriveService::fetchTeamdriveUrl(d->teamdriveId);
+    if (!d->fields.isEmpty()) {
+        // Deserializing requires kind attribute, always force add it
+        if (!d->fields.contains(Teamdrive::Fields::Kind)) {
+            d->fields << Teamdrive::Fields::Kind;
         }
+        Job::setFields(d->fields);
     }
 
     QNetworkRequest request(url);
@@ -146,7 +163,17 @@ ObjectsList TeamdriveFetchJob::handleReplyWithItems(const QNetworkReply *reply,
     ContentType ct = Utils::stringToContentType(contentType);
     if (ct == KGAPI2::JSON) {
         if (d->teamdriveId.isEmpty()) {
-            items << Teamdrive::fromJSONFeed(rawData, feedData);
+            const auto teamdrives = Teamdrive::fromJSONFeed(rawData, feedData);
+            for (const auto &teamdrive : teamdrives) {
+                // Results of the split queries may overlap
+                if (d->isSplit) {
+                    if (d->fetchedIds.contains(teamdrive->id())) {
+                        continue;
+                    }
+                    d->fetchedIds.insert(teamdrive->id());
+                }
+                items << teamdrive;
+            }
         } else {
             items << Teamdrive::fromJSON(rawData);
         }
@@ -159,7 +186,7 @@ ObjectsList TeamdriveFetchJob::handleReplyWithItems(const QNetworkReply *reply,
 
     if (feedData.nextPageUrl.isValid()) {
         // Reapply query options
-        applyRequestParameters(feedData.nextPageUrl);
+        applyRequestParameters(feedData.nextPageUrl, QUrlQuery(reply->url()).queryItemValue(QStringLiteral("q"), QUrl::FullyDecoded));
         QNetworkRequest request(feedData.nextPageUrl);
         enqueueRequest(request);
     }
@@ -167,7 +194,7 @@ ObjectsList TeamdriveFetchJob::handleReplyWithItems(const QNetworkReply *reply,
     return items;
 }
 
-void TeamdriveFetchJob::applyRequestParameters(QUrl &url)
+void TeamdriveFetchJob::applyRequestParameters(QUrl &url, const QString &searchQuery)
 {
     QUrlQuery query(url);
     if (d->maxResults != 0) {
@@ -176,8 +203,8 @@ void TeamdriveFetchJob::applyRequestParameters(QUrl &url)
     if (d->useDomainAdminAccess != false) {
         query.addQueryItem(UseDomainAdminAccessAttr, Utils::bool2Str(d->useDomainAdminAccess));
     }
-    if (!d->searchQuery.isEmpty()) {
-        query.addQueryItem(QStringLiteral("q"), d->searchQuery.serialize());
+    if (!searchQuery.isEmpty()) {
+        query.addQueryItem(QStringLiteral("q"), searchQuery);
     }
     if (!d->fields.isEmpty()) {
         // Deserializing requires kind attribute, always force add it
@@ -0,0 +1,163 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "thumbnailcache.h"
+#include "debug.h"
+
+#include <QBuffer>
+#include <QCache>
+#include <QDir>
+#include <QFile>
+#include <QMutex>
+#include <QSaveFile>
+#include <QUrl>
+
+using namespace KGAPI2;
+using namespace KGAPI2::Drive;
+
+class Q_DECL_HIDDEN ThumbnailCache::Private
+{
+public:
+    static QString filePrefix(const QString &fileId, int size)
+    {
+        // Underscores separate parts of the name
+        return QString::fromLatin1(QUrl::toPercentEncoding(fileId, QByteArray(), "_")) + QLatin1Char('_') + QString::number(size) + QLatin1Char('_');
+    }
+
+    static QString fileName(const QString &fileId, const QDateTime &modifiedDate, int size)
+    {
+        return filePrefix(fileId, size) + QString::number(modifiedDate.toMSecsSinceEpoch());
+    }
+
+    QString directory;
+    QCache<QString, QImage> images;
+    QMutex lock;
+};
+
+ThumbnailCache::ThumbnailCache(const QString &directory)
+    : d(new Private)
+{
+    d->directory = directory;
+    d->images.setMaxCost(DefaultMemoryLimit);
+}
+
+ThumbnailCache::~ThumbnailCache()
+{
+    delete d;
+}
+
+QString ThumbnailCache::directory() const
+{
+    return d->directory;
+}
+
+void ThumbnailCache::setMemoryLimit(qint64 bytes)
+{
+    QMutexLocker locker(&d->lock);
+    d->images.setMaxCost(qMax<qint64>(bytes, 0));
+}
+
+qint64 ThumbnailCache::memoryLimit() const
+{
+    QMutexLocker locker(&d->lock);
+    return d->images.maxCost();
+}
+
+QImage ThumbnailCache::find(const QString &fileId, const QDateTime &modifiedDate, int size, Lookup lookup)
+{
+    const QString key = Private::fileName(fileId, modifiedDate, size);
+    {
+        QMutexLocker locker(&d->lock);
+        if (const QImage *image = d->images.object(key)) {
+            return *image;
+        }
+    }
+
+    if (lookup == MemoryOnly || d->directory.isEmpty()) {
+        return {};
+    }
+
+    QFile file(d->directory + QLatin1Char('/') + key);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+    const QImage image = QImage::fromData(file.readAll());
+    if (image.isNull()) {
+        qCWarning(KGAPIDebug) << "Invalid thumbnail in cache" << file.fileName();
+        file.remove();
+        return {};
+    }
+
+    QMutexLocker locker(&d->lock);
+    d->images.insert(key, new QImage(image), image.sizeInBytes());
+    return image;
+}
+
+void ThumbnailCache::insert(const QString &fileId, const QDateTime &modifiedDate, int size, const QImage &image, const QByteArray &data)
+{
+    if (image.isNull()) {
+        return;
+    }
+
+    const QString key = Private::fileName(fileId, modifiedDate, size);
+    {
+        QMutexLocker locker(&d->lock);
+        d->images.insert(key, new QImage(image), image.sizeInBytes());
+    }
+
+    if (d->directory.isEmpty()) {
+        return;
+    }
+
+    QDir dir(d->directory);
+    if (!dir.mkpath(QStringLiteral("."))) {
+        qCWarning(KGAPIDebug) << "Failed to create thumbnail cache directory" << d->directory;
+        return;
+    }
+
+    // Thumbnails of older versions of the file
+    const auto staleFiles = dir.entryList({Private::filePrefix(fileId, size) + QLatin1Char('*')}, QDir::Files);
+    for (const auto &staleFile : staleFiles) {
+        if (staleFile != key) {
+            dir.remove(staleFile);
+        }
+    }
+
+    QByteArray encoded = data;
+    if (encoded.isEmpty()) {
+        QBuffer buffer(&encoded);
+        buffer.open(QIODevice::WriteOnly);
+        image.save(&buffer, "PNG");
+    }
+
+    QSaveFile file(dir.filePath(key));
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(KGAPIDebug) << "Failed to write thumbnail to" << file.fileName() << ":" << file.errorString();
+        return;
+    }
+    file.write(encoded);
+    if (!file.commit()) {
+        qCWarning(KGAPIDebug) << "Failed to write thumbnail to" << file.fileName() << ":" << file.errorString();
+    }
+}
+
+void ThumbnailCache::clear()
+{
+    {
+        QMutexLocker locker(&d->lock);
+        d->images.clear();
+    }
+
+    if (!d->directory.isEmpty()) {
+        QDir dir(d->directory);
+        const auto files = dir.entryList(QDir::Files);
+        for (const auto &file : files) {
+            dir.remove(file);
+        }
+    }
+}
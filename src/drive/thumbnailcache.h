@@ -0,0 +1,109 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "kgapidrive_export.h"
+
+#include <QDateTime>
+#include <QImage>
+#include <QString>
+
+namespace KGAPI2
+{
+
+namespace Drive
+{
+
+/**
+ * @headerfile thumbnailcache.h
+ * @brief Caches thumbnails of files
+ *
+ * Decoded thumbnails are kept in memory, the least recently used ones are
+ * dropped once they take more than memoryLimit(). The cache can be backed
+ * by a directory, where the thumbnails are kept as received from the server,
+ * so that they don't have to be fetched again by the next run of the
+ * application.
+ *
+ * Thumbnails are identified by ID and modification date of the file, a
+ * thumbnail of an older version of the file is never returned.
+ *
+ * All methods are thread-safe.
+ *
+ * @see ThumbnailFetchJob::setCache()
+ *
+ * @since 6.4
+ */
+class KGAPIDRIVE_EXPORT ThumbnailCache
+{
+public:
+    enum Lookup {
+        MemoryOnly, ///< Don't look into the backing directory
+        MemoryAndDisk, ///< Read and decode the thumbnail from the backing directory if it is not in memory
+    };
+
+    /// Default value of memoryLimit(), in bytes
+    static constexpr qint64 DefaultMemoryLimit = 64 * 1024 * 1024;
+
+    /**
+     * @brief Constructs a cache backed by directory @p directory
+     *
+     * The directory should not be used for anything else. When @p directory
+     * is empty the cache is kept in memory only.
+     */
+    explicit ThumbnailCache(const QString &directory = QString());
+
+    ~ThumbnailCache();
+
+    /**
+     * @brief Returns the backing directory
+     */
+    [[nodiscard]] QString directory() const;
+
+    /**
+     * @brief Sets maximum size of the decoded thumbnails kept in memory
+     *
+     * @param bytes Size in bytes
+     */
+    void setMemoryLimit(qint64 bytes);
+    [[nodiscard]] qint64 memoryLimit() const;
+
+    /**
+     * @brief Returns thumbnail of file @p fileId modified at @p modifiedDate
+     *
+     * @p size is the size of the thumbnail as passed to ThumbnailFetchJob,
+     * 0 for the default size. Returns a null image when the thumbnail is not
+     * in the cache.
+     */
+    [[nodiscard]] QImage find(const QString &fileId, const QDateTime &modifiedDate, int size = 0, Lookup lookup = MemoryAndDisk);
+
+    /**
+     * @brief Inserts thumbnail @p image of file @p fileId modified at @p modifiedDate
+     *
+     * @p data is the encoded image written to the backing directory, the
+     * @p image is encoded as PNG when @p data is empty. Thumbnails of older
+     * versions of the file are removed.
+     */
+    void insert(const QString &fileId, const QDateTime &modifiedDate, int size, const QImage &image, const QByteArray &data = QByteArray());
+
+    /**
+     * @brief Removes all thumbnails from memory and from the backing directory
+     */
+    void clear();
+
+private:
+    Q_DISABLE_COPY(ThumbnailCache)
+
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace Drive
+
+} // namespace KGAPI2
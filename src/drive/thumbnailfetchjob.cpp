@@ -0,0 +1,353 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "thumbnailfetchjob.h"
+#include "debug.h"
+#include "file.h"
+#include "thumbnailcache.h"
+
+#include <QHash>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QQueue>
+#include <QRegularExpression>
+#include <QThreadPool>
+
+using namespace KGAPI2;
+using namespace KGAPI2::Drive;
+
+class Q_DECL_HIDDEN ThumbnailFetchJob::Private
+{
+public:
+    Private(ThumbnailFetchJob *parent);
+
+    QUrl thumbnailUrl(const QUrl &link) const;
+    void lookup(const FilePtr &file);
+    void decode(const QString &fileId, const QByteArray &data);
+    void scheduleRequests();
+    void deliver(const QString &fileId, const QImage &thumbnail);
+    void fail(const QString &fileId);
+    void resolve();
+
+    FilesList files;
+    int thumbnailSize = 0;
+    int maxParallelRequests = 8;
+    ThumbnailCache *cache = nullptr;
+
+    QHash<QString, QImage> thumbnails;
+    QStringList unavailableFiles;
+
+    QHash<QString, FilePtr> filesById;
+    // Files whose thumbnail is to be downloaded
+    QQueue<FilePtr> queue;
+    QHash<const QNetworkReply *, QString> replyFiles;
+    int runningRequests = 0;
+    // Files that have neither been delivered nor failed yet
+    int unresolved = 0;
+    // The job has nothing more to download, but thumbnails are still being decoded
+    bool finishPending = false;
+    // A request has failed, the job finishes with the error right away
+    bool failed = false;
+
+    // Destroyed with the job, waits for the running tasks, whose results
+    // are delivered through the event loop of the job
+    QThreadPool threadPool;
+
+private:
+    ThumbnailFetchJob *const q;
+};
+
+ThumbnailFetchJob::Private::Private(ThumbnailFetchJob *parent)
+    : q(parent)
+{
+}
+
+QUrl ThumbnailFetchJob::Private::thumbnailUrl(const QUrl &link) const
+{
+    if (thumbnailSize <= 0) {
+        return link;
+    }
+
+    // The links end with the size of the thumbnail, e.g. "=s220"
+    static const QRegularExpression sizeSuffix(QStringLiteral("=s\\d+$"));
+    QUrl url(link);
+    QString path = url.path();
+    path.replace(sizeSuffix, QStringLiteral("=s%1").arg(thumbnailSize));
+    url.setPath(path);
+    return url;
+}
+
+void ThumbnailFetchJob::Private::lookup(const FilePtr &file)
+{
+    const QString fileId = file->id();
+    const QDateTime modifiedDate = file->modifiedDate();
+    if (cache) {
+        const QImage thumbnail = cache->find(fileId, modifiedDate, thumbnailSize, ThumbnailCache::MemoryOnly);
+        if (!thumbnail.isNull()) {
+            deliver(fileId, thumbnail);
+            return;
+        }
+    }
+
+    if (!file->thumbnailLink().isValid() || file->thumbnailLink().isEmpty()) {
+        fail(fileId);
+        return;
+    }
+
+    if (!cache || cache->directory().isEmpty()) {
+        queue.enqueue(file);
+        return;
+    }
+
+    // Reading from the disk could block the UI
+    threadPool.start([this, job = q, file, fileId, modifiedDate, cache = cache, size = thumbnailSize]() {
+        const QImage thumbnail = cache->find(fileId, modifiedDate, size);
+        QMetaObject::invokeMethod(
+            job,
+            [this, file, fileId, thumbnail]() {
+                if (!q->isRunning()) {
+                    return;
+                }
+                if (thumbnail.isNull()) {
+                    queue.enqueue(file);
+                    scheduleRequests();
+                } else {
+                    deliver(fileId, thumbnail);
+                }
+            },
+            Qt::QueuedConnection);
+    });
+}
+
+void ThumbnailFetchJob::Private::decode(const QString &fileId, const QByteArray &data)
+{
+    const FilePtr file = filesById.value(fileId);
+    const QDateTime modifiedDate = file ? file->modifiedDate() : QDateTime();
+    threadPool.start([this, job = q, fileId, modifiedDate, data, cache = cache, size = thumbnailSize]() {
+        const QImage thumbnail = QImage::fromData(data);
+        if (cache && !thumbnail.isNull()) {
+            cache->insert(fileId, modifiedDate, size, thumbnail, data);
+        }
+        QMetaObject::invokeMethod(
+            job,
+            [this, fileId, thumbnail]() {
+                if (!q->isRunning()) {
+                    return;
+                }
+                if (thumbnail.isNull()) {
+                    qCWarning(KGAPIDebug) << "Failed to decode thumbnail of" << fileId;
+                    fail(fileId);
+                } else {
+                    deliver(fileId, thumbnail);
+                }
+            },
+            Qt::QueuedConnection);
+    });
+}
+
+void ThumbnailFetchJob::Private::scheduleRequests()
+{
+    while (runningRequests < maxParallelRequests && !queue.isEmpty()) {
+        const FilePtr file = queue.dequeue();
+        QNetworkRequest request(thumbnailUrl(file->thumbnailLink()));
+        request.setAttribute(QNetworkRequest::User, file->id());
+        ++runningRequests;
+        q->enqueueRequest(request);
+    }
+}
+
+void ThumbnailFetchJob::Private::deliver(const QString &fileId, const QImage &thumbnail)
+{
+    thumbnails.insert(fileId, thumbnail);
+    Q_EMIT q->thumbnailFetched(q, fileId, thumbnail);
+    resolve();
+}
+
+void ThumbnailFetchJob::Private::fail(const QString &fileId)
+{
+    unavailableFiles << fileId;
+    resolve();
+}
+
+void ThumbnailFetchJob::Private::resolve()
+{
+    --unresolved;
+    q->emitProgress(files.size() - unresolved, files.size());
+    if (unresolved == 0 && finishPending) {
+        finishPending = false;
+        q->Job::emitFinished();
+    }
+}
+
+ThumbnailFetchJob::ThumbnailFetchJob(const FilePtr &file, const AccountPtr &account, QObject *parent)
+    : ThumbnailFetchJob(FilesList{file}, account, parent)
+{
+}
+
+ThumbnailFetchJob::ThumbnailFetchJob(const FilesList &files, const AccountPtr &account, QObject *parent)
+    : Job(account, parent)
+    , d(new Private(this))
+{
+    d->files = files;
+}
+
+ThumbnailFetchJob::~ThumbnailFetchJob()
+{
+    delete d;
+}
+
+int ThumbnailFetchJob::thumbnailSize() const
+{
+    return d->thumbnailSize;
+}
+
+void ThumbnailFetchJob::setThumbnailSize(int size)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify thumbnailSize property when job is running";
+        return;
+    }
+
+    d->thumbnailSize = qMax(size, 0);
+}
+
+int ThumbnailFetchJob::maxParallelRequests() const
+{
+    return d->maxParallelRequests;
+}
+
+void ThumbnailFetchJob::setMaxParallelRequests(int maxParallelRequests)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify maxParallelRequests property when job is running";
+        return;
+    }
+
+    d->maxParallelRequests = qMax(maxParallelRequests, 1);
+}
+
+void ThumbnailFetchJob::setCache(ThumbnailCache *cache)
+{
+    if (isRunning()) {
+        qCWarning(KGAPIDebug) << "Can't modify cache property when job is running";
+        return;
+    }
+
+    d->cache = cache;
+}
+
+ThumbnailCache *ThumbnailFetchJob::cache() const
+{
+    return d->cache;
+}
+
+QHash<QString, QImage> ThumbnailFetchJob::thumbnails() const
+{
+    return d->thumbnails;
+}
+
+QStringList ThumbnailFetchJob::unavailableFiles() const
+{
+    return d->unavailableFiles;
+}
+
+void ThumbnailFetchJob::start()
+{
+    d->thumbnails.clear();
+    d->unavailableFiles.clear();
+    d->filesById.clear();
+    d->queue.clear();
+    d->replyFiles.clear();
+    d->runningRequests = 0;
+    d->finishPending = false;
+    d->failed = false;
+
+    for (const auto &file : std::as_const(d->files)) {
+        d->filesById.insert(file->id(), file);
+    }
+    d->unresolved = d->files.size();
+
+    for (const auto &file : std::as_const(d->files)) {
+        d->lookup(file);
+    }
+    d->scheduleRequests();
+
+    if (d->unresolved == 0) {
+        emitFinished();
+    }
+}
+
+void ThumbnailFetchJob::emitFinished()
+{
+    // The job runs out of requests while the last thumbnails are decoded
+    if (!d->failed && d->unresolved > 0) {
+        d->finishPending = true;
+        return;
+    }
+
+    d->finishPending = false;
+    Job::emitFinished();
+}
+
+void ThumbnailFetchJob::dispatchRequest(QNetworkAccessManager *accessManager,
+                                        const QNetworkRequest &request,
+                                        const QByteArray &data,
+                                        const QString &contentType)
+{
+    Q_UNUSED(data)
+    Q_UNUSED(contentType)
+
+    QNetworkReply *reply = accessManager->get(request);
+    const QString fileId = request.attribute(QNetworkRequest::User).toString();
+    d->replyFiles.insert(reply, fileId);
+    connect(reply, &QNetworkReply::finished, this, [this, reply, fileId]() {
+        // Failures are handled here, handleError() does not know the file
+        const int replyCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+        if (isRunning() && (replyCode == KGAPI2::Forbidden || replyCode == KGAPI2::NotFound || replyCode == KGAPI2::Gone)) {
+            qCDebug(KGAPIDebug) << "Thumbnail of" << fileId << "is not available:" << replyCode;
+            --d->runningRequests;
+            d->fail(fileId);
+            d->scheduleRequests();
+        }
+    });
+    connect(reply, &QObject::destroyed, this, [this, reply]() {
+        d->replyFiles.remove(reply);
+    });
+}
+
+void ThumbnailFetchJob::handleReply(const QNetworkReply *reply, const QByteArray &rawData)
+{
+    const QString fileId = d->replyFiles.value(reply);
+    if (fileId.isEmpty()) {
+        qCWarning(KGAPIDebug) << "Received reply for an unknown thumbnail" << reply->url();
+        return;
+    }
+
+    --d->runningRequests;
+    d->decode(fileId, rawData);
+    d->scheduleRequests();
+}
+
+bool ThumbnailFetchJob::handleError(int statusCode, const QByteArray &rawData)
+{
+    // Expired links or files whose thumbnail has not been generated yet,
+    // the file is marked as unavailable when its reply finishes
+    if (statusCode == KGAPI2::Forbidden || statusCode == KGAPI2::NotFound || statusCode == KGAPI2::Gone) {
+        return true;
+    }
+
+    const bool handled = Job::handleError(statusCode, rawData);
+    // Requests exceeding the quota are sent again by the job
+    if (!handled && statusCode != KGAPI2::QuotaExceeded) {
+        d->failed = true;
+    }
+    return handled;
+}
+
+#include "moc_thumbnailfetchjob.cpp"
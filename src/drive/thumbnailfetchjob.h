@@ -0,0 +1,123 @@
+/*
+ * This file is part of LibKGAPI library
+ *
+ * SPDX-FileCopyrightText: 2026 LibKGAPI Developers
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "job.h"
+#include "kgapidrive_export.h"
+
+#include <QHash>
+#include <QImage>
+#include <QStringList>
+
+namespace KGAPI2
+{
+
+namespace Drive
+{
+
+class ThumbnailCache;
+
+/**
+ * @headerfile thumbnailfetchjob.h
+ * @brief Fetches thumbnails of files
+ *
+ * Thumbnails are downloaded from File::thumbnailLink() of the files, up to
+ * maxParallelRequests() of them at the same time, and are decoded in
+ * background threads. With a cache set, thumbnails found in the cache are
+ * not downloaded again and downloaded thumbnails are added to the cache.
+ *
+ * Each thumbnail is delivered through thumbnailFetched() as soon as it is
+ * available. Files without a thumbnail, or whose thumbnail could not be
+ * fetched, are listed in unavailableFiles(), they don't make the job fail.
+ *
+ * The files must have been fetched with the id, modifiedDate and
+ * thumbnailLink fields. The thumbnail links expire after a few hours.
+ *
+ * @since 6.4
+ */
+class KGAPIDRIVE_EXPORT ThumbnailFetchJob : public KGAPI2::Job
+{
+    Q_OBJECT
+
+    /**
+     * Size of the longer side of the thumbnails in pixels.
+     *
+     * Default value is 0, i.e. the size chosen by the server.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(int thumbnailSize READ thumbnailSize WRITE setThumbnailSize)
+
+    /**
+     * Maximum number of thumbnails downloaded at the same time.
+     *
+     * Default value is 8.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    Q_PROPERTY(int maxParallelRequests READ maxParallelRequests WRITE setMaxParallelRequests)
+
+public:
+    explicit ThumbnailFetchJob(const FilePtr &file, const AccountPtr &account, QObject *parent = nullptr);
+    explicit ThumbnailFetchJob(const FilesList &files, const AccountPtr &account, QObject *parent = nullptr);
+    ~ThumbnailFetchJob() override;
+
+    [[nodiscard]] int thumbnailSize() const;
+    void setThumbnailSize(int size);
+
+    [[nodiscard]] int maxParallelRequests() const;
+    void setMaxParallelRequests(int maxParallelRequests);
+
+    /**
+     * @brief Sets cache of the thumbnails
+     *
+     * The job does not take ownership of the @p cache, which must outlive
+     * the job. Without a cache all thumbnails are downloaded.
+     *
+     * This property can be modified only when the job is not running.
+     */
+    void setCache(ThumbnailCache *cache);
+    [[nodiscard]] ThumbnailCache *cache() const;
+
+    /**
+     * @brief Returns the fetched thumbnails by ID of the file
+     */
+    [[nodiscard]] QHash<QString, QImage> thumbnails() const;
+
+    /**
+     * @brief Returns IDs of files whose thumbnail is not available
+     */
+    [[nodiscard]] QStringList unavailableFiles() const;
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when thumbnail of file @p fileId is available
+     *
+     * @param job The job that emitted the signal
+     * @param fileId
+     * @param thumbnail
+     */
+    void thumbnailFetched(KGAPI2::Drive::ThumbnailFetchJob *job, const QString &fileId, const QImage &thumbnail);
+
+protected:
+    void start() override;
+    void emitFinished() override;
+    void dispatchRequest(QNetworkAccessManager *accessManager, const QNetworkRequest &request, const QByteArray &data, const QString &contentType) override;
+    void handleReply(const QNetworkReply *reply, const QByteArray &rawData) override;
+    bool handleError(int statusCode, const QByteArray &rawData) override;
+
+private:
+    class Private;
+    Private *const d;
+    friend class Private;
+};
+
+} // namespace Drive
+
+} // namespace KGAPI2
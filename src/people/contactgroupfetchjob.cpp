@@ -43,6 +43,7 @@ ContactGroupFetchJob::ContactGroupFetchJob(const AccountPtr& account, QObject* p
     : FetchJob(account, parent)
     , d(std::make_unique<Private>(this))
 {
+    setPageSizeParameter(QStringLiteral("pageSize"), 1000);
 }
 
 QNetworkRequest ContactGroupFetchJob::Private::createRequest(const QUrl& url)
@@ -91,6 +91,7 @@ ObjectsList PersonFetchJob::Private::processReceivedData(const QByteArray &rawDa
         q->enqueueRequest(request);
     } else {
         receivedSyncToken = feedData.syncToken;
+        q->setReceivedSyncState(receivedSyncToken);
         q->emitFinished();
     }
 
@@ -101,6 +102,7 @@ PersonFetchJob::PersonFetchJob(const AccountPtr& account, QObject* parent)
     : FetchJob(account, parent)
     , d(std::make_unique<Private>(this))
 {
+    setPageSizeParameter(QStringLiteral("pageSize"), 1000);
 }
 
 PersonFetchJob::PersonFetchJob(const QString &resourceName, const AccountPtr &account, QObject* parent)
@@ -134,6 +136,9 @@ QString PersonFetchJob::receivedSyncToken() const
 
 void PersonFetchJob::start()
 {
+    if (d->personResourceName.isEmpty() && d->syncToken.isEmpty()) {
+        d->syncToken = storedSyncState();
+    }
     d->startFetch();
 }
 
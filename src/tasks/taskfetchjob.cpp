@@ -12,6 +12,7 @@
 #include "tasksservice.h"
 #include "utils.h"
 
+#include <QDateTime>
 #include <QNetworkReply>
 #include <QNetworkRequest>
 #include <QUrlQuery>
@@ -30,6 +31,10 @@ static const auto DueMaxParam = QStringLiteral("dueMax");
 
 static constexpr bool FetchDeletedDefault = false;
 static constexpr bool FetchCompletedDefault = false;
+
+// Tasks modified shortly before the time the sync state is taken from may
+// not be listed yet, they are fetched again on the next sync
+static constexpr qint64 SyncStateSafetyMargin = 5 * 60;
 }
 
 class Q_DECL_HIDDEN TaskFetchJob::Private
@@ -44,6 +49,7 @@ public:
     quint64 completedMax;
     quint64 dueMin;
     quint64 dueMax;
+    bool hasServerSyncState = false;
 };
 
 TaskFetchJob::TaskFetchJob(const QString &taskListId, const AccountPtr &account, QObject *parent)
@@ -51,6 +57,7 @@ TaskFetchJob::TaskFetchJob(const QString &taskListId, const AccountPtr &account,
     , d(new Private())
 {
     d->taskListId = taskListId;
+    setPageSizeParameter(QStringLiteral("maxResults"), 100);
 }
 
 TaskFetchJob::TaskFetchJob(const QString &taskId, const QString &taskListId, const AccountPtr &account, QObject *parent)
@@ -165,6 +172,15 @@ void TaskFetchJob::start()
 {
     QUrl url;
     if (d->taskId.isEmpty()) {
+        quint64 updatedMin = d->updatedTimestamp;
+        if (updatedMin == 0) {
+            updatedMin = storedSyncState().toULongLong();
+        }
+        // Replaced by the time of the server once it replies, the clock of
+        // the client may be off
+        d->hasServerSyncState = false;
+        setReceivedSyncState(QString::number(QDateTime::currentSecsSinceEpoch() - SyncStateSafetyMargin));
+
         url = TasksService::fetchAllTasksUrl(d->taskListId);
         QUrlQuery query(url);
         if (d->fetchDeleted != FetchDeletedDefault) {
@@ -173,8 +189,8 @@ void TaskFetchJob::start()
         if (d->fetchCompleted != FetchCompletedDefault) {
             query.addQueryItem(ShowCompletedParam, Utils::bool2Str(d->fetchCompleted));
         }
-        if (d->updatedTimestamp > 0) {
-            query.addQueryItem(UpdatedMinParam, Utils::ts2Str(d->updatedTimestamp));
+        if (updatedMin > 0) {
+            query.addQueryItem(UpdatedMinParam, Utils::ts2Str(updatedMin));
         }
         if (d->completedMin > 0) {
             query.addQueryItem(CompletedMinParam, Utils::ts2Str(d->completedMin));
@@ -207,6 +223,13 @@ ObjectsList TaskFetchJob::handleReplyWithItems(const QNetworkReply *reply, const
     ContentType ct = Utils::stringToContentType(contentType);
     if (ct == KGAPI2::JSON) {
         if (d->taskId.isEmpty()) {
+            // Tasks modified after the first page has been listed are fetched
+            // again next time
+            const QDateTime serverTime = QDateTime::fromString(QString::fromLatin1(reply->rawHeader("Date")), Qt::RFC2822Date);
+            if (!d->hasServerSyncState && serverTime.isValid()) {
+                setReceivedSyncState(QString::number(serverTime.toSecsSinceEpoch() - SyncStateSafetyMargin));
+                d->hasServerSyncState = true;
+            }
             items = TasksService::parseJSONFeed(rawData, feedData);
         } else {
             items << TasksService::JSONToTask(rawData);
@@ -61,7 +61,11 @@ class KGAPITASKS_EXPORT TaskFetchJob : public KGAPI2::FetchJob
      * When set, this job will only fetch tasks that have been modified since
      * given timestamp.
      *
-     * By default the timestamp is 0 and all tasks are fetched.
+     * By default the timestamp is 0 and all tasks are fetched. When a sync
+     * state store is set, the timestamp of the last successful fetch is
+     * loaded from the store instead, the property is left unchanged. The
+     * timestamp stored after a fetch is taken from the Date header of the
+     * server, a few minutes earlier to be safe.
      *
      * This property does not have any effect when fetching a specific task and
      * can be modified only when the job is not running.
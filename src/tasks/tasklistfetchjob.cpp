@@ -47,6 +47,7 @@ TaskListFetchJob::TaskListFetchJob(const AccountPtr &account, QObject *parent)
     : FetchJob(account, parent)
     , d(new Private(this))
 {
+    setPageSizeParameter(QStringLiteral("maxResults"), 100);
 }
 
 TaskListFetchJob::~TaskListFetchJob() = default;
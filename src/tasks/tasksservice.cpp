@@ -6,6 +6,7 @@
 
 #include "tasksservice.h"
 #include "object.h"
+#include "private/jsonwriter_p.h"
 #include "task.h"
 #include "tasklist.h"
 #include "utils.h"
@@ -257,48 +258,50 @@ TaskPtr JSONToTask(const QByteArray &jsonData)
 
 QByteArray taskListToJSON(const TaskListPtr &taskList)
 {
-    QVariantMap output;
+    JsonWriter writer(256);
+    writer.beginObject();
 
-    output.insert(KindAttr, QStringLiteral("tasks#taskList"));
+    writer.insert(KindAttr, "tasks#taskList");
     if (!taskList->uid().isEmpty()) {
-        output.insert(IdAttr, taskList->uid());
+        writer.insert(IdAttr, taskList->uid());
     }
-    output.insert(TitleAttr, taskList->title());
+    writer.insert(TitleAttr, taskList->title());
 
-    QJsonDocument document = QJsonDocument::fromVariant(output);
-    return document.toJson(QJsonDocument::Compact);
+    writer.endObject();
+    return writer.data();
 }
 
 QByteArray taskToJSON(const TaskPtr &task)
 {
-    QVariantMap output;
+    JsonWriter writer;
+    writer.beginObject();
 
-    output.insert(KindAttr, QStringLiteral("tasks#task"));
+    writer.insert(KindAttr, "tasks#task");
 
     if (!task->uid().isEmpty()) {
-        output.insert(IdAttr, task->uid());
+        writer.insert(IdAttr, task->uid());
     }
 
-    output.insert(TitleAttr, task->summary());
-    output.insert(NotesAttr, task->description());
+    writer.insert(TitleAttr, task->summary());
+    writer.insert(NotesAttr, task->description());
 
     if (!task->relatedTo(KCalendarCore::Incidence::RelTypeParent).isEmpty()) {
-        output.insert(ParentAttr, task->relatedTo(KCalendarCore::Incidence::RelTypeParent));
+        writer.insert(ParentAttr, task->relatedTo(KCalendarCore::Incidence::RelTypeParent));
     }
 
     if (task->dtDue().isValid()) {
-        output.insert(DueAttr, task->dtDue().toUTC().toString(DatetimeFormat));
+        writer.insert(DueAttr, task->dtDue().toUTC().toString(DatetimeFormat));
     }
 
     if ((task->status() == KCalendarCore::Incidence::StatusCompleted) && task->completed().isValid()) {
-        output.insert(CompletedAttrVal, task->completed().toUTC().toString(DatetimeFormat));
-        output.insert(StatusAttr, CompletedAttrVal);
+        writer.insert(CompletedAttrVal, task->completed().toUTC().toString(DatetimeFormat));
+        writer.insert(StatusAttr, CompletedAttrVal);
     } else {
-        output.insert(StatusAttr, NeedsActionAttrVal);
+        writer.insert(StatusAttr, NeedsActionAttrVal);
     }
 
-    QJsonDocument document = QJsonDocument::fromVariant(output);
-    return document.toJson(QJsonDocument::Compact);
+    writer.endObject();
+    return writer.data();
 }
 
 ObjectsList Private::parseTaskListJSONFeed(const QVariantList &items)